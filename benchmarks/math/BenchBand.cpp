@@ -0,0 +1,167 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <memory>
+
+#include <mcutils/math/BandLU.h>
+#include <mcutils/math/GaussJordan.h>
+#include <mcutils/math/IterativeSolvers.h>
+#include <mcutils/math/LU.h>
+#include <mcutils/math/SparseMatrix.h>
+#include <mcutils/math/Tridiagonal.h>
+
+namespace {
+
+// chain of nodes, e.g. thermal network or fluid line
+double GetChainElement(unsigned int r, unsigned int c)
+{
+    if ( r == c ) return 2.5 + 0.1 * std::sin(r);
+    if ( r == c + 1 || c == r + 1 ) return -1.0;
+    return 0.0;
+}
+
+template <unsigned int SIZE>
+void FillRhs(mc::VectorN<double,SIZE>* rhs)
+{
+    for ( unsigned int i = 0; i < SIZE; ++i )
+    {
+        (*rhs)(i) = std::cos(0.1 * i);
+    }
+}
+
+template <unsigned int SIZE>
+void BM_ChainSolveGaussJordan(benchmark::State& state)
+{
+    // heap allocated, large matrices exceed default stack size
+    auto m = std::make_unique<mc::MatrixNxN<double,SIZE>>();
+    for ( unsigned int r = 0; r < SIZE; ++r )
+    {
+        for ( unsigned int c = 0; c < SIZE; ++c )
+        {
+            (*m)(r,c) = GetChainElement(r, c);
+        }
+    }
+    mc::VectorN<double,SIZE> rhs;
+    mc::VectorN<double,SIZE> x;
+    FillRhs(&rhs);
+
+    for ( auto _ : state )
+    {
+        mc::SolveGaussJordan(*m, rhs, &x);
+        benchmark::DoNotOptimize(x);
+    }
+}
+
+template <unsigned int SIZE>
+void BM_ChainSolveLU(benchmark::State& state)
+{
+    auto m = std::make_unique<mc::MatrixNxN<double,SIZE>>();
+    for ( unsigned int r = 0; r < SIZE; ++r )
+    {
+        for ( unsigned int c = 0; c < SIZE; ++c )
+        {
+            (*m)(r,c) = GetChainElement(r, c);
+        }
+    }
+    mc::VectorN<double,SIZE> rhs;
+    mc::VectorN<double,SIZE> x;
+    FillRhs(&rhs);
+    auto lu = std::make_unique<mc::LU<double,SIZE>>();
+
+    for ( auto _ : state )
+    {
+        lu->Factorize(*m);
+        lu->Solve(rhs, &x);
+        benchmark::DoNotOptimize(x);
+    }
+}
+
+template <unsigned int SIZE>
+void BM_ChainSolveTridiagonal(benchmark::State& state)
+{
+    mc::TridiagonalMatrix<double,SIZE> m;
+    for ( unsigned int r = 0; r < SIZE; ++r )
+    {
+        for ( unsigned int c = (r > 0 ? r - 1 : 0); c < SIZE && c <= r + 1; ++c )
+        {
+            m(r,c) = GetChainElement(r, c);
+        }
+    }
+    mc::VectorN<double,SIZE> rhs;
+    mc::VectorN<double,SIZE> x;
+    FillRhs(&rhs);
+
+    for ( auto _ : state )
+    {
+        mc::SolveTridiagonal(m, rhs, &x);
+        benchmark::DoNotOptimize(x);
+    }
+}
+
+template <unsigned int SIZE>
+void BM_ChainSolveBandLU(benchmark::State& state)
+{
+    mc::BandMatrix<double,SIZE,1,1> m;
+    for ( unsigned int r = 0; r < SIZE; ++r )
+    {
+        for ( unsigned int c = (r > 0 ? r - 1 : 0); c < SIZE && c <= r + 1; ++c )
+        {
+            m(r,c) = GetChainElement(r, c);
+        }
+    }
+    mc::VectorN<double,SIZE> rhs;
+    mc::VectorN<double,SIZE> x;
+    FillRhs(&rhs);
+    mc::BandLU<double,SIZE,1,1> lu;
+
+    for ( auto _ : state )
+    {
+        lu.Factorize(m);
+        lu.Solve(rhs, &x);
+        benchmark::DoNotOptimize(x);
+    }
+}
+
+template <unsigned int SIZE>
+void BM_ChainSolveConjugateGradient(benchmark::State& state)
+{
+    std::vector<typename mc::SparseMatrix<double,SIZE,SIZE>::Triplet> triplets;
+    for ( unsigned int r = 0; r < SIZE; ++r )
+    {
+        for ( unsigned int c = (r > 0 ? r - 1 : 0); c < SIZE && c <= r + 1; ++c )
+        {
+            triplets.push_back({ r, c, GetChainElement(r, c) });
+        }
+    }
+    mc::SparseMatrix<double,SIZE,SIZE> m;
+    m.SetFromTriplets(triplets);
+    mc::VectorN<double,SIZE> rhs;
+    FillRhs(&rhs);
+
+    for ( auto _ : state )
+    {
+        mc::VectorN<double,SIZE> x;
+        mc::SolveConjugateGradient(m, rhs, &x);
+        benchmark::DoNotOptimize(x);
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_ChainSolveGaussJordan<50>);
+BENCHMARK(BM_ChainSolveGaussJordan<200>);
+
+BENCHMARK(BM_ChainSolveLU<50>);
+BENCHMARK(BM_ChainSolveLU<200>);
+
+BENCHMARK(BM_ChainSolveTridiagonal<50>);
+BENCHMARK(BM_ChainSolveTridiagonal<200>);
+BENCHMARK(BM_ChainSolveTridiagonal<1000>);
+
+BENCHMARK(BM_ChainSolveBandLU<50>);
+BENCHMARK(BM_ChainSolveBandLU<200>);
+BENCHMARK(BM_ChainSolveBandLU<1000>);
+
+BENCHMARK(BM_ChainSolveConjugateGradient<50>);
+BENCHMARK(BM_ChainSolveConjugateGradient<200>);
+BENCHMARK(BM_ChainSolveConjugateGradient<1000>);
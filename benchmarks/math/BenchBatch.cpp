@@ -0,0 +1,262 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+#include <mcutils/math/QuaternionBatch.h>
+#include <mcutils/math/RMatrix.h>
+#include <mcutils/math/Vector3Batch.h>
+
+using namespace units::literals;
+
+namespace {
+
+constexpr unsigned int kSize = 1024;
+
+mc::Vector3d GetVector(unsigned int i)
+{
+    return mc::Vector3d(std::sin(0.1 * i), std::cos(0.2 * i), 0.5 + 0.01 * i);
+}
+
+mc::Quaternion GetQuaternion(unsigned int i)
+{
+    return mc::Quaternion(mc::Angles(units::angle::radian_t(0.01 * i),
+                                     units::angle::radian_t(0.02 * i),
+                                     units::angle::radian_t(0.03 * i)));
+}
+
+void BM_VectorsIntegrate(benchmark::State& state)
+{
+    std::vector<mc::Vector3d> pos(kSize);
+    std::vector<mc::Vector3d> vel(kSize);
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        vel[i] = GetVector(i);
+    }
+
+    for ( auto _ : state )
+    {
+        for ( unsigned int i = 0; i < kSize; ++i )
+        {
+            pos[i] += vel[i] * 0.01;
+        }
+        benchmark::DoNotOptimize(pos.data());
+    }
+}
+
+void BM_Vector3BatchIntegrate(benchmark::State& state)
+{
+    mc::Vector3Batch pos(kSize);
+    mc::Vector3Batch vel(kSize);
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        vel.Set(i, GetVector(i));
+    }
+
+    for ( auto _ : state )
+    {
+        pos.AddScaled(vel, 0.01);
+        benchmark::DoNotOptimize(pos.x());
+    }
+}
+
+void BM_VectorsCross(benchmark::State& state)
+{
+    std::vector<mc::Vector3d> v1(kSize);
+    std::vector<mc::Vector3d> v2(kSize);
+    std::vector<mc::Vector3d> v3(kSize);
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        v1[i] = GetVector(i);
+        v2[i] = GetVector(kSize - i);
+    }
+
+    for ( auto _ : state )
+    {
+        for ( unsigned int i = 0; i < kSize; ++i )
+        {
+            v3[i] = v1[i] % v2[i];
+        }
+        benchmark::DoNotOptimize(v3.data());
+    }
+}
+
+void BM_Vector3BatchCross(benchmark::State& state)
+{
+    mc::Vector3Batch v1(kSize);
+    mc::Vector3Batch v2(kSize);
+    mc::Vector3Batch v3(kSize);
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        v1.Set(i, GetVector(i));
+        v2.Set(i, GetVector(kSize - i));
+    }
+
+    for ( auto _ : state )
+    {
+        v1.Cross(v2, &v3);
+        benchmark::DoNotOptimize(v3.x());
+    }
+}
+
+void BM_VectorsNormalize(benchmark::State& state)
+{
+    std::vector<mc::Vector3d> v(kSize);
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        v[i] = GetVector(i);
+    }
+
+    for ( auto _ : state )
+    {
+        for ( unsigned int i = 0; i < kSize; ++i )
+        {
+            v[i].Normalize();
+        }
+        benchmark::DoNotOptimize(v.data());
+    }
+}
+
+void BM_Vector3BatchNormalize(benchmark::State& state)
+{
+    mc::Vector3Batch v(kSize);
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        v.Set(i, GetVector(i));
+    }
+
+    for ( auto _ : state )
+    {
+        v.Normalize();
+        benchmark::DoNotOptimize(v.x());
+    }
+}
+
+void BM_VectorsMultiplyByMatrix(benchmark::State& state)
+{
+    mc::RMatrix m(mc::Angles(30.0_deg, 45.0_deg, 60.0_deg));
+    std::vector<mc::Vector3d> v1(kSize);
+    std::vector<mc::Vector3d> v2(kSize);
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        v1[i] = GetVector(i);
+    }
+
+    for ( auto _ : state )
+    {
+        for ( unsigned int i = 0; i < kSize; ++i )
+        {
+            v2[i] = m * v1[i];
+        }
+        benchmark::DoNotOptimize(v2.data());
+    }
+}
+
+void BM_Vector3BatchMultiplyByMatrix(benchmark::State& state)
+{
+    mc::RMatrix m(mc::Angles(30.0_deg, 45.0_deg, 60.0_deg));
+    mc::Vector3Batch v1(kSize);
+    mc::Vector3Batch v2(kSize);
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        v1.Set(i, GetVector(i));
+    }
+
+    for ( auto _ : state )
+    {
+        v1.MultiplyByMatrix(m, &v2);
+        benchmark::DoNotOptimize(v2.x());
+    }
+}
+
+void BM_QuaternionsMultiply(benchmark::State& state)
+{
+    std::vector<mc::Quaternion> q1(kSize);
+    std::vector<mc::Quaternion> q2(kSize);
+    std::vector<mc::Quaternion> q3(kSize);
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        q1[i] = GetQuaternion(i);
+        q2[i] = GetQuaternion(kSize - i);
+    }
+
+    for ( auto _ : state )
+    {
+        for ( unsigned int i = 0; i < kSize; ++i )
+        {
+            q3[i] = q1[i] * q2[i];
+        }
+        benchmark::DoNotOptimize(q3.data());
+    }
+}
+
+void BM_QuaternionBatchMultiply(benchmark::State& state)
+{
+    mc::QuaternionBatch q1(kSize);
+    mc::QuaternionBatch q2(kSize);
+    mc::QuaternionBatch q3(kSize);
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        q1.Set(i, GetQuaternion(i));
+        q2.Set(i, GetQuaternion(kSize - i));
+    }
+
+    for ( auto _ : state )
+    {
+        q1.Multiply(q2, &q3);
+        benchmark::DoNotOptimize(q3.e0());
+    }
+}
+
+void BM_QuaternionsNormalize(benchmark::State& state)
+{
+    std::vector<mc::Quaternion> q(kSize);
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        q[i] = GetQuaternion(i);
+    }
+
+    for ( auto _ : state )
+    {
+        for ( unsigned int i = 0; i < kSize; ++i )
+        {
+            q[i].Normalize();
+        }
+        benchmark::DoNotOptimize(q.data());
+    }
+}
+
+void BM_QuaternionBatchNormalize(benchmark::State& state)
+{
+    mc::QuaternionBatch q(kSize);
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        q.Set(i, GetQuaternion(i));
+    }
+
+    for ( auto _ : state )
+    {
+        q.Normalize();
+        benchmark::DoNotOptimize(q.e0());
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_VectorsIntegrate);
+BENCHMARK(BM_Vector3BatchIntegrate);
+
+BENCHMARK(BM_VectorsCross);
+BENCHMARK(BM_Vector3BatchCross);
+
+BENCHMARK(BM_VectorsNormalize);
+BENCHMARK(BM_Vector3BatchNormalize);
+
+BENCHMARK(BM_VectorsMultiplyByMatrix);
+BENCHMARK(BM_Vector3BatchMultiplyByMatrix);
+
+BENCHMARK(BM_QuaternionsMultiply);
+BENCHMARK(BM_QuaternionBatchMultiply);
+
+BENCHMARK(BM_QuaternionsNormalize);
+BENCHMARK(BM_QuaternionBatchNormalize);
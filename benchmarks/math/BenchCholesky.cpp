@@ -0,0 +1,99 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include <mcutils/math/Cholesky.h>
+#include <mcutils/math/LDLT.h>
+#include <mcutils/math/LU.h>
+
+namespace {
+
+// symmetric positive-definite, covariance-like matrix
+template <unsigned int SIZE>
+void FillSystem(mc::MatrixNxN<double,SIZE>* m, mc::VectorN<double,SIZE>* rhs)
+{
+    for ( unsigned int r = 0; r < SIZE; ++r )
+    {
+        for ( unsigned int c = 0; c < SIZE; ++c )
+        {
+            (*m)(r,c) = std::cos(0.3 * (r + c)) + (r == c ? SIZE : 0.0);
+        }
+        (*rhs)(r) = std::cos(0.1 * r);
+    }
+}
+
+template <template <typename, unsigned int> class SOLVER, unsigned int SIZE>
+void BM_FactorizeAndSolve(benchmark::State& state)
+{
+    mc::MatrixNxN<double,SIZE> m;
+    mc::VectorN<double,SIZE> rhs;
+    mc::VectorN<double,SIZE> x;
+    FillSystem<SIZE>(&m, &rhs);
+    SOLVER<double,SIZE> solver;
+
+    for ( auto _ : state )
+    {
+        solver.Factorize(m);
+        solver.Solve(rhs, &x);
+        benchmark::DoNotOptimize(x);
+    }
+}
+
+// refactorizing after measurement update versus rank-1 update of the factor
+template <unsigned int SIZE>
+void BM_CholeskyRefactorize(benchmark::State& state)
+{
+    mc::MatrixNxN<double,SIZE> m;
+    mc::VectorN<double,SIZE> v;
+    FillSystem<SIZE>(&m, &v);
+    mc::Cholesky<double,SIZE> chol;
+
+    for ( auto _ : state )
+    {
+        mc::MatrixNxN<double,SIZE> m_upd = m;
+        for ( unsigned int r = 0; r < SIZE; ++r )
+        {
+            for ( unsigned int c = 0; c < SIZE; ++c )
+            {
+                m_upd(r,c) += v(r) * v(c);
+            }
+        }
+        chol.Factorize(m_upd);
+        benchmark::DoNotOptimize(chol);
+    }
+}
+
+template <template <typename, unsigned int> class SOLVER, unsigned int SIZE>
+void BM_UpdateDowndate(benchmark::State& state)
+{
+    mc::MatrixNxN<double,SIZE> m;
+    mc::VectorN<double,SIZE> v;
+    FillSystem<SIZE>(&m, &v);
+    SOLVER<double,SIZE> solver(m);
+
+    for ( auto _ : state )
+    {
+        // pair keeps the factor bounded across iterations
+        solver.Update(v);
+        solver.Downdate(v);
+        benchmark::DoNotOptimize(solver);
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_FactorizeAndSolve<mc::LU,6>);
+BENCHMARK(BM_FactorizeAndSolve<mc::Cholesky,6>);
+BENCHMARK(BM_FactorizeAndSolve<mc::LDLT,6>);
+
+BENCHMARK(BM_FactorizeAndSolve<mc::LU,12>);
+BENCHMARK(BM_FactorizeAndSolve<mc::Cholesky,12>);
+BENCHMARK(BM_FactorizeAndSolve<mc::LDLT,12>);
+
+BENCHMARK(BM_FactorizeAndSolve<mc::LU,18>);
+BENCHMARK(BM_FactorizeAndSolve<mc::Cholesky,18>);
+BENCHMARK(BM_FactorizeAndSolve<mc::LDLT,18>);
+
+BENCHMARK(BM_CholeskyRefactorize<12>);
+BENCHMARK(BM_UpdateDowndate<mc::Cholesky,12>);
+BENCHMARK(BM_UpdateDowndate<mc::LDLT,12>);
@@ -0,0 +1,149 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include <mcutils/math/GaussJordan.h>
+#include <mcutils/math/LU.h>
+
+namespace {
+
+// diagonally dominant, Jacobian-like matrix
+template <unsigned int SIZE>
+void FillSystem(mc::MatrixNxN<double,SIZE>* m, mc::VectorN<double,SIZE>* rhs)
+{
+    for ( unsigned int r = 0; r < SIZE; ++r )
+    {
+        for ( unsigned int c = 0; c < SIZE; ++c )
+        {
+            (*m)(r,c) = std::sin(0.3 * r + 0.7 * c) + (r == c ? SIZE : 0.0);
+        }
+        (*rhs)(r) = std::cos(0.1 * r);
+    }
+}
+
+template <unsigned int SIZE>
+void BM_SolveGaussJordan(benchmark::State& state)
+{
+    mc::MatrixNxN<double,SIZE> m;
+    mc::VectorN<double,SIZE> rhs;
+    mc::VectorN<double,SIZE> x;
+    FillSystem<SIZE>(&m, &rhs);
+
+    for ( auto _ : state )
+    {
+        mc::SolveGaussJordan(m, rhs, &x);
+        benchmark::DoNotOptimize(x);
+    }
+}
+
+template <unsigned int SIZE>
+void BM_LUFactorizeAndSolve(benchmark::State& state)
+{
+    mc::MatrixNxN<double,SIZE> m;
+    mc::VectorN<double,SIZE> rhs;
+    mc::VectorN<double,SIZE> x;
+    FillSystem<SIZE>(&m, &rhs);
+    mc::LU<double,SIZE> lu;
+
+    for ( auto _ : state )
+    {
+        lu.Factorize(m);
+        lu.Solve(rhs, &x);
+        benchmark::DoNotOptimize(x);
+    }
+}
+
+// solving against already factorized matrix, e.g. Newton iterations with frozen Jacobian
+template <unsigned int SIZE>
+void BM_LUSolve(benchmark::State& state)
+{
+    mc::MatrixNxN<double,SIZE> m;
+    mc::VectorN<double,SIZE> rhs;
+    mc::VectorN<double,SIZE> x;
+    FillSystem<SIZE>(&m, &rhs);
+    mc::LU<double,SIZE> lu(m);
+
+    for ( auto _ : state )
+    {
+        lu.Solve(rhs, &x);
+        benchmark::DoNotOptimize(x);
+    }
+}
+
+// several right hand sides per step
+template <unsigned int SIZE, unsigned int COLS>
+void BM_SolveGaussJordanMultiple(benchmark::State& state)
+{
+    mc::MatrixNxN<double,SIZE> m;
+    mc::VectorN<double,SIZE> rhs;
+    mc::VectorN<double,SIZE> x;
+    FillSystem<SIZE>(&m, &rhs);
+
+    for ( auto _ : state )
+    {
+        for ( unsigned int i = 0; i < COLS; ++i )
+        {
+            rhs(0) = 0.1 * i;
+            mc::SolveGaussJordan(m, rhs, &x);
+            benchmark::DoNotOptimize(x);
+        }
+    }
+}
+
+template <unsigned int SIZE, unsigned int COLS>
+void BM_LUSolveMultiple(benchmark::State& state)
+{
+    mc::MatrixNxN<double,SIZE> m;
+    mc::VectorN<double,SIZE> rhs;
+    mc::MatrixMxN<double,SIZE,COLS> b;
+    mc::MatrixMxN<double,SIZE,COLS> x;
+    FillSystem<SIZE>(&m, &rhs);
+    mc::LU<double,SIZE> lu;
+
+    for ( auto _ : state )
+    {
+        lu.Factorize(m);
+        for ( unsigned int i = 0; i < COLS; ++i )
+        {
+            b(0,i) = 0.1 * i;
+        }
+        lu.Solve(b, &x);
+        benchmark::DoNotOptimize(x);
+    }
+}
+
+template <unsigned int SIZE>
+void BM_LUInverse(benchmark::State& state)
+{
+    mc::MatrixNxN<double,SIZE> m;
+    mc::VectorN<double,SIZE> rhs;
+    mc::MatrixNxN<double,SIZE> inv;
+    FillSystem<SIZE>(&m, &rhs);
+    mc::LU<double,SIZE> lu;
+
+    for ( auto _ : state )
+    {
+        lu.Factorize(m);
+        lu.GetInverse(&inv);
+        benchmark::DoNotOptimize(inv);
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_SolveGaussJordan<6>);
+BENCHMARK(BM_SolveGaussJordan<12>);
+BENCHMARK(BM_SolveGaussJordan<18>);
+
+BENCHMARK(BM_LUFactorizeAndSolve<6>);
+BENCHMARK(BM_LUFactorizeAndSolve<12>);
+BENCHMARK(BM_LUFactorizeAndSolve<18>);
+
+BENCHMARK(BM_LUSolve<6>);
+BENCHMARK(BM_LUSolve<12>);
+BENCHMARK(BM_LUSolve<18>);
+
+BENCHMARK(BM_SolveGaussJordanMultiple<12,6>);
+BENCHMARK(BM_LUSolveMultiple<12,6>);
+
+BENCHMARK(BM_LUInverse<12>);
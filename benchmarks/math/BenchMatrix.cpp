@@ -0,0 +1,112 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <memory>
+
+#include <mcutils/math/Matrix.h>
+
+namespace {
+
+template <unsigned int ROWS, unsigned int COLS>
+void FillMatrix(mc::MatrixMxN<double,ROWS,COLS>* matrix, double seed)
+{
+    for ( unsigned int r = 0; r < ROWS; ++r )
+    {
+        for ( unsigned int c = 0; c < COLS; ++c )
+        {
+            (*matrix)(r,c) = std::sin(seed + 0.3 * r + 0.7 * c);
+        }
+    }
+}
+
+template <unsigned int SIZE>
+void BM_MatrixNxNMultiply(benchmark::State& state)
+{
+    // heap allocated, large matrices exceed default stack size
+    auto m1 = std::make_unique<mc::MatrixNxN<double,SIZE>>();
+    auto m2 = std::make_unique<mc::MatrixNxN<double,SIZE>>();
+    auto mr = std::make_unique<mc::MatrixNxN<double,SIZE>>();
+    FillMatrix<SIZE,SIZE>(m1.get(), 0.1);
+    FillMatrix<SIZE,SIZE>(m2.get(), 0.2);
+
+    for ( auto _ : state )
+    {
+        *mr = (*m1) * (*m2);
+        benchmark::DoNotOptimize(mr.get());
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["flops"] = benchmark::Counter(2.0 * SIZE * SIZE * SIZE * state.iterations(),
+                                                 benchmark::Counter::kIsRate);
+}
+
+// Kalman filter covariance propagation, F * P * F^T
+template <unsigned int SIZE>
+void BM_MatrixNxNCovariance(benchmark::State& state)
+{
+    mc::MatrixNxN<double,SIZE> f;
+    mc::MatrixNxN<double,SIZE> p;
+    FillMatrix<SIZE,SIZE>(&f, 0.1);
+    FillMatrix<SIZE,SIZE>(&p, 0.2);
+    mc::MatrixNxN<double,SIZE> ft = f.GetTransposed();
+
+    for ( auto _ : state )
+    {
+        mc::MatrixNxN<double,SIZE> pr = f * p * ft;
+        benchmark::DoNotOptimize(pr);
+    }
+}
+
+// Kalman filter measurement matrix product, H * P
+template <unsigned int ROWS, unsigned int COLS>
+void BM_MatrixMxNMultiply(benchmark::State& state)
+{
+    mc::MatrixMxN<double,ROWS,COLS> h;
+    mc::MatrixMxN<double,COLS,COLS> p;
+    FillMatrix<ROWS,COLS>(&h, 0.1);
+    FillMatrix<COLS,COLS>(&p, 0.2);
+
+    for ( auto _ : state )
+    {
+        mc::MatrixMxN<double,ROWS,COLS> hp = h * p;
+        benchmark::DoNotOptimize(hp);
+    }
+}
+
+template <unsigned int ROWS, unsigned int COLS>
+void BM_MatrixMxNMultiplyByVector(benchmark::State& state)
+{
+    mc::MatrixMxN<double,ROWS,COLS> m;
+    mc::VectorN<double,COLS> v;
+    FillMatrix<ROWS,COLS>(&m, 0.1);
+    for ( unsigned int i = 0; i < COLS; ++i ) v(i) = std::cos(0.1 * i);
+
+    for ( auto _ : state )
+    {
+        mc::VectorN<double,ROWS> vr = m * v;
+        benchmark::DoNotOptimize(vr);
+    }
+}
+
+} // namespace
+
+// register blocked sizes
+BENCHMARK(BM_MatrixNxNMultiply<3>);
+BENCHMARK(BM_MatrixNxNMultiply<4>);
+BENCHMARK(BM_MatrixNxNMultiply<6>);
+BENCHMARK(BM_MatrixNxNMultiply<12>);
+BENCHMARK(BM_MatrixNxNMultiply<18>);
+
+// cache blocked sizes
+BENCHMARK(BM_MatrixNxNMultiply<64>);
+BENCHMARK(BM_MatrixNxNMultiply<128>);
+BENCHMARK(BM_MatrixNxNMultiply<256>);
+
+BENCHMARK(BM_MatrixNxNCovariance<12>);
+BENCHMARK(BM_MatrixNxNCovariance<18>);
+
+BENCHMARK(BM_MatrixMxNMultiply<6,12>);
+BENCHMARK(BM_MatrixMxNMultiply<6,18>);
+
+BENCHMARK(BM_MatrixMxNMultiplyByVector<12,12>);
+BENCHMARK(BM_MatrixMxNMultiplyByVector<18,18>);
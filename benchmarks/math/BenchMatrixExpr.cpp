@@ -0,0 +1,143 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include <mcutils/math/Matrix.h>
+#include <mcutils/math/MatrixExpr.h>
+#include <mcutils/math/Vector.h>
+#include <mcutils/math/VectorExpr.h>
+
+namespace {
+
+template <unsigned int SIZE>
+void FillMatrix(mc::MatrixMxN<double,SIZE,SIZE>* matrix, double seed)
+{
+    for ( unsigned int r = 0; r < SIZE; ++r )
+    {
+        for ( unsigned int c = 0; c < SIZE; ++c )
+        {
+            (*matrix)(r,c) = std::sin(seed + 0.3 * r + 0.7 * c);
+        }
+    }
+}
+
+template <unsigned int SIZE>
+void FillVector(mc::VectorN<double,SIZE>* vect, double seed)
+{
+    for ( unsigned int i = 0; i < SIZE; ++i )
+    {
+        (*vect)(i) = std::cos(seed + 0.1 * i);
+    }
+}
+
+// state space update, A * x + B * u - c * 2
+template <unsigned int SIZE>
+void BM_StateSpaceOperators(benchmark::State& state)
+{
+    mc::MatrixMxN<double,SIZE,SIZE> a;
+    mc::MatrixMxN<double,SIZE,SIZE> b;
+    mc::VectorN<double,SIZE> x;
+    mc::VectorN<double,SIZE> u;
+    mc::VectorN<double,SIZE> c;
+    FillMatrix(&a, 0.1);
+    FillMatrix(&b, 0.2);
+    FillVector(&x, 0.3);
+    FillVector(&u, 0.4);
+    FillVector(&c, 0.5);
+
+    mc::VectorN<double,SIZE> xr;
+
+    for ( auto _ : state )
+    {
+        xr = a * x + b * u - c * 2.0;
+        benchmark::DoNotOptimize(xr);
+        benchmark::ClobberMemory();
+    }
+}
+
+template <unsigned int SIZE>
+void BM_StateSpaceExpr(benchmark::State& state)
+{
+    mc::MatrixMxN<double,SIZE,SIZE> a;
+    mc::MatrixMxN<double,SIZE,SIZE> b;
+    mc::VectorN<double,SIZE> x;
+    mc::VectorN<double,SIZE> u;
+    mc::VectorN<double,SIZE> c;
+    FillMatrix(&a, 0.1);
+    FillMatrix(&b, 0.2);
+    FillVector(&x, 0.3);
+    FillVector(&u, 0.4);
+    FillVector(&c, 0.5);
+
+    mc::VectorN<double,SIZE> xr;
+
+    for ( auto _ : state )
+    {
+        (mc::MatrixTerm(a) * mc::VectorTerm(x)
+            + mc::MatrixTerm(b) * mc::VectorTerm(u)
+            - mc::VectorTerm(c) * 2.0).AssignTo(&xr);
+        benchmark::DoNotOptimize(xr);
+        benchmark::ClobberMemory();
+    }
+}
+
+// Runge-Kutta stage combination, x + (k1 + k2 * 2 + k3 * 2 + k4) * h / 6
+template <unsigned int SIZE>
+void BM_LinearCombinationOperators(benchmark::State& state)
+{
+    mc::VectorN<double,SIZE> x;
+    mc::VectorN<double,SIZE> k1, k2, k3, k4;
+    FillVector(&x , 0.1);
+    FillVector(&k1, 0.2);
+    FillVector(&k2, 0.3);
+    FillVector(&k3, 0.4);
+    FillVector(&k4, 0.5);
+    const double h = 0.01;
+
+    mc::VectorN<double,SIZE> xr;
+
+    for ( auto _ : state )
+    {
+        xr = x + (k1 + k2 * 2.0 + k3 * 2.0 + k4) * (h / 6.0);
+        benchmark::DoNotOptimize(xr);
+        benchmark::ClobberMemory();
+    }
+}
+
+template <unsigned int SIZE>
+void BM_LinearCombinationExpr(benchmark::State& state)
+{
+    mc::VectorN<double,SIZE> x;
+    mc::VectorN<double,SIZE> k1, k2, k3, k4;
+    FillVector(&x , 0.1);
+    FillVector(&k1, 0.2);
+    FillVector(&k2, 0.3);
+    FillVector(&k3, 0.4);
+    FillVector(&k4, 0.5);
+    const double h = 0.01;
+
+    mc::VectorN<double,SIZE> xr;
+
+    for ( auto _ : state )
+    {
+        (mc::VectorTerm(x)
+            + (mc::VectorTerm(k1) + mc::VectorTerm(k2) * 2.0
+               + mc::VectorTerm(k3) * 2.0 + mc::VectorTerm(k4)) * (h / 6.0)).AssignTo(&xr);
+        benchmark::DoNotOptimize(xr);
+        benchmark::ClobberMemory();
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_StateSpaceOperators<3>);
+BENCHMARK(BM_StateSpaceExpr<3>);
+BENCHMARK(BM_StateSpaceOperators<6>);
+BENCHMARK(BM_StateSpaceExpr<6>);
+BENCHMARK(BM_StateSpaceOperators<12>);
+BENCHMARK(BM_StateSpaceExpr<12>);
+
+BENCHMARK(BM_LinearCombinationOperators<6>);
+BENCHMARK(BM_LinearCombinationExpr<6>);
+BENCHMARK(BM_LinearCombinationOperators<64>);
+BENCHMARK(BM_LinearCombinationExpr<64>);
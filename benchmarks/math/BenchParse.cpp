@@ -0,0 +1,120 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <string>
+
+#include <mcutils/math/Matrix.h>
+#include <mcutils/math/Table.h>
+#include <mcutils/math/Table2.h>
+#include <mcutils/math/Vector.h>
+
+namespace {
+
+// y = x^2 - 1, formatted as in typical aero/engine data files
+std::string CreateTableString(int rows)
+{
+    std::string str;
+    char line[64];
+    for ( int i = 0; i < rows; ++i )
+    {
+        double x = 0.001 * i;
+        std::snprintf(line, sizeof(line), "  %12.6f  %14.8f\n", x, x * x - 1.0);
+        str += line;
+    }
+    return str;
+}
+
+// z = x^2 + y - 1
+std::string CreateTable2String(int rows, int cols)
+{
+    std::string str;
+    char cell[32];
+
+    str += "        ";
+    for ( int c = 0; c < cols; ++c )
+    {
+        std::snprintf(cell, sizeof(cell), "  %9.4f", 0.1 * c);
+        str += cell;
+    }
+    str += "\n";
+
+    for ( int r = 0; r < rows; ++r )
+    {
+        double x = 0.01 * r;
+        std::snprintf(cell, sizeof(cell), "%8.3f", x);
+        str += cell;
+        for ( int c = 0; c < cols; ++c )
+        {
+            std::snprintf(cell, sizeof(cell), "  %9.4f", x * x + 0.1 * c - 1.0);
+            str += cell;
+        }
+        str += "\n";
+    }
+
+    return str;
+}
+
+void BM_ParseTable(benchmark::State& state)
+{
+    std::string str = CreateTableString(static_cast<int>(state.range(0)));
+
+    for ( auto _ : state )
+    {
+        mc::Table<double,double> tab;
+        tab.SetFromString(str.c_str());
+        benchmark::DoNotOptimize(tab.GetLastValue());
+    }
+
+    state.SetBytesProcessed(state.iterations() * str.size());
+}
+
+void BM_ParseTable2(benchmark::State& state)
+{
+    std::string str = CreateTable2String(static_cast<int>(state.range(0)),
+                                         static_cast<int>(state.range(0)));
+
+    for ( auto _ : state )
+    {
+        mc::Table2<double,double,double> tab;
+        tab.SetFromString(str.c_str());
+        benchmark::DoNotOptimize(tab.GetValueByIndex(0, 0));
+    }
+
+    state.SetBytesProcessed(state.iterations() * str.size());
+}
+
+void BM_ParseMatrix6x6(benchmark::State& state)
+{
+    std::string str = CreateTable2String(6, 5);
+
+    for ( auto _ : state )
+    {
+        mc::Matrix6x6d m;
+        m.SetFromString(str.c_str());
+        benchmark::DoNotOptimize(m(5,5));
+    }
+
+    state.SetBytesProcessed(state.iterations() * str.size());
+}
+
+void BM_ParseVector6(benchmark::State& state)
+{
+    std::string str = " 1.0  -2.5  3.25  4.125  -5.0625  6.03125 ";
+
+    for ( auto _ : state )
+    {
+        mc::Vector6d v;
+        v.SetFromString(str.c_str());
+        benchmark::DoNotOptimize(v(5));
+    }
+
+    state.SetBytesProcessed(state.iterations() * str.size());
+}
+
+} // namespace
+
+// 100k rows is approximately 3.2 MB, 1000x1000 table is approximately 11 MB
+BENCHMARK(BM_ParseTable)->Arg(1000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ParseTable2)->Arg(30)->Arg(1000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ParseMatrix6x6);
+BENCHMARK(BM_ParseVector6);
@@ -0,0 +1,383 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <mcutils/math/Table.h>
+#include <mcutils/math/TableExpr.h>
+
+namespace {
+
+mc::Table<double,double> CreateTable(int size)
+{
+    std::vector<double> key_values;
+    std::vector<double> table_data;
+
+    for ( int i = 0; i < size; ++i )
+    {
+        double x = 0.1 * i + 0.01 * (i % 3);
+        key_values.push_back(x);
+        table_data.push_back(x * x - 1.0);
+    }
+
+    return mc::Table<double,double>(key_values, table_data);
+}
+
+mc::Table<double,double> CreateTableUniform(int size)
+{
+    std::vector<double> key_values;
+    std::vector<double> table_data;
+
+    for ( int i = 0; i < size; ++i )
+    {
+        double x = 0.1 * i;
+        key_values.push_back(x);
+        table_data.push_back(x * x - 1.0);
+    }
+
+    return mc::Table<double,double>(key_values, table_data);
+}
+
+std::vector<double> CreateKeysSequential(const mc::Table<double,double>& tab, int count)
+{
+    std::vector<double> keys;
+    double x_min = tab.GetKeyByIndex(0);
+    double x_max = tab.GetKeyByIndex(tab.size() - 1);
+    for ( int i = 0; i < count; ++i )
+    {
+        keys.push_back(x_min + (x_max - x_min) * i / count);
+    }
+    return keys;
+}
+
+std::vector<double> CreateKeysRandom(const mc::Table<double,double>& tab, int count)
+{
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<double> dist(tab.GetKeyByIndex(0),
+                                                tab.GetKeyByIndex(tab.size() - 1));
+    std::vector<double> keys;
+    for ( int i = 0; i < count; ++i )
+    {
+        keys.push_back(dist(gen));
+    }
+    return keys;
+}
+
+// slowly varying input with occasional jumps (resets, trims, restarts)
+std::vector<double> CreateKeysJumping(const mc::Table<double,double>& tab, int count)
+{
+    std::mt19937 gen(1);
+    double x_min = tab.GetKeyByIndex(0);
+    double x_max = tab.GetKeyByIndex(tab.size() - 1);
+    std::uniform_real_distribution<double> dist(x_min, x_max);
+    std::vector<double> keys;
+    double x = x_min;
+    for ( int i = 0; i < count; ++i )
+    {
+        x = ( i % 100 == 0 ) ? dist(gen) : std::min(x + 0.001, x_max);
+        keys.push_back(x);
+    }
+    return keys;
+}
+
+template <std::vector<double>(*CREATE_KEYS)(const mc::Table<double,double>&, int)>
+void BM_TableGetValue(benchmark::State& state)
+{
+    mc::Table<double,double> tab = CreateTable(static_cast<int>(state.range(0)));
+    std::vector<double> keys = CREATE_KEYS(tab, 4096);
+
+    for ( auto _ : state )
+    {
+        for ( double key : keys )
+        {
+            benchmark::DoNotOptimize(tab.GetValue(key));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+template <std::vector<double>(*CREATE_KEYS)(const mc::Table<double,double>&, int)>
+void BM_TableGetValuesLoop(benchmark::State& state)
+{
+    mc::Table<double,double> tab = CreateTable(static_cast<int>(state.range(0)));
+    std::vector<double> keys = CREATE_KEYS(tab, 4096);
+    std::vector<double> values(keys.size());
+
+    for ( auto _ : state )
+    {
+        mc::TableCursor cursor;
+        for ( unsigned int i = 0; i < keys.size(); ++i )
+        {
+            values[i] = tab.GetValue(keys[i], &cursor);
+        }
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+template <std::vector<double>(*CREATE_KEYS)(const mc::Table<double,double>&, int)>
+void BM_TableGetValuesBatch(benchmark::State& state)
+{
+    mc::Table<double,double> tab = CreateTable(static_cast<int>(state.range(0)));
+    std::vector<double> keys = CREATE_KEYS(tab, 4096);
+    std::vector<double> values(keys.size());
+
+    for ( auto _ : state )
+    {
+        tab.GetValues(keys.data(), values.data(), static_cast<unsigned int>(keys.size()));
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+template <std::vector<double>(*CREATE_KEYS)(const mc::Table<double,double>&, int)>
+void BM_TableGetValueUniform(benchmark::State& state)
+{
+    mc::Table<double,double> tab = CreateTableUniform(static_cast<int>(state.range(0)));
+    std::vector<double> keys = CREATE_KEYS(tab, 4096);
+
+    for ( auto _ : state )
+    {
+        for ( double key : keys )
+        {
+            benchmark::DoNotOptimize(tab.GetValue(key));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+template <mc::TableInterpolation INTERPOLATION>
+void BM_TableGetValueInterpolation(benchmark::State& state)
+{
+    mc::Table<double,double> tab = CreateTable(static_cast<int>(state.range(0)));
+    tab.SetInterpolation(INTERPOLATION);
+    std::vector<double> keys = CreateKeysRandom(tab, 4096);
+
+    for ( auto _ : state )
+    {
+        for ( double key : keys )
+        {
+            benchmark::DoNotOptimize(tab.GetValue(key));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+void BM_TableSetFromString(benchmark::State& state)
+{
+    std::string str = CreateTable(static_cast<int>(state.range(0))).ToString();
+
+    for ( auto _ : state )
+    {
+        mc::Table<double,double> tab;
+        tab.SetFromString(str.c_str());
+        benchmark::DoNotOptimize(tab.GetFirstValue());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_TableSetFromBinary(benchmark::State& state)
+{
+    std::vector<char> bin = CreateTable(static_cast<int>(state.range(0))).ToBinary();
+
+    for ( auto _ : state )
+    {
+        mc::Table<double,double> tab;
+        tab.SetFromBinary(bin.data(), bin.size());
+        benchmark::DoNotOptimize(tab.GetFirstValue());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_TableWrapBinary(benchmark::State& state)
+{
+    std::vector<char> bin = CreateTable(static_cast<int>(state.range(0))).ToBinary();
+
+    for ( auto _ : state )
+    {
+        mc::Table<double,double> tab;
+        tab.WrapBinary(bin.data(), bin.size());
+        benchmark::DoNotOptimize(tab.GetFirstValue());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_TableGetKeyOfValueMaxRanged(benchmark::State& state)
+{
+    const int size = static_cast<int>(state.range(0));
+    mc::Table<double,double> tab = CreateTable(size);
+
+    // sliding window of a quarter of the table
+    std::vector<double> keys = CreateKeysRandom(tab, 1024);
+    const double width = 0.25 * (tab.GetKeyByIndex(size - 1) - tab.GetKeyByIndex(0));
+
+    unsigned int i = 0;
+    for ( auto _ : state )
+    {
+        double key = keys[i++ % keys.size()];
+        benchmark::DoNotOptimize(tab.GetKeyOfValueMax(key, key + width));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_TableAdd(benchmark::State& state)
+{
+    const int size = static_cast<int>(state.range(0));
+    mc::Table<double,double> tab1 = CreateTable(size);
+    mc::Table<double,double> tab2 = CreateTableUniform(size);
+
+    for ( auto _ : state )
+    {
+        mc::Table<double,double> tab = tab1 + tab2;
+        benchmark::DoNotOptimize(tab.GetFirstValue());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_TableBuildUpEager(benchmark::State& state)
+{
+    // same keys, so both methods result in the same table
+    const int size = static_cast<int>(state.range(0));
+    mc::Table<double,double> tab1 = CreateTable(size);
+    mc::Table<double,double> tab2 = CreateTable(size);
+    mc::Table<double,double> tab3 = CreateTable(size);
+
+    for ( auto _ : state )
+    {
+        mc::Table<double,double> tab = tab1 + tab2 * 0.5 + tab3;
+        benchmark::DoNotOptimize(tab.GetFirstValue());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_TableBuildUpExpr(benchmark::State& state)
+{
+    // same keys, so both methods result in the same table
+    const int size = static_cast<int>(state.range(0));
+    mc::Table<double,double> tab1 = CreateTable(size);
+    mc::Table<double,double> tab2 = CreateTable(size);
+    mc::Table<double,double> tab3 = CreateTable(size);
+
+    for ( auto _ : state )
+    {
+        mc::Table<double,double> tab = mc::TableTerm(tab1) + mc::TableTerm(tab2) * 0.5 + mc::TableTerm(tab3);
+        benchmark::DoNotOptimize(tab.GetFirstValue());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_TableCopy(benchmark::State& state)
+{
+    mc::Table<double,double> tab0 = CreateTable(static_cast<int>(state.range(0)));
+
+    for ( auto _ : state )
+    {
+        mc::Table<double,double> tab(tab0);
+        benchmark::DoNotOptimize(tab.GetFirstValue());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_TableCopyAndModify(benchmark::State& state)
+{
+    mc::Table<double,double> tab0 = CreateTable(static_cast<int>(state.range(0)));
+
+    for ( auto _ : state )
+    {
+        mc::Table<double,double> tab(tab0);
+        tab.MultiplyValues(2.0);
+        benchmark::DoNotOptimize(tab.GetFirstValue());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// storage precision, throughput and maximum relative error with respect to the double table
+template <typename TYPE>
+void BM_TableGetValuePrecision(benchmark::State& state)
+{
+    mc::Table<double,double> tab0 = CreateTable(static_cast<int>(state.range(0)));
+    std::vector<double> keys = CreateKeysRandom(tab0, 4096);
+
+    std::vector<TYPE> key_values;
+    std::vector<TYPE> table_data;
+    for ( unsigned int i = 0; i < tab0.size(); ++i )
+    {
+        key_values.push_back(static_cast<TYPE>(tab0.GetKeyByIndex(i)));
+        table_data.push_back(static_cast<TYPE>(tab0.GetValueByIndex(i)));
+    }
+    mc::Table<TYPE,TYPE> tab(key_values, table_data);
+
+    std::vector<TYPE> keys_typed(keys.begin(), keys.end());
+
+    for ( auto _ : state )
+    {
+        for ( TYPE key : keys_typed )
+        {
+            benchmark::DoNotOptimize(tab.GetValue(key));
+        }
+    }
+
+    double max_error = 0.0;
+    for ( double key : keys )
+    {
+        double value = tab0.GetValue(key);
+        double error = std::fabs(static_cast<double>(tab.GetValue(static_cast<TYPE>(key))) - value);
+        max_error = std::max(max_error, error / std::max(std::fabs(value), 1.0));
+    }
+
+    state.counters["max_error"] = max_error;
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+} // namespace
+
+BENCHMARK(BM_TableGetValue<CreateKeysSequential>)->Name("BM_TableGetValue/Sequential")->RangeMultiplier(8)->Range(8, 2048);
+BENCHMARK(BM_TableGetValue<CreateKeysRandom>)->Name("BM_TableGetValue/Random")->RangeMultiplier(8)->Range(8, 2048);
+BENCHMARK(BM_TableGetValue<CreateKeysJumping>)->Name("BM_TableGetValue/Jumping")->RangeMultiplier(8)->Range(8, 2048);
+
+// tables exceeding L1 and L2 caches
+BENCHMARK(BM_TableGetValue<CreateKeysRandom>)->Name("BM_TableGetValueLarge/Random")->RangeMultiplier(8)->Range(1 << 12, 1 << 21);
+BENCHMARK(BM_TableGetValuesBatch<CreateKeysRandom>)->Name("BM_TableGetValuesLarge/Random")->RangeMultiplier(8)->Range(1 << 12, 1 << 21);
+BENCHMARK(BM_TableGetValuePrecision<double>)->Name("BM_TableGetValuePrecision/double")->RangeMultiplier(64)->Range(1 << 9, 1 << 21);
+BENCHMARK(BM_TableGetValuePrecision<float>)->Name("BM_TableGetValuePrecision/float")->RangeMultiplier(64)->Range(1 << 9, 1 << 21);
+BENCHMARK(BM_TableGetValueUniform<CreateKeysRandom>)->Name("BM_TableGetValueUniform/Random")->RangeMultiplier(8)->Range(8, 2048);
+BENCHMARK(BM_TableGetValueUniform<CreateKeysJumping>)->Name("BM_TableGetValueUniform/Jumping")->RangeMultiplier(8)->Range(8, 2048);
+
+BENCHMARK(BM_TableGetValueInterpolation<mc::TableInterpolation::Linear>)->Name("BM_TableGetValueInterpolation/Linear")->RangeMultiplier(8)->Range(8, 2048);
+BENCHMARK(BM_TableGetValueInterpolation<mc::TableInterpolation::MonotoneCubic>)->Name("BM_TableGetValueInterpolation/MonotoneCubic")->RangeMultiplier(8)->Range(8, 2048);
+BENCHMARK(BM_TableGetValueInterpolation<mc::TableInterpolation::Akima>)->Name("BM_TableGetValueInterpolation/Akima")->RangeMultiplier(8)->Range(8, 2048);
+
+BENCHMARK(BM_TableGetValuesLoop<CreateKeysSequential>)->Name("BM_TableGetValuesLoop/Sequential")->RangeMultiplier(8)->Range(8, 2048);
+BENCHMARK(BM_TableGetValuesLoop<CreateKeysRandom>)->Name("BM_TableGetValuesLoop/Random")->RangeMultiplier(8)->Range(8, 2048);
+BENCHMARK(BM_TableGetValuesBatch<CreateKeysSequential>)->Name("BM_TableGetValuesBatch/Sequential")->RangeMultiplier(8)->Range(8, 2048);
+BENCHMARK(BM_TableGetValuesBatch<CreateKeysRandom>)->Name("BM_TableGetValuesBatch/Random")->RangeMultiplier(8)->Range(8, 2048);
+
+BENCHMARK(BM_TableSetFromString)->RangeMultiplier(8)->Range(8, 2048);
+BENCHMARK(BM_TableSetFromBinary)->RangeMultiplier(8)->Range(8, 2048);
+BENCHMARK(BM_TableWrapBinary)->RangeMultiplier(8)->Range(8, 2048);
+
+BENCHMARK(BM_TableGetKeyOfValueMaxRanged)->RangeMultiplier(8)->Range(8, 2048);
+
+BENCHMARK(BM_TableAdd)->RangeMultiplier(8)->Range(8, 2048);
+BENCHMARK(BM_TableBuildUpEager)->RangeMultiplier(8)->Range(8, 2048);
+BENCHMARK(BM_TableBuildUpExpr)->RangeMultiplier(8)->Range(8, 2048);
+
+BENCHMARK(BM_TableCopy)->RangeMultiplier(8)->Range(8, 2048);
+BENCHMARK(BM_TableCopyAndModify)->RangeMultiplier(8)->Range(8, 2048);
@@ -0,0 +1,206 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <mcutils/math/Table2.h>
+
+namespace {
+
+// z = x^2 + y - 1, not equally spaced keys
+mc::Table2<double,double,double> CreateTable2(int rows, int cols)
+{
+    std::vector<double> row_values;
+    std::vector<double> col_values;
+    std::vector<double> table_data;
+
+    for ( int i = 0; i < rows; ++i ) row_values.push_back(0.1 * i + 0.01 * (i % 3));
+    for ( int j = 0; j < cols; ++j ) col_values.push_back(0.2 * j + 0.02 * (j % 2));
+
+    for ( int i = 0; i < rows; ++i )
+    {
+        for ( int j = 0; j < cols; ++j )
+        {
+            table_data.push_back(row_values[i] * row_values[i] + col_values[j] - 1.0);
+        }
+    }
+
+    return mc::Table2<double,double,double>(row_values, col_values, table_data);
+}
+
+using Keys = std::vector<std::pair<double,double>>;
+
+// slowly varying input, e.g. Mach number and angle of attack during flight
+Keys CreateKeysSequential(int rows, int cols, int count)
+{
+    Keys keys;
+    const double x_max = 0.1 * (rows - 1);
+    const double y_max = 0.2 * (cols - 1);
+    for ( int i = 0; i < count; ++i )
+    {
+        double t = static_cast<double>(i) / count;
+        keys.emplace_back(x_max * t, y_max * (0.5 + 0.45 * std::sin(20.0 * t)));
+    }
+    return keys;
+}
+
+// random input, including out of range keys
+Keys CreateKeysRandom(int rows, int cols, int count)
+{
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<double> dist_x(-0.5, 0.1 * rows + 0.5);
+    std::uniform_real_distribution<double> dist_y(-0.5, 0.2 * cols + 0.5);
+    Keys keys;
+    for ( int i = 0; i < count; ++i )
+    {
+        keys.emplace_back(dist_x(gen), dist_y(gen));
+    }
+    return keys;
+}
+
+template <Keys(*CREATE_KEYS)(int, int, int)>
+void BM_Table2GetValue(benchmark::State& state)
+{
+    const int rows = static_cast<int>(state.range(0));
+    const int cols = static_cast<int>(state.range(1));
+    mc::Table2<double,double,double> tab = CreateTable2(rows, cols);
+    Keys keys = CREATE_KEYS(rows, cols, 4096);
+
+    for ( auto _ : state )
+    {
+        for ( const auto& key : keys )
+        {
+            benchmark::DoNotOptimize(tab.GetValue(key.first, key.second));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+template <Keys(*CREATE_KEYS)(int, int, int)>
+void BM_Table2GetValueStateless(benchmark::State& state)
+{
+    const int rows = static_cast<int>(state.range(0));
+    const int cols = static_cast<int>(state.range(1));
+    mc::Table2<double,double,double> tab = CreateTable2(rows, cols);
+    Keys keys = CREATE_KEYS(rows, cols, 4096);
+
+    for ( auto _ : state )
+    {
+        for ( const auto& key : keys )
+        {
+            benchmark::DoNotOptimize(tab.GetValueStateless(key.first, key.second));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+// storage precision, throughput and maximum relative error with respect to the double table
+template <typename TYPE>
+void BM_Table2GetValuePrecision(benchmark::State& state)
+{
+    const int rows = static_cast<int>(state.range(0));
+    const int cols = static_cast<int>(state.range(1));
+    mc::Table2<double,double,double> tab0 = CreateTable2(rows, cols);
+    Keys keys = CreateKeysRandom(rows, cols, 4096);
+
+    std::vector<TYPE> row_values;
+    std::vector<TYPE> col_values;
+    std::vector<TYPE> table_data;
+    for ( int i = 0; i < rows; ++i ) row_values.push_back(static_cast<TYPE>(tab0.GetRowKeyByIndex(i)));
+    for ( int j = 0; j < cols; ++j ) col_values.push_back(static_cast<TYPE>(tab0.GetColKeyByIndex(j)));
+    for ( int i = 0; i < rows; ++i )
+    {
+        for ( int j = 0; j < cols; ++j )
+        {
+            table_data.push_back(static_cast<TYPE>(tab0.GetValueByIndex(i, j)));
+        }
+    }
+    mc::Table2<TYPE,TYPE,TYPE> tab(row_values, col_values, table_data);
+
+    std::vector<std::pair<TYPE,TYPE>> keys_typed;
+    for ( const auto& key : keys ) keys_typed.emplace_back(static_cast<TYPE>(key.first), static_cast<TYPE>(key.second));
+
+    for ( auto _ : state )
+    {
+        for ( const auto& key : keys_typed )
+        {
+            benchmark::DoNotOptimize(tab.GetValue(key.first, key.second));
+        }
+    }
+
+    double max_error = 0.0;
+    for ( const auto& key : keys )
+    {
+        double value = tab0.GetValue(key.first, key.second);
+        double error = std::fabs(static_cast<double>(tab.GetValue(static_cast<TYPE>(key.first), static_cast<TYPE>(key.second))) - value);
+        max_error = std::max(max_error, error / std::max(std::fabs(value), 1.0));
+    }
+
+    state.counters["max_error"] = max_error;
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+// gain scheduling, 1-dimensional table for slowly varying column key
+void BM_Table2GetTable(benchmark::State& state)
+{
+    const int rows = static_cast<int>(state.range(0));
+    const int cols = static_cast<int>(state.range(1));
+    mc::Table2<double,double,double> tab = CreateTable2(rows, cols);
+    const double y_max = 0.2 * (cols - 1);
+    int i = 0;
+
+    for ( auto _ : state )
+    {
+        double y = y_max * (0.5 + 0.45 * std::sin(0.01 * (i++)));
+        mc::Table<double,double> tab1 = tab.GetTable(y);
+        benchmark::DoNotOptimize(tab1.GetValue(0.3));
+    }
+}
+
+void BM_Table2GetSlice(benchmark::State& state)
+{
+    const int rows = static_cast<int>(state.range(0));
+    const int cols = static_cast<int>(state.range(1));
+    mc::Table2<double,double,double> tab = CreateTable2(rows, cols);
+    const double y_max = 0.2 * (cols - 1);
+    int i = 0;
+
+    for ( auto _ : state )
+    {
+        double y = y_max * (0.5 + 0.45 * std::sin(0.01 * (i++)));
+        mc::Table2Slice<double,double,double> slice = tab.GetSlice(y);
+        benchmark::DoNotOptimize(slice.GetValue(0.3));
+    }
+}
+
+// the same column key in every iteration
+void BM_Table2GetTableCached(benchmark::State& state)
+{
+    const int rows = static_cast<int>(state.range(0));
+    const int cols = static_cast<int>(state.range(1));
+    mc::Table2<double,double,double> tab = CreateTable2(rows, cols);
+    mc::Table2SliceCache<double,double,double> cache;
+    const double y = 0.1 * (cols - 1);
+
+    for ( auto _ : state )
+    {
+        benchmark::DoNotOptimize(tab.GetTable(y, &cache).GetValue(0.3));
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_Table2GetValue<CreateKeysSequential>)->Name("BM_Table2GetValue/Sequential")->Args({10, 8})->Args({100, 80});
+BENCHMARK(BM_Table2GetValue<CreateKeysRandom>)->Name("BM_Table2GetValue/Random")->Args({10, 8})->Args({100, 80});
+BENCHMARK(BM_Table2GetValueStateless<CreateKeysSequential>)->Name("BM_Table2GetValueStateless/Sequential")->Args({10, 8})->Args({100, 80});
+BENCHMARK(BM_Table2GetValueStateless<CreateKeysRandom>)->Name("BM_Table2GetValueStateless/Random")->Args({10, 8})->Args({100, 80});
+BENCHMARK(BM_Table2GetTable)->Args({10, 8})->Args({100, 80});
+BENCHMARK(BM_Table2GetSlice)->Args({10, 8})->Args({100, 80});
+BENCHMARK(BM_Table2GetTableCached)->Args({10, 8})->Args({100, 80});
+BENCHMARK(BM_Table2GetValuePrecision<double>)->Name("BM_Table2GetValuePrecision/double")->Args({100, 80})->Args({2000, 1000});
+BENCHMARK(BM_Table2GetValuePrecision<float>)->Name("BM_Table2GetValuePrecision/float")->Args({100, 80})->Args({2000, 1000});
@@ -0,0 +1,115 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <mcutils/math/TableN.h>
+
+namespace {
+
+// f = sum of squares of keys, every other axis equally spaced
+template <unsigned int N>
+mc::TableN<N,double> CreateTableN(int size)
+{
+    std::array<std::vector<double>, N> keys;
+
+    for ( unsigned int a = 0; a < N; ++a )
+    {
+        for ( int i = 0; i < size; ++i )
+        {
+            keys[a].push_back(a % 2 == 0 ? 0.1 * i : 0.1 * i + 0.01 * (i % 3));
+        }
+    }
+
+    std::vector<double> table_data;
+    std::array<int, N> index {};
+    for ( ;; )
+    {
+        double value = 0.0;
+        for ( unsigned int a = 0; a < N; ++a ) value += keys[a][index[a]] * keys[a][index[a]];
+        table_data.push_back(value);
+
+        unsigned int a = N;
+        while ( a > 0 && ++index[a - 1] == size ) index[--a] = 0;
+        if ( a == 0 ) break;
+    }
+
+    return mc::TableN<N,double>(keys, table_data);
+}
+
+// slowly varying input
+template <unsigned int N>
+std::vector<std::array<double,N>> CreateKeysSequential(int size, int count)
+{
+    std::vector<std::array<double,N>> keys(count);
+    const double k_max = 0.1 * (size - 1);
+    for ( int i = 0; i < count; ++i )
+    {
+        double t = static_cast<double>(i) / count;
+        for ( unsigned int a = 0; a < N; ++a )
+        {
+            keys[i][a] = k_max * (0.5 + 0.45 * std::sin((5.0 + 3.0 * a) * t));
+        }
+    }
+    return keys;
+}
+
+// random input, including out of range keys
+template <unsigned int N>
+std::vector<std::array<double,N>> CreateKeysRandom(int size, int count)
+{
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<double> dist(-0.5, 0.1 * size + 0.5);
+    std::vector<std::array<double,N>> keys(count);
+    for ( int i = 0; i < count; ++i )
+    {
+        for ( unsigned int a = 0; a < N; ++a ) keys[i][a] = dist(gen);
+    }
+    return keys;
+}
+
+template <unsigned int N, bool RANDOM>
+void BM_TableNGetValue(benchmark::State& state)
+{
+    const int size = static_cast<int>(state.range(0));
+    mc::TableN<N,double> tab = CreateTableN<N>(size);
+    auto keys = RANDOM ? CreateKeysRandom<N>(size, 4096) : CreateKeysSequential<N>(size, 4096);
+
+    for ( auto _ : state )
+    {
+        for ( const auto& key : keys )
+        {
+            benchmark::DoNotOptimize(tab.GetValue(key));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+template <unsigned int N, bool RANDOM>
+void BM_TableNGetValues(benchmark::State& state)
+{
+    const int size = static_cast<int>(state.range(0));
+    mc::TableN<N,double> tab = CreateTableN<N>(size);
+    auto keys = RANDOM ? CreateKeysRandom<N>(size, 4096) : CreateKeysSequential<N>(size, 4096);
+    std::vector<double> values(keys.size());
+
+    for ( auto _ : state )
+    {
+        tab.GetValues(keys.data(), values.data(), static_cast<unsigned int>(keys.size()));
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+} // namespace
+
+BENCHMARK(BM_TableNGetValue<3,false>)->Name("BM_TableN3GetValue/Sequential")->Arg(10)->Arg(40);
+BENCHMARK(BM_TableNGetValue<3,true>)->Name("BM_TableN3GetValue/Random")->Arg(10)->Arg(40);
+BENCHMARK(BM_TableNGetValues<3,false>)->Name("BM_TableN3GetValues/Sequential")->Arg(10)->Arg(40);
+BENCHMARK(BM_TableNGetValue<4,false>)->Name("BM_TableN4GetValue/Sequential")->Arg(10)->Arg(20);
+BENCHMARK(BM_TableNGetValue<4,true>)->Name("BM_TableN4GetValue/Random")->Arg(10)->Arg(20);
+BENCHMARK(BM_TableNGetValues<4,false>)->Name("BM_TableN4GetValues/Sequential")->Arg(10)->Arg(20);
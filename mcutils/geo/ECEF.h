@@ -60,8 +60,8 @@ class ECEF
 {
 public:
 
-    static const RMatrix _enu2ned;  ///< matrix of rotation from ENU to NED
-    static const RMatrix _ned2enu;  ///< matrix of rotation from NED to ENU
+    static constexpr RMatrix _enu2ned { 0.0, 1.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, -1.0 };  ///< matrix of rotation from ENU to NED
+    static constexpr RMatrix _ned2enu { 0.0, 1.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, -1.0 };  ///< matrix of rotation from NED to ENU
 
     /**
      * \brief Constructor.
@@ -435,12 +435,6 @@ protected:
     }
 };
 
-//0.0,  1.0,  0.0
-//1.0,  0.0,  0.0
-//0.0,  0.0, -1.0
-const RMatrix ECEF::_enu2ned( 0.0, 1.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, -1.0 );
-const RMatrix ECEF::_ned2enu( 0.0, 1.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, -1.0 );
-
 } // namespace mc
 
 #endif // MCUTILS_GEO_ECEF_H_
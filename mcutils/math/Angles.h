@@ -71,9 +71,9 @@ public:
      * \param tht angle of rotation about y-axis
      * \param psi angle of rotation about z-axis
      */
-    explicit Angles(units::angle::radian_t phi = 0.0_rad,
-                    units::angle::radian_t tht = 0.0_rad,
-                    units::angle::radian_t psi = 0.0_rad)
+    constexpr explicit Angles(units::angle::radian_t phi = 0.0_rad,
+                              units::angle::radian_t tht = 0.0_rad,
+                              units::angle::radian_t psi = 0.0_rad)
     {
         Set(phi, tht, psi);
     }
@@ -119,9 +119,9 @@ public:
      * \param tht angle of rotation about y-axis
      * \param psi angle of rotation about z-axis
      */
-    void Set(units::angle::radian_t phi,
-             units::angle::radian_t tht,
-             units::angle::radian_t psi)
+    constexpr void Set(units::angle::radian_t phi,
+                       units::angle::radian_t tht,
+                       units::angle::radian_t psi)
     {
         _phi = phi;
         _tht = tht;
@@ -145,12 +145,12 @@ public:
         return ss.str();
     }
 
-    inline units::angle::radian_t  phi() const { return _phi; }
-    inline units::angle::radian_t  tht() const { return _tht; }
-    inline units::angle::radian_t  psi() const { return _psi; }
-    inline units::angle::radian_t& phi()       { return _phi; }
-    inline units::angle::radian_t& tht()       { return _tht; }
-    inline units::angle::radian_t& psi()       { return _psi; }
+    constexpr units::angle::radian_t  phi() const { return _phi; }
+    constexpr units::angle::radian_t  tht() const { return _tht; }
+    constexpr units::angle::radian_t  psi() const { return _psi; }
+    constexpr units::angle::radian_t& phi()       { return _phi; }
+    constexpr units::angle::radian_t& tht()       { return _tht; }
+    constexpr units::angle::radian_t& psi()       { return _psi; }
 
     /** \brief Equality operator. */
     bool operator==(const Angles& angl) const
@@ -0,0 +1,243 @@
+/****************************************************************************//*
+ * Copyright (C) 2026 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_BANDLU_H_
+#define MCUTILS_MATH_BANDLU_H_
+
+#include <cmath>
+#include <utility>
+
+#include <mcutils/Result.h>
+
+#include <mcutils/math/BandMatrix.h>
+#include <mcutils/math/Vector.h>
+
+namespace mc {
+
+/**
+ * \brief LU factorization of band matrix with partial pivoting.
+ *
+ * Factorization and solve take O(n*KL*(KL+KU)) and O(n*(2KL+KU)) time
+ * respectively, compared to O(n^3) and O(n^2) of dense LU. Row interchanges
+ * widen the upper band of U to KL+KU, so factors are stored the same way
+ * as BandMatrix elements, with wider upper band. Multipliers of L are
+ * stored in place of eliminated elements and are not permuted by
+ * subsequent row interchanges, therefore interchanges are applied to the
+ * right hand side one by one during forward substitution.
+ *
+ * \tparam TYPE matrix element type
+ * \tparam SIZE matrix size
+ * \tparam KL number of subdiagonals
+ * \tparam KU number of superdiagonals
+ *
+ * ### Refernces:
+ * - Golub G., Van Loan C.: Matrix Computations, 2013, p.178
+ * - [LAPACK dgbtrf](https://netlib.org/lapack/explore-html/)
+ */
+template <typename TYPE, unsigned int SIZE, unsigned int KL, unsigned int KU>
+class BandLU
+{
+public:
+
+    static constexpr unsigned int kUpperLU = KL + KU;           ///< number of superdiagonals of U
+    static constexpr unsigned int kWidth   = KL + kUpperLU + 1; ///< factors band width
+
+    /** \brief Constructor. */
+    BandLU() = default;
+
+    /**
+     * \brief Constructor, factorizes the given matrix.
+     * \param mtr matrix to be factorized
+     * \param eps minimum value treated as not-zero pivot
+     */
+    explicit BandLU(const BandMatrix<TYPE, SIZE, KL, KU>& mtr, double eps = 1.0e-9)
+    {
+        Factorize(mtr, eps);
+    }
+
+    /**
+     * \brief Factorizes the given matrix, replacing previous factors.
+     * \param mtr matrix to be factorized
+     * \param eps minimum value treated as not-zero pivot
+     * \return mc::Result::Success on success and mc::Result::Failure if matrix is singular
+     */
+    Result Factorize(const BandMatrix<TYPE, SIZE, KL, KU>& mtr, double eps = 1.0e-9)
+    {
+        _sign = 1;
+        _valid = false;
+
+        for (unsigned int r = 0; r < SIZE; ++r)
+        {
+            for (unsigned int i = 0; i < kWidth; ++i)
+            {
+                _lu[r * kWidth + i] = TYPE{0};
+            }
+
+            const TYPE* row = mtr.data() + r * BandMatrix<TYPE, SIZE, KL, KU>::kWidth;
+            for (unsigned int i = 0; i < KL + KU + 1; ++i)
+            {
+                _lu[r * kWidth + i] = row[i];
+            }
+        }
+
+        for (unsigned int k = 0; k < SIZE; ++k)
+        {
+            unsigned int i_max = k + KL < SIZE ? k + KL : SIZE - 1;
+            unsigned int c_max = k + kUpperLU < SIZE ? k + kUpperLU : SIZE - 1;
+
+            // searching for the pivot within the lower band
+            unsigned int p = k;
+            double p_abs = fabs(Element(k,k));
+            for (unsigned int i = k + 1; i <= i_max; ++i)
+            {
+                double a_abs = fabs(Element(i,k));
+                if (a_abs > p_abs)
+                {
+                    p = i;
+                    p_abs = a_abs;
+                }
+            }
+
+            _piv[k] = p;
+
+            if (p_abs < fabs(eps))
+            {
+                return Result::Failure;
+            }
+
+            if (p != k)
+            {
+                for (unsigned int c = k; c <= c_max; ++c)
+                {
+                    std::swap(Element(k,c), Element(p,c));
+                }
+                _sign = -_sign;
+            }
+
+            // eliminating elements below the pivot, multipliers are stored in their place
+            double a_kk_inv = 1.0 / Element(k,k);
+            for (unsigned int i = k + 1; i <= i_max; ++i)
+            {
+                double l_ik = Element(i,k) * a_kk_inv;
+                Element(i,k) = l_ik;
+                for (unsigned int c = k + 1; c <= c_max; ++c)
+                {
+                    Element(i,c) -= l_ik * Element(k,c);
+                }
+            }
+        }
+
+        _valid = true;
+
+        return Result::Success;
+    }
+
+    /**
+     * \brief Solves system of linear equations using stored factors.
+     * \param rhs right hand side vector
+     * \param x result vector, may be the right hand side vector
+     * \return mc::Result::Success on success and mc::Result::Failure if there are no valid factors
+     */
+    Result Solve(const VectorN<TYPE, SIZE>& rhs, VectorN<TYPE, SIZE>* x) const
+    {
+        if (!_valid)
+        {
+            return Result::Failure;
+        }
+
+        *x = rhs;
+
+        // forward substitution, interchanges applied one by one
+        for (unsigned int k = 0; k < SIZE; ++k)
+        {
+            if (_piv[k] != k)
+            {
+                x->SwapRows(k, _piv[k]);
+            }
+
+            unsigned int i_max = k + KL < SIZE ? k + KL : SIZE - 1;
+            for (unsigned int i = k + 1; i <= i_max; ++i)
+            {
+                (*x)(i) -= Element(i,k) * (*x)(k);
+            }
+        }
+
+        // back substitution
+        for (unsigned int i = SIZE; i-- > 0;)
+        {
+            unsigned int c_max = i + kUpperLU < SIZE ? i + kUpperLU : SIZE - 1;
+
+            TYPE sum = (*x)(i);
+            for (unsigned int c = i + 1; c <= c_max; ++c)
+            {
+                sum -= Element(i,c) * (*x)(c);
+            }
+            (*x)(i) = sum / Element(i,i);
+        }
+
+        return Result::Success;
+    }
+
+    /**
+     * \brief Returns determinant calculated from stored factors.
+     * \return determinant, zero if matrix is singular
+     */
+    double GetDeterminant() const
+    {
+        if (!_valid)
+        {
+            return 0.0;
+        }
+
+        double det = _sign;
+        for (unsigned int i = 0; i < SIZE; ++i)
+        {
+            det *= Element(i,i);
+        }
+        return det;
+    }
+
+    /** \return true if factors are valid, false if matrix is singular or was not factorized */
+    inline bool IsValid() const { return _valid; }
+
+private:
+
+    TYPE _lu[SIZE * kWidth] = { 0 };    ///< combined factors, stored the same way as BandMatrix elements
+    unsigned int _piv[SIZE] = { 0 };    ///< row interchanged with the given row at each step
+    int _sign = 1;                      ///< permutation sign
+    bool _valid = false;                ///< specifies if factors are valid
+
+    /** \brief Factors element accessor, element must be within the factors band. */
+    inline TYPE Element(unsigned int row, unsigned int col) const
+    {
+        return _lu[row * kWidth + col + KL - row];
+    }
+
+    /** \brief Factors element accessor, element must be within the factors band. */
+    inline TYPE& Element(unsigned int row, unsigned int col)
+    {
+        return _lu[row * kWidth + col + KL - row];
+    }
+};
+
+} // namespace mc
+
+#endif // MCUTILS_MATH_BANDLU_H_
@@ -0,0 +1,148 @@
+/****************************************************************************//*
+ * Copyright (C) 2026 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_BANDMATRIX_H_
+#define MCUTILS_MATH_BANDMATRIX_H_
+
+#include <cassert>
+#include <limits>
+
+#include <mcutils/math/Vector.h>
+#include <mcutils/misc/Check.h>
+
+namespace mc {
+
+/**
+ * \brief Square band matrix class template.
+ *
+ * Stores only elements within the band, row by row, so that memory is
+ * O(n*(KL+KU+1)) instead of O(n^2). Element (r,c) is stored at
+ * r*kWidth + c - r + KL. Elements outside the band are zero.
+ *
+ * \tparam TYPE matrix element type
+ * \tparam SIZE matrix size
+ * \tparam KL number of subdiagonals
+ * \tparam KU number of superdiagonals
+ */
+template <typename TYPE, unsigned int SIZE, unsigned int KL, unsigned int KU>
+class BandMatrix
+{
+public:
+
+    static constexpr unsigned int kSize  = SIZE;            ///< number of rows and columns
+    static constexpr unsigned int kLower = KL;              ///< number of subdiagonals
+    static constexpr unsigned int kUpper = KU;              ///< number of superdiagonals
+    static constexpr unsigned int kWidth = KL + KU + 1;     ///< band width
+
+    /**
+     * \brief Checks if element is within the band.
+     * \param row element row
+     * \param col element column
+     * \return true if element is within the band, false otherwise
+     */
+    static constexpr bool IsInBand(unsigned int row, unsigned int col)
+    {
+        return row < SIZE && col < SIZE && col + KL >= row && col <= row + KU;
+    }
+
+    /**
+     * \brief Checks if all band elements are valid.
+     * \return true if all band elements are valid, false otherwise
+     */
+    bool IsValid() const
+    {
+        return mc::IsValid(_elements, SIZE * kWidth);
+    }
+
+    /** \brief Sets all elements to zero. */
+    void Zeroize()
+    {
+        for (unsigned int i = 0; i < SIZE * kWidth; ++i)
+        {
+            _elements[i] = TYPE{0};
+        }
+    }
+
+    /**
+     * \brief Multiplies matrix by vector.
+     * \param vect vector
+     * \param result result vector, must not be the given vector
+     */
+    void MultiplyByVector(const VectorN<TYPE, SIZE>& vect, VectorN<TYPE, SIZE>* result) const
+    {
+        for (unsigned int r = 0; r < SIZE; ++r)
+        {
+            unsigned int c_min = r > KL ? r - KL : 0;
+            unsigned int c_max = r + KU < SIZE ? r + KU : SIZE - 1;
+
+            const TYPE* row = _elements + r * kWidth + KL - r;
+
+            TYPE sum = TYPE{0};
+            for (unsigned int c = c_min; c <= c_max; ++c)
+            {
+                sum += row[c] * vect(c);
+            }
+            (*result)(r) = sum;
+        }
+    }
+
+    /** \return pointer to the band elements */
+    inline const TYPE* data() const { return _elements; }
+
+    /**
+     * \brief Element accessor.
+     * \param row element row
+     * \param col element column
+     * \return element value, zero if element is outside the band
+     */
+    inline TYPE operator()(unsigned int row, unsigned int col) const
+    {
+        return IsInBand(row, col) ? _elements[row * kWidth + col + KL - row] : TYPE{0};
+    }
+
+    /**
+     * \brief Element accessor.
+     * \param row element row
+     * \param col element column, element must be within the band
+     * \return element reference
+     */
+    inline TYPE& operator()(unsigned int row, unsigned int col)
+    {
+        assert(IsInBand(row, col));
+        return _elements[row * kWidth + col + KL - row];
+    }
+
+    /** \brief Multiplication operator (by vector). */
+    VectorN<TYPE, SIZE> operator*(const VectorN<TYPE, SIZE>& vect) const
+    {
+        VectorN<TYPE, SIZE> result;
+        MultiplyByVector(vect, &result);
+        return result;
+    }
+
+protected:
+
+    TYPE _elements[SIZE * kWidth] = { 0 };  ///< band elements
+};
+
+} // namespace mc
+
+#endif // MCUTILS_MATH_BANDMATRIX_H_
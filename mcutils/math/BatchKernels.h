@@ -0,0 +1,327 @@
+/****************************************************************************//*
+ * Copyright (C) 2026 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_BATCHKERNELS_H_
+#define MCUTILS_MATH_BATCHKERNELS_H_
+
+#include <cmath>
+#include <cstddef>
+
+#include <mcutils/math/MatrixKernels.h>
+
+// restrict qualified kernel parameters let the compiler vectorize loops
+// over separate component arrays without runtime aliasing checks
+#if defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER)
+#   define MCUTILS_BATCH_KERNELS_RESTRICT __restrict
+#else
+#   define MCUTILS_BATCH_KERNELS_RESTRICT
+#endif
+
+namespace mc {
+
+/**
+ * \brief Structure-of-arrays batch kernels.
+ *
+ * Kernels operate on component arrays of a batch (e.g. all x, all y and
+ * all z components of vectors) and go over blocks of kLanes elements, with
+ * fixed trip count inner loop, so that each block is vectorized even at
+ * -O2. Batch storage is padded with zeros to a multiple of kLanes, so
+ * there are no remainder loops. Unless stated otherwise, count is padded
+ * batch size and arrays given as separate parameters must not overlap.
+ */
+namespace BatchKernels {
+
+constexpr unsigned int kLanes = 4;  ///< number of elements processed at once
+
+// indices are of pointer width, otherwise possible unsigned int wrap-around
+// prevents compiler from treating block elements as adjacent
+#define MCUTILS_BATCH_KERNELS_LOOP(i, j, n) \
+    for (size_t i = 0; i < n; i += kLanes) \
+        MCUTILS_MATRIX_KERNELS_UNROLL \
+        for (size_t j = i; j < i + kLanes; ++j)
+
+/**
+ * \brief Returns batch size padded to a multiple of kLanes.
+ * \param size batch size
+ * \return padded batch size
+ */
+constexpr unsigned int GetPaddedSize(unsigned int size)
+{
+    return (size + kLanes - 1) / kLanes * kLanes;
+}
+
+/**
+ * \brief Calculates inverse square roots of kLanes values.
+ * Values not greater than zero result in 1.0, so that zero length
+ * vectors and quaternions (including padding) remain unchanged.
+ * \param len2 squared lengths
+ * \param inv result inverse lengths
+ */
+inline void GetInverseLengths(const double* len2, double* inv)
+{
+#if defined(MCUTILS_MATRIX_KERNELS_PACK_SSE2)
+    // scalar std::sqrt is not vectorized as it may set errno
+    const __m128d zero = _mm_setzero_pd();
+    const __m128d one  = _mm_set1_pd(1.0);
+    MCUTILS_MATRIX_KERNELS_UNROLL
+    for (unsigned int i = 0; i < kLanes; i += 2)
+    {
+        __m128d l2  = _mm_loadu_pd(len2 + i);
+        __m128d pos = _mm_cmpgt_pd(l2, zero);
+        __m128d res = _mm_div_pd(one, _mm_sqrt_pd(_mm_max_pd(l2, zero)));
+        _mm_storeu_pd(inv + i, _mm_or_pd(_mm_and_pd(pos, res), _mm_andnot_pd(pos, one)));
+    }
+#else
+    for (unsigned int i = 0; i < kLanes; ++i)
+    {
+        inv[i] = len2[i] > 0.0 ? 1.0 / std::sqrt(len2[i]) : 1.0;
+    }
+#endif
+}
+
+/** \brief Element-wise addition, r += a. */
+inline void Add(unsigned int count,
+                double* MCUTILS_BATCH_KERNELS_RESTRICT r,
+                const double* MCUTILS_BATCH_KERNELS_RESTRICT a)
+{
+    MCUTILS_BATCH_KERNELS_LOOP(i, j, count)
+    {
+        r[j] += a[j];
+    }
+}
+
+/** \brief Element-wise subtraction, r -= a. */
+inline void Substract(unsigned int count,
+                      double* MCUTILS_BATCH_KERNELS_RESTRICT r,
+                      const double* MCUTILS_BATCH_KERNELS_RESTRICT a)
+{
+    MCUTILS_BATCH_KERNELS_LOOP(i, j, count)
+    {
+        r[j] -= a[j];
+    }
+}
+
+/** \brief Element-wise scaled addition, r += a*value. */
+inline void AddScaled(unsigned int count,
+                      double* MCUTILS_BATCH_KERNELS_RESTRICT r,
+                      const double* MCUTILS_BATCH_KERNELS_RESTRICT a,
+                      double value)
+{
+    MCUTILS_BATCH_KERNELS_LOOP(i, j, count)
+    {
+        r[j] += a[j] * value;
+    }
+}
+
+/** \brief Element-wise scaling, r *= value. */
+inline void Scale(unsigned int count, double* MCUTILS_BATCH_KERNELS_RESTRICT r, double value)
+{
+    MCUTILS_BATCH_KERNELS_LOOP(i, j, count)
+    {
+        r[j] *= value;
+    }
+}
+
+/**
+ * \brief Dot products of 3 elements vectors, r = a*b.
+ * \param count number of products, not required to be padded
+ */
+inline void Dot3(unsigned int count,
+                 const double* MCUTILS_BATCH_KERNELS_RESTRICT ax,
+                 const double* MCUTILS_BATCH_KERNELS_RESTRICT ay,
+                 const double* MCUTILS_BATCH_KERNELS_RESTRICT az,
+                 const double* MCUTILS_BATCH_KERNELS_RESTRICT bx,
+                 const double* MCUTILS_BATCH_KERNELS_RESTRICT by,
+                 const double* MCUTILS_BATCH_KERNELS_RESTRICT bz,
+                 double* MCUTILS_BATCH_KERNELS_RESTRICT r)
+{
+    // result array is not padded
+    const unsigned int count_blocks = count / kLanes * kLanes;
+
+    MCUTILS_BATCH_KERNELS_LOOP(i, j, count_blocks)
+    {
+        r[j] = ax[j]*bx[j] + ay[j]*by[j] + az[j]*bz[j];
+    }
+
+    for (size_t j = count_blocks; j < count; ++j)
+    {
+        r[j] = ax[j]*bx[j] + ay[j]*by[j] + az[j]*bz[j];
+    }
+}
+
+/** \brief Cross products of 3 elements vectors, r = a%b. */
+inline void Cross3(unsigned int count,
+                   const double* MCUTILS_BATCH_KERNELS_RESTRICT ax,
+                   const double* MCUTILS_BATCH_KERNELS_RESTRICT ay,
+                   const double* MCUTILS_BATCH_KERNELS_RESTRICT az,
+                   const double* MCUTILS_BATCH_KERNELS_RESTRICT bx,
+                   const double* MCUTILS_BATCH_KERNELS_RESTRICT by,
+                   const double* MCUTILS_BATCH_KERNELS_RESTRICT bz,
+                   double* MCUTILS_BATCH_KERNELS_RESTRICT rx,
+                   double* MCUTILS_BATCH_KERNELS_RESTRICT ry,
+                   double* MCUTILS_BATCH_KERNELS_RESTRICT rz)
+{
+    MCUTILS_BATCH_KERNELS_LOOP(i, j, count)
+    {
+        rx[j] = ay[j]*bz[j] - az[j]*by[j];
+        ry[j] = az[j]*bx[j] - ax[j]*bz[j];
+        rz[j] = ax[j]*by[j] - ay[j]*bx[j];
+    }
+}
+
+/** \brief Normalizes 3 elements vectors in place. */
+inline void Normalize3(unsigned int count,
+                       double* MCUTILS_BATCH_KERNELS_RESTRICT x,
+                       double* MCUTILS_BATCH_KERNELS_RESTRICT y,
+                       double* MCUTILS_BATCH_KERNELS_RESTRICT z)
+{
+    for (size_t i = 0; i < count; i += kLanes)
+    {
+        double len2[kLanes];
+        double inv[kLanes];
+
+        MCUTILS_MATRIX_KERNELS_UNROLL
+        for (unsigned int j = 0; j < kLanes; ++j)
+        {
+            len2[j] = x[i+j]*x[i+j] + y[i+j]*y[i+j] + z[i+j]*z[i+j];
+        }
+
+        GetInverseLengths(len2, inv);
+
+        MCUTILS_MATRIX_KERNELS_UNROLL
+        for (unsigned int j = 0; j < kLanes; ++j)
+        {
+            x[i+j] *= inv[j];
+            y[i+j] *= inv[j];
+            z[i+j] *= inv[j];
+        }
+    }
+}
+
+/** \brief Normalizes quaternions in place. */
+inline void Normalize4(unsigned int count,
+                       double* MCUTILS_BATCH_KERNELS_RESTRICT e0,
+                       double* MCUTILS_BATCH_KERNELS_RESTRICT ex,
+                       double* MCUTILS_BATCH_KERNELS_RESTRICT ey,
+                       double* MCUTILS_BATCH_KERNELS_RESTRICT ez)
+{
+    for (size_t i = 0; i < count; i += kLanes)
+    {
+        double len2[kLanes];
+        double inv[kLanes];
+
+        MCUTILS_MATRIX_KERNELS_UNROLL
+        for (unsigned int j = 0; j < kLanes; ++j)
+        {
+            len2[j] = e0[i+j]*e0[i+j] + ex[i+j]*ex[i+j] + ey[i+j]*ey[i+j] + ez[i+j]*ez[i+j];
+        }
+
+        GetInverseLengths(len2, inv);
+
+        MCUTILS_MATRIX_KERNELS_UNROLL
+        for (unsigned int j = 0; j < kLanes; ++j)
+        {
+            e0[i+j] *= inv[j];
+            ex[i+j] *= inv[j];
+            ey[i+j] *= inv[j];
+            ez[i+j] *= inv[j];
+        }
+    }
+}
+
+/** \brief Quaternion products, r = a*b, the same formula as Quaternion::operator*(). */
+inline void QuaternionProduct(unsigned int count,
+                              const double* MCUTILS_BATCH_KERNELS_RESTRICT a0,
+                              const double* MCUTILS_BATCH_KERNELS_RESTRICT ax,
+                              const double* MCUTILS_BATCH_KERNELS_RESTRICT ay,
+                              const double* MCUTILS_BATCH_KERNELS_RESTRICT az,
+                              const double* MCUTILS_BATCH_KERNELS_RESTRICT b0,
+                              const double* MCUTILS_BATCH_KERNELS_RESTRICT bx,
+                              const double* MCUTILS_BATCH_KERNELS_RESTRICT by,
+                              const double* MCUTILS_BATCH_KERNELS_RESTRICT bz,
+                              double* MCUTILS_BATCH_KERNELS_RESTRICT r0,
+                              double* MCUTILS_BATCH_KERNELS_RESTRICT rx,
+                              double* MCUTILS_BATCH_KERNELS_RESTRICT ry,
+                              double* MCUTILS_BATCH_KERNELS_RESTRICT rz)
+{
+    MCUTILS_BATCH_KERNELS_LOOP(i, j, count)
+    {
+        r0[j] = a0[j]*b0[j] - ax[j]*bx[j] - ay[j]*by[j] - az[j]*bz[j];
+        rx[j] = a0[j]*bx[j] + ax[j]*b0[j] + ay[j]*bz[j] - az[j]*by[j];
+        ry[j] = a0[j]*by[j] - ax[j]*bz[j] + ay[j]*b0[j] + az[j]*bx[j];
+        rz[j] = a0[j]*bz[j] + ax[j]*by[j] - ay[j]*bx[j] + az[j]*b0[j];
+    }
+}
+
+/**
+ * \brief Multiplies 3 elements vectors by the same 3x3 matrix, r = m*v.
+ * \param m matrix elements, row by row
+ */
+inline void MultiplyByMatrix3(unsigned int count, const double m[9],
+                              const double* MCUTILS_BATCH_KERNELS_RESTRICT vx,
+                              const double* MCUTILS_BATCH_KERNELS_RESTRICT vy,
+                              const double* MCUTILS_BATCH_KERNELS_RESTRICT vz,
+                              double* MCUTILS_BATCH_KERNELS_RESTRICT rx,
+                              double* MCUTILS_BATCH_KERNELS_RESTRICT ry,
+                              double* MCUTILS_BATCH_KERNELS_RESTRICT rz)
+{
+    const double m0 = m[0], m1 = m[1], m2 = m[2];
+    const double m3 = m[3], m4 = m[4], m5 = m[5];
+    const double m6 = m[6], m7 = m[7], m8 = m[8];
+
+    MCUTILS_BATCH_KERNELS_LOOP(i, j, count)
+    {
+        rx[j] = m0*vx[j] + m1*vy[j] + m2*vz[j];
+        ry[j] = m3*vx[j] + m4*vy[j] + m5*vz[j];
+        rz[j] = m6*vx[j] + m7*vy[j] + m8*vz[j];
+    }
+}
+
+/**
+ * \brief Multiplies 3 elements vectors by the same 3x3 matrix in place, v = m*v.
+ * \param m matrix elements, row by row
+ */
+inline void MultiplyByMatrix3(unsigned int count, const double m[9],
+                              double* MCUTILS_BATCH_KERNELS_RESTRICT x,
+                              double* MCUTILS_BATCH_KERNELS_RESTRICT y,
+                              double* MCUTILS_BATCH_KERNELS_RESTRICT z)
+{
+    const double m0 = m[0], m1 = m[1], m2 = m[2];
+    const double m3 = m[3], m4 = m[4], m5 = m[5];
+    const double m6 = m[6], m7 = m[7], m8 = m[8];
+
+    MCUTILS_BATCH_KERNELS_LOOP(i, j, count)
+    {
+        double vx = x[j];
+        double vy = y[j];
+        double vz = z[j];
+        x[j] = m0*vx + m1*vy + m2*vz;
+        y[j] = m3*vx + m4*vy + m5*vz;
+        z[j] = m6*vx + m7*vy + m8*vz;
+    }
+}
+
+#undef MCUTILS_BATCH_KERNELS_LOOP
+
+} // namespace BatchKernels
+} // namespace mc
+
+#endif // MCUTILS_MATH_BATCHKERNELS_H_
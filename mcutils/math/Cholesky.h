@@ -0,0 +1,322 @@
+/****************************************************************************//*
+ * Copyright (C) 2026 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_CHOLESKY_H_
+#define MCUTILS_MATH_CHOLESKY_H_
+
+#include <cmath>
+
+#include <mcutils/Result.h>
+
+#include <mcutils/math/Matrix.h>
+#include <mcutils/math/Vector.h>
+
+namespace mc {
+
+/**
+ * \brief Cholesky factorization of symmetric positive-definite matrix.
+ *
+ * Factorizes matrix as A = L*L^T, where L is lower triangular. It takes
+ * half of the LU factorization flops and needs no pivoting. Only the lower
+ * triangle of the factorized matrix is referenced. Rank-1 update and
+ * downdate modify stored factor in O(n^2), so that it does not have to be
+ * refactorized when matrix changes by v*v^T, e.g. covariance update.
+ *
+ * \tparam TYPE matrix element type
+ * \tparam SIZE matrix size
+ *
+ * ### Refernces:
+ * - Press W., et al.: Numerical Recipes: The Art of Scientific Computing, 2007, p.100
+ * - Golub G., Van Loan C.: Matrix Computations, 2013, p.163
+ * - [Cholesky decomposition - Wikipedia](https://en.wikipedia.org/wiki/Cholesky_decomposition)
+ */
+template <typename TYPE, unsigned int SIZE>
+class Cholesky
+{
+public:
+
+    /** \brief Constructor. */
+    Cholesky() = default;
+
+    /**
+     * \brief Constructor, factorizes the given matrix.
+     * \param mtr symmetric positive-definite matrix to be factorized
+     * \param eps minimum value treated as positive
+     */
+    explicit Cholesky(const MatrixNxN<TYPE, SIZE>& mtr, double eps = 1.0e-9)
+    {
+        Factorize(mtr, eps);
+    }
+
+    /**
+     * \brief Factorizes the given matrix, replacing previous factor.
+     * Factor overwrites copy of the matrix in place, column by column.
+     * \param mtr symmetric positive-definite matrix to be factorized
+     * \param eps minimum value treated as positive
+     * \return mc::Result::Success on success and mc::Result::Failure if matrix is not positive-definite
+     */
+    Result Factorize(const MatrixNxN<TYPE, SIZE>& mtr, double eps = 1.0e-9)
+    {
+        _l = mtr;
+        _valid = false;
+
+        for (unsigned int j = 0; j < SIZE; ++j)
+        {
+            double d = _l(j,j);
+            for (unsigned int k = 0; k < j; ++k)
+            {
+                d -= _l(j,k) * _l(j,k);
+            }
+
+            if (d < fabs(eps))
+            {
+                return Result::Failure;
+            }
+
+            double l_jj = sqrt(d);
+            double l_jj_inv = 1.0 / l_jj;
+            _l(j,j) = l_jj;
+
+            for (unsigned int i = j + 1; i < SIZE; ++i)
+            {
+                double sum = _l(i,j);
+                for (unsigned int k = 0; k < j; ++k)
+                {
+                    sum -= _l(i,k) * _l(j,k);
+                }
+                _l(i,j) = sum * l_jj_inv;
+                _l(j,i) = 0.0;
+            }
+        }
+
+        _valid = true;
+
+        return Result::Success;
+    }
+
+    /**
+     * \brief Solves system of linear equations using stored factor.
+     * \param rhs right hand side vector
+     * \param x result vector, may be the right hand side vector
+     * \return mc::Result::Success on success and mc::Result::Failure if there is no valid factor
+     */
+    Result Solve(const VectorN<TYPE, SIZE>& rhs, VectorN<TYPE, SIZE>* x) const
+    {
+        if (!_valid)
+        {
+            return Result::Failure;
+        }
+
+        *x = rhs;
+        SolveLower(x);
+        SolveUpper(x);
+
+        return Result::Success;
+    }
+
+    /**
+     * \brief Solves system of linear equations for many right hand sides at once.
+     * \param rhs right hand side matrix, each column is a separate right hand side
+     * \param x result matrix, may be the right hand side matrix
+     * \return mc::Result::Success on success and mc::Result::Failure if there is no valid factor
+     */
+    template <unsigned int COLS>
+    Result Solve(const MatrixMxN<TYPE, SIZE, COLS>& rhs, MatrixMxN<TYPE, SIZE, COLS>* x) const
+    {
+        if (!_valid)
+        {
+            return Result::Failure;
+        }
+
+        *x = rhs;
+
+        // forward substitution, L*Y = B
+        for (unsigned int i = 0; i < SIZE; ++i)
+        {
+            for (unsigned int k = 0; k < i; ++k)
+            {
+                double l_ik = _l(i,k);
+                for (unsigned int c = 0; c < COLS; ++c)
+                {
+                    (*x)(i,c) -= l_ik * (*x)(k,c);
+                }
+            }
+            double l_ii_inv = 1.0 / _l(i,i);
+            for (unsigned int c = 0; c < COLS; ++c)
+            {
+                (*x)(i,c) *= l_ii_inv;
+            }
+        }
+
+        // back substitution, L^T*X = Y
+        for (unsigned int i = SIZE; i-- > 0;)
+        {
+            for (unsigned int k = i + 1; k < SIZE; ++k)
+            {
+                double l_ki = _l(k,i);
+                for (unsigned int c = 0; c < COLS; ++c)
+                {
+                    (*x)(i,c) -= l_ki * (*x)(k,c);
+                }
+            }
+            double l_ii_inv = 1.0 / _l(i,i);
+            for (unsigned int c = 0; c < COLS; ++c)
+            {
+                (*x)(i,c) *= l_ii_inv;
+            }
+        }
+
+        return Result::Success;
+    }
+
+    /**
+     * \brief Solves L*y = b in place by forward substitution.
+     * \param b right hand side vector, replaced with result
+     */
+    void SolveLower(VectorN<TYPE, SIZE>* b) const
+    {
+        for (unsigned int i = 0; i < SIZE; ++i)
+        {
+            TYPE sum = (*b)(i);
+            for (unsigned int k = 0; k < i; ++k)
+            {
+                sum -= _l(i,k) * (*b)(k);
+            }
+            (*b)(i) = sum / _l(i,i);
+        }
+    }
+
+    /**
+     * \brief Solves L^T*x = y in place by back substitution.
+     * \param y right hand side vector, replaced with result
+     */
+    void SolveUpper(VectorN<TYPE, SIZE>* y) const
+    {
+        for (unsigned int i = SIZE; i-- > 0;)
+        {
+            TYPE sum = (*y)(i);
+            for (unsigned int k = i + 1; k < SIZE; ++k)
+            {
+                sum -= _l(k,i) * (*y)(k);
+            }
+            (*y)(i) = sum / _l(i,i);
+        }
+    }
+
+    /**
+     * \brief Updates factor so that it becomes factor of A + v*v^T.
+     * \param v update vector
+     * \return mc::Result::Success on success and mc::Result::Failure if there is no valid factor
+     */
+    Result Update(const VectorN<TYPE, SIZE>& v)
+    {
+        return RankOneModify(v, 1.0, 0.0);
+    }
+
+    /**
+     * \brief Downdates factor so that it becomes factor of A - v*v^T.
+     * Factor becomes invalid on failure and has to be refactorized.
+     * \param v downdate vector
+     * \param eps minimum value treated as positive
+     * \return mc::Result::Success on success and mc::Result::Failure if result is not positive-definite
+     */
+    Result Downdate(const VectorN<TYPE, SIZE>& v, double eps = 1.0e-9)
+    {
+        return RankOneModify(v, -1.0, eps);
+    }
+
+    /**
+     * \brief Returns determinant calculated from stored factor.
+     * \return determinant, zero if matrix is not positive-definite
+     */
+    double GetDeterminant() const
+    {
+        if (!_valid)
+        {
+            return 0.0;
+        }
+
+        double det = 1.0;
+        for (unsigned int i = 0; i < SIZE; ++i)
+        {
+            det *= _l(i,i);
+        }
+        return det * det;
+    }
+
+    /** \return true if factor is valid, false if matrix is not positive-definite or was not factorized */
+    inline bool IsValid() const { return _valid; }
+
+    /** \return lower triangular factor L */
+    inline const MatrixNxN<TYPE, SIZE>& GetFactor() const { return _l; }
+
+private:
+
+    MatrixNxN<TYPE, SIZE> _l;   ///< lower triangular factor
+    bool _valid = false;        ///< specifies if factor is valid
+
+    /**
+     * \brief Modifies factor so that it becomes factor of A + sign*v*v^T.
+     * \param v update vector
+     * \param sign 1.0 for update and -1.0 for downdate
+     * \param eps minimum value treated as positive
+     * \return mc::Result::Success on success and mc::Result::Failure on failure
+     */
+    Result RankOneModify(const VectorN<TYPE, SIZE>& v, double sign, double eps)
+    {
+        if (!_valid)
+        {
+            return Result::Failure;
+        }
+
+        VectorN<TYPE, SIZE> w = v;
+
+        for (unsigned int k = 0; k < SIZE; ++k)
+        {
+            double l_kk = _l(k,k);
+            double r2 = l_kk * l_kk + sign * w(k) * w(k);
+
+            if (r2 < fabs(eps) || r2 <= 0.0)
+            {
+                _valid = false;
+                return Result::Failure;
+            }
+
+            double r = sqrt(r2);
+            double c = r / l_kk;
+            double s = w(k) / l_kk;
+            double c_inv = 1.0 / c;
+            _l(k,k) = r;
+
+            for (unsigned int i = k + 1; i < SIZE; ++i)
+            {
+                _l(i,k) = (_l(i,k) + sign * s * w(i)) * c_inv;
+                w(i) = c * w(i) - s * _l(i,k);
+            }
+        }
+
+        return Result::Success;
+    }
+};
+
+} // namespace mc
+
+#endif // MCUTILS_MATH_CHOLESKY_H_
@@ -25,37 +25,34 @@
 #include <mcutils/Result.h>
 
 #include <mcutils/math/Matrix.h>
+#include <mcutils/math/MatrixX.h>
 #include <mcutils/math/Vector.h>
+#include <mcutils/math/VectorX.h>
 
 namespace mc {
 
 /**
- * \brief Solves system of linear equations using Gauss-Jordan method.
+ * \brief Performs Gauss-Jordan elimination in place.
+ * Common part of SolveGaussJordan() for fixed and runtime sized systems.
  *
- * \param mtr left hand side matrix
- * \param rhs right hand size vector
- * \param x result vector
+ * \param mtr left hand side matrix, reduced to identity matrix on success
+ * \param rhs right hand size vector, replaced with result on success
+ * \param size number of equations
  * \param eps minimum value treated as not-zero
  * \return mc::Result::Success on success and mc::Result::Failure on failure
- *
- * ### Refernces:
- * - Press W., et al.: Numerical Recipes: The Art of Scientific Computing, 2007, p.41
- * - Baron B., Piatek L.: Metody numeryczne w C++ Builder, 2004, p.34. [in Polish]
- * - [Gaussian elimination - Wikipedia](https://en.wikipedia.org/wiki/Gaussian_elimination)
  */
-template <typename TYPE, unsigned int SIZE>
-Result SolveGaussJordan(const MatrixNxN<TYPE, SIZE>& mtr, const VectorN<TYPE, SIZE>& rhs,
-                        VectorN<TYPE, SIZE>* x, double eps = 1.0e-9)
+template <typename MATRIX, typename VECTOR>
+Result EliminateGaussJordan(MATRIX* mtr, VECTOR* rhs, unsigned int size, double eps)
 {
-    MatrixNxN<TYPE, SIZE> mtr_temp = mtr;
-    VectorN<TYPE, SIZE>   rhs_temp = rhs;
+    MATRIX& mtr_temp = *mtr;
+    VECTOR& rhs_temp = *rhs;
 
-    for (unsigned int r = 0; r < SIZE; ++r)
+    for (unsigned int r = 0; r < size; ++r)
     {
         // run along diagonal, swapping rows to move zeros (outside the diagonal) downwards
         if (fabs(mtr_temp(r,r)) < fabs(eps))
         {
-            if ( r < SIZE - 1 )
+            if ( r < size - 1 )
             {
                 mtr_temp.SwapRows(r, r+1);
                 rhs_temp.SwapRows(r, r+1);
@@ -71,7 +68,7 @@ Result SolveGaussJordan(const MatrixNxN<TYPE, SIZE>& mtr, const VectorN<TYPE, SI
         double a_rr_inv = 1.0 / a_rr;
 
         // deviding current row by value on diagonal
-        for (unsigned int c = 0; c < SIZE; ++c)
+        for (unsigned int c = 0; c < size; ++c)
         {
             mtr_temp(r,c) *= a_rr_inv;
         }
@@ -82,12 +79,12 @@ Result SolveGaussJordan(const MatrixNxN<TYPE, SIZE>& mtr, const VectorN<TYPE, SI
         // for every row current row is multiplied by A(i,r)
         // where r stands for row that is substracted from other rows
         // and i stands for row that is substracting from
-        for (unsigned int i = 0; i < SIZE; ++i)
+        for (unsigned int i = 0; i < size; ++i)
         {
             if (i != r)
             {
                 double a_ir = mtr_temp(i,r);
-                for (unsigned int c = 0; c < SIZE; ++c)
+                for (unsigned int c = 0; c < size; ++c)
                 {
                     mtr_temp(i,c) -= a_ir * mtr_temp(r,c);
                 }
@@ -96,6 +93,71 @@ Result SolveGaussJordan(const MatrixNxN<TYPE, SIZE>& mtr, const VectorN<TYPE, SI
         }
     }
 
+    return Result::Success;
+}
+
+/**
+ * \brief Solves system of linear equations using Gauss-Jordan method.
+ *
+ * \param mtr left hand side matrix
+ * \param rhs right hand size vector
+ * \param x result vector
+ * \param eps minimum value treated as not-zero
+ * \return mc::Result::Success on success and mc::Result::Failure on failure
+ *
+ * ### Refernces:
+ * - Press W., et al.: Numerical Recipes: The Art of Scientific Computing, 2007, p.41
+ * - Baron B., Piatek L.: Metody numeryczne w C++ Builder, 2004, p.34. [in Polish]
+ * - [Gaussian elimination - Wikipedia](https://en.wikipedia.org/wiki/Gaussian_elimination)
+ */
+template <typename TYPE, unsigned int SIZE>
+Result SolveGaussJordan(const MatrixNxN<TYPE, SIZE>& mtr, const VectorN<TYPE, SIZE>& rhs,
+                        VectorN<TYPE, SIZE>* x, double eps = 1.0e-9)
+{
+    MatrixNxN<TYPE, SIZE> mtr_temp = mtr;
+    VectorN<TYPE, SIZE>   rhs_temp = rhs;
+
+    if (EliminateGaussJordan(&mtr_temp, &rhs_temp, SIZE, eps) != Result::Success)
+    {
+        return Result::Failure;
+    }
+
+    // rewritting results
+    *x = rhs_temp;
+
+    return Result::Success;
+}
+
+/**
+ * \brief Solves runtime sized system of linear equations using Gauss-Jordan method.
+ *
+ * Working copies of the matrix and the vector are allocated with the
+ * allocator of the given matrix.
+ *
+ * \param mtr left hand side square matrix
+ * \param rhs right hand size vector
+ * \param x result vector, resized if needed
+ * \param eps minimum value treated as not-zero
+ * \return mc::Result::Success on success and mc::Result::Failure on failure
+ */
+template <typename TYPE>
+Result SolveGaussJordan(const MatrixX<TYPE>& mtr, const VectorX<TYPE>& rhs,
+                        VectorX<TYPE>* x, double eps = 1.0e-9)
+{
+    if (mtr.rows() != mtr.cols() || mtr.rows() != rhs.size() || mtr.rows() == 0)
+    {
+        return Result::Failure;
+    }
+
+    MatrixX<TYPE> mtr_temp = mtr;
+    VectorX<TYPE> rhs_temp(rhs.size(), mtr.GetAllocator());
+    rhs_temp = rhs;
+
+    if (EliminateGaussJordan(&mtr_temp, &rhs_temp, rhs.size(), eps) != Result::Success)
+    {
+        return Result::Failure;
+    }
+
     // rewritting results
     *x = rhs_temp;
 
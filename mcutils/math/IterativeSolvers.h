@@ -0,0 +1,291 @@
+/****************************************************************************//*
+ * Copyright (C) 2026 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_ITERATIVESOLVERS_H_
+#define MCUTILS_MATH_ITERATIVESOLVERS_H_
+
+#include <cmath>
+
+#include <mcutils/Result.h>
+
+#include <mcutils/math/SparseMatrix.h>
+#include <mcutils/math/Vector.h>
+
+namespace mc {
+
+/**
+ * \brief Calculates inverse of the sparse matrix diagonal (Jacobi preconditioner).
+ * \param mtr square sparse matrix
+ * \param inv_diag result inverse diagonal
+ * \param eps minimum value treated as not-zero
+ * \return mc::Result::Success on success and mc::Result::Failure if any of diagonal elements is zero
+ */
+template <typename TYPE, unsigned int SIZE>
+Result GetInverseDiagonal(const SparseMatrix<TYPE, SIZE, SIZE>& mtr,
+                          VectorN<TYPE, SIZE>* inv_diag, double eps = 1.0e-9)
+{
+    for (unsigned int i = 0; i < SIZE; ++i)
+    {
+        double d = mtr(i,i);
+        if (fabs(d) < fabs(eps))
+        {
+            return Result::Failure;
+        }
+        (*inv_diag)(i) = 1.0 / d;
+    }
+
+    return Result::Success;
+}
+
+/**
+ * \brief Solves sparse symmetric positive-definite system of linear equations
+ * using Jacobi preconditioned conjugate gradient method.
+ *
+ * Each iteration takes O(number of non-zero elements) time. The initial
+ * value of the result vector is used as an initial guess, so passing
+ * the previous step solution reduces number of iterations.
+ *
+ * \param mtr left hand side symmetric positive-definite matrix
+ * \param rhs right hand side vector
+ * \param x result vector, initial guess on input
+ * \param eps required residual norm relative to the right hand side norm
+ * \param max_iter maximum number of iterations
+ * \return mc::Result::Success on success and mc::Result::Failure if not converged
+ *
+ * ### Refernces:
+ * - Saad Y.: Iterative Methods for Sparse Linear Systems, 2003, p.276
+ * - [Conjugate gradient method - Wikipedia](https://en.wikipedia.org/wiki/Conjugate_gradient_method)
+ */
+template <typename TYPE, unsigned int SIZE>
+Result SolveConjugateGradient(const SparseMatrix<TYPE, SIZE, SIZE>& mtr, const VectorN<TYPE, SIZE>& rhs,
+                              VectorN<TYPE, SIZE>* x, double eps = 1.0e-9,
+                              unsigned int max_iter = 2 * SIZE)
+{
+    VectorN<TYPE, SIZE> inv_diag;
+    if (GetInverseDiagonal(mtr, &inv_diag) != Result::Success)
+    {
+        return Result::Failure;
+    }
+
+    const double tol2 = eps * eps * (rhs * rhs);
+
+    // r = b - A*x
+    VectorN<TYPE, SIZE> r;
+    mtr.MultiplyByVector(*x, &r);
+    for (unsigned int i = 0; i < SIZE; ++i)
+    {
+        r(i) = rhs(i) - r(i);
+    }
+
+    if (r * r <= tol2)
+    {
+        return Result::Success;
+    }
+
+    VectorN<TYPE, SIZE> z;
+    VectorN<TYPE, SIZE> p;
+    VectorN<TYPE, SIZE> ap;
+
+    for (unsigned int i = 0; i < SIZE; ++i)
+    {
+        z(i) = inv_diag(i) * r(i);
+        p(i) = z(i);
+    }
+
+    double rz = r * z;
+
+    for (unsigned int iter = 0; iter < max_iter; ++iter)
+    {
+        mtr.MultiplyByVector(p, &ap);
+
+        double p_ap = p * ap;
+        if (p_ap <= 0.0)
+        {
+            // matrix is not positive-definite
+            return Result::Failure;
+        }
+
+        double alpha = rz / p_ap;
+        for (unsigned int i = 0; i < SIZE; ++i)
+        {
+            (*x)(i) += alpha * p(i);
+            r(i) -= alpha * ap(i);
+        }
+
+        if (r * r <= tol2)
+        {
+            return Result::Success;
+        }
+
+        for (unsigned int i = 0; i < SIZE; ++i)
+        {
+            z(i) = inv_diag(i) * r(i);
+        }
+
+        double rz_new = r * z;
+        double beta = rz_new / rz;
+        rz = rz_new;
+
+        for (unsigned int i = 0; i < SIZE; ++i)
+        {
+            p(i) = z(i) + beta * p(i);
+        }
+    }
+
+    return Result::Failure;
+}
+
+/**
+ * \brief Solves sparse system of linear equations using Jacobi preconditioned
+ * biconjugate gradient stabilized (BiCGSTAB) method.
+ *
+ * Unlike conjugate gradient method, it does not require matrix to be
+ * symmetric. The initial value of the result vector is used as an initial
+ * guess.
+ *
+ * \param mtr left hand side matrix
+ * \param rhs right hand side vector
+ * \param x result vector, initial guess on input
+ * \param eps required residual norm relative to the right hand side norm
+ * \param max_iter maximum number of iterations
+ * \return mc::Result::Success on success and mc::Result::Failure if not converged
+ *
+ * ### Refernces:
+ * - Saad Y.: Iterative Methods for Sparse Linear Systems, 2003, p.244
+ * - [Biconjugate gradient stabilized method - Wikipedia](https://en.wikipedia.org/wiki/Biconjugate_gradient_stabilized_method)
+ */
+template <typename TYPE, unsigned int SIZE>
+Result SolveBiCGSTAB(const SparseMatrix<TYPE, SIZE, SIZE>& mtr, const VectorN<TYPE, SIZE>& rhs,
+                     VectorN<TYPE, SIZE>* x, double eps = 1.0e-9,
+                     unsigned int max_iter = 2 * SIZE)
+{
+    VectorN<TYPE, SIZE> inv_diag;
+    if (GetInverseDiagonal(mtr, &inv_diag) != Result::Success)
+    {
+        return Result::Failure;
+    }
+
+    const double tol2 = eps * eps * (rhs * rhs);
+
+    // r = b - A*x
+    VectorN<TYPE, SIZE> r;
+    mtr.MultiplyByVector(*x, &r);
+    for (unsigned int i = 0; i < SIZE; ++i)
+    {
+        r(i) = rhs(i) - r(i);
+    }
+
+    if (r * r <= tol2)
+    {
+        return Result::Success;
+    }
+
+    const VectorN<TYPE, SIZE> r_hat = r;
+
+    VectorN<TYPE, SIZE> p;
+    VectorN<TYPE, SIZE> v;
+    VectorN<TYPE, SIZE> y;
+    VectorN<TYPE, SIZE> s;
+    VectorN<TYPE, SIZE> z;
+    VectorN<TYPE, SIZE> t;
+
+    double rho   = 1.0;
+    double alpha = 1.0;
+    double omega = 1.0;
+
+    for (unsigned int iter = 0; iter < max_iter; ++iter)
+    {
+        double rho_new = r_hat * r;
+        if (rho_new == 0.0)
+        {
+            // breakdown
+            return Result::Failure;
+        }
+
+        double beta = (rho_new / rho) * (alpha / omega);
+        rho = rho_new;
+
+        for (unsigned int i = 0; i < SIZE; ++i)
+        {
+            p(i) = r(i) + beta * (p(i) - omega * v(i));
+            y(i) = inv_diag(i) * p(i);
+        }
+
+        mtr.MultiplyByVector(y, &v);
+
+        double r_hat_v = r_hat * v;
+        if (r_hat_v == 0.0)
+        {
+            return Result::Failure;
+        }
+
+        alpha = rho / r_hat_v;
+        for (unsigned int i = 0; i < SIZE; ++i)
+        {
+            s(i) = r(i) - alpha * v(i);
+        }
+
+        if (s * s <= tol2)
+        {
+            for (unsigned int i = 0; i < SIZE; ++i)
+            {
+                (*x)(i) += alpha * y(i);
+            }
+            return Result::Success;
+        }
+
+        for (unsigned int i = 0; i < SIZE; ++i)
+        {
+            z(i) = inv_diag(i) * s(i);
+        }
+
+        mtr.MultiplyByVector(z, &t);
+
+        double t_t = t * t;
+        if (t_t == 0.0)
+        {
+            return Result::Failure;
+        }
+
+        omega = (t * s) / t_t;
+        for (unsigned int i = 0; i < SIZE; ++i)
+        {
+            (*x)(i) += alpha * y(i) + omega * z(i);
+            r(i) = s(i) - omega * t(i);
+        }
+
+        if (r * r <= tol2)
+        {
+            return Result::Success;
+        }
+
+        if (omega == 0.0)
+        {
+            return Result::Failure;
+        }
+    }
+
+    return Result::Failure;
+}
+
+} // namespace mc
+
+#endif // MCUTILS_MATH_ITERATIVESOLVERS_H_
@@ -0,0 +1,341 @@
+/****************************************************************************//*
+ * Copyright (C) 2026 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_LDLT_H_
+#define MCUTILS_MATH_LDLT_H_
+
+#include <cmath>
+
+#include <mcutils/Result.h>
+
+#include <mcutils/math/Matrix.h>
+#include <mcutils/math/Vector.h>
+
+namespace mc {
+
+/**
+ * \brief LDL^T factorization of symmetric matrix.
+ *
+ * Factorizes matrix as A = L*D*L^T, where L is unit lower triangular and
+ * D is diagonal, both stored in a single matrix. Unlike Cholesky, it takes
+ * no square roots and does not require matrix to be positive-definite,
+ * as long as none of D elements is zero. Only the lower triangle of the
+ * factorized matrix is referenced.
+ *
+ * \tparam TYPE matrix element type
+ * \tparam SIZE matrix size
+ *
+ * ### Refernces:
+ * - Golub G., Van Loan C.: Matrix Computations, 2013, p.165
+ * - Gill P., et al.: Methods for Modifying Matrix Factorizations, 1974
+ * - [Cholesky decomposition - Wikipedia](https://en.wikipedia.org/wiki/Cholesky_decomposition#LDL_decomposition)
+ */
+template <typename TYPE, unsigned int SIZE>
+class LDLT
+{
+public:
+
+    /** \brief Constructor. */
+    LDLT() = default;
+
+    /**
+     * \brief Constructor, factorizes the given matrix.
+     * \param mtr symmetric matrix to be factorized
+     * \param eps minimum value treated as not-zero
+     */
+    explicit LDLT(const MatrixNxN<TYPE, SIZE>& mtr, double eps = 1.0e-9)
+    {
+        Factorize(mtr, eps);
+    }
+
+    /**
+     * \brief Factorizes the given matrix, replacing previous factors.
+     * Factors overwrite copy of the matrix in place, column by column.
+     * \param mtr symmetric matrix to be factorized
+     * \param eps minimum value treated as not-zero
+     * \return mc::Result::Success on success and mc::Result::Failure if any of D elements is zero
+     */
+    Result Factorize(const MatrixNxN<TYPE, SIZE>& mtr, double eps = 1.0e-9)
+    {
+        _ld = mtr;
+        _valid = false;
+
+        // scratch row, v(k) = L(j,k)*D(k)
+        VectorN<TYPE, SIZE> v;
+
+        for (unsigned int j = 0; j < SIZE; ++j)
+        {
+            double d = _ld(j,j);
+            for (unsigned int k = 0; k < j; ++k)
+            {
+                v(k) = _ld(j,k) * _ld(k,k);
+                d -= _ld(j,k) * v(k);
+            }
+
+            if (fabs(d) < fabs(eps))
+            {
+                return Result::Failure;
+            }
+
+            double d_inv = 1.0 / d;
+            _ld(j,j) = d;
+
+            for (unsigned int i = j + 1; i < SIZE; ++i)
+            {
+                double sum = _ld(i,j);
+                for (unsigned int k = 0; k < j; ++k)
+                {
+                    sum -= _ld(i,k) * v(k);
+                }
+                _ld(i,j) = sum * d_inv;
+                _ld(j,i) = 0.0;
+            }
+        }
+
+        _valid = true;
+
+        return Result::Success;
+    }
+
+    /**
+     * \brief Solves system of linear equations using stored factors.
+     * \param rhs right hand side vector
+     * \param x result vector, may be the right hand side vector
+     * \return mc::Result::Success on success and mc::Result::Failure if there are no valid factors
+     */
+    Result Solve(const VectorN<TYPE, SIZE>& rhs, VectorN<TYPE, SIZE>* x) const
+    {
+        if (!_valid)
+        {
+            return Result::Failure;
+        }
+
+        *x = rhs;
+        SolveLower(x);
+        SolveDiagonal(x);
+        SolveUpper(x);
+
+        return Result::Success;
+    }
+
+    /**
+     * \brief Solves system of linear equations for many right hand sides at once.
+     * \param rhs right hand side matrix, each column is a separate right hand side
+     * \param x result matrix, may be the right hand side matrix
+     * \return mc::Result::Success on success and mc::Result::Failure if there are no valid factors
+     */
+    template <unsigned int COLS>
+    Result Solve(const MatrixMxN<TYPE, SIZE, COLS>& rhs, MatrixMxN<TYPE, SIZE, COLS>* x) const
+    {
+        if (!_valid)
+        {
+            return Result::Failure;
+        }
+
+        *x = rhs;
+
+        // forward substitution, L*Z = B
+        for (unsigned int i = 0; i < SIZE; ++i)
+        {
+            for (unsigned int k = 0; k < i; ++k)
+            {
+                double l_ik = _ld(i,k);
+                for (unsigned int c = 0; c < COLS; ++c)
+                {
+                    (*x)(i,c) -= l_ik * (*x)(k,c);
+                }
+            }
+        }
+
+        // diagonal, D*Y = Z
+        for (unsigned int i = 0; i < SIZE; ++i)
+        {
+            double d_inv = 1.0 / _ld(i,i);
+            for (unsigned int c = 0; c < COLS; ++c)
+            {
+                (*x)(i,c) *= d_inv;
+            }
+        }
+
+        // back substitution, L^T*X = Y
+        for (unsigned int i = SIZE; i-- > 0;)
+        {
+            for (unsigned int k = i + 1; k < SIZE; ++k)
+            {
+                double l_ki = _ld(k,i);
+                for (unsigned int c = 0; c < COLS; ++c)
+                {
+                    (*x)(i,c) -= l_ki * (*x)(k,c);
+                }
+            }
+        }
+
+        return Result::Success;
+    }
+
+    /**
+     * \brief Solves L*z = b in place by forward substitution.
+     * \param b right hand side vector, replaced with result
+     */
+    void SolveLower(VectorN<TYPE, SIZE>* b) const
+    {
+        for (unsigned int i = 0; i < SIZE; ++i)
+        {
+            TYPE sum = (*b)(i);
+            for (unsigned int k = 0; k < i; ++k)
+            {
+                sum -= _ld(i,k) * (*b)(k);
+            }
+            (*b)(i) = sum;
+        }
+    }
+
+    /**
+     * \brief Solves D*y = z in place.
+     * \param z right hand side vector, replaced with result
+     */
+    void SolveDiagonal(VectorN<TYPE, SIZE>* z) const
+    {
+        for (unsigned int i = 0; i < SIZE; ++i)
+        {
+            (*z)(i) /= _ld(i,i);
+        }
+    }
+
+    /**
+     * \brief Solves L^T*x = y in place by back substitution.
+     * \param y right hand side vector, replaced with result
+     */
+    void SolveUpper(VectorN<TYPE, SIZE>* y) const
+    {
+        for (unsigned int i = SIZE; i-- > 0;)
+        {
+            TYPE sum = (*y)(i);
+            for (unsigned int k = i + 1; k < SIZE; ++k)
+            {
+                sum -= _ld(k,i) * (*y)(k);
+            }
+            (*y)(i) = sum;
+        }
+    }
+
+    /**
+     * \brief Updates factors so that they become factors of A + v*v^T.
+     * Factors become invalid on failure and have to be refactorized.
+     * \param v update vector
+     * \param eps minimum value treated as not-zero
+     * \return mc::Result::Success on success and mc::Result::Failure if any of D elements becomes zero
+     */
+    Result Update(const VectorN<TYPE, SIZE>& v, double eps = 1.0e-9)
+    {
+        return RankOneModify(v, 1.0, eps);
+    }
+
+    /**
+     * \brief Downdates factors so that they become factors of A - v*v^T.
+     * Factors become invalid on failure and have to be refactorized.
+     * \param v downdate vector
+     * \param eps minimum value treated as not-zero
+     * \return mc::Result::Success on success and mc::Result::Failure if any of D elements becomes zero
+     */
+    Result Downdate(const VectorN<TYPE, SIZE>& v, double eps = 1.0e-9)
+    {
+        return RankOneModify(v, -1.0, eps);
+    }
+
+    /**
+     * \brief Returns determinant calculated from stored factors.
+     * \return determinant, zero if matrix is singular
+     */
+    double GetDeterminant() const
+    {
+        if (!_valid)
+        {
+            return 0.0;
+        }
+
+        double det = 1.0;
+        for (unsigned int i = 0; i < SIZE; ++i)
+        {
+            det *= _ld(i,i);
+        }
+        return det;
+    }
+
+    /** \return true if factors are valid, false if matrix is singular or was not factorized */
+    inline bool IsValid() const { return _valid; }
+
+    /** \return combined factors, L below and D on the diagonal */
+    inline const MatrixNxN<TYPE, SIZE>& GetFactors() const { return _ld; }
+
+private:
+
+    MatrixNxN<TYPE, SIZE> _ld;  ///< combined factors
+    bool _valid = false;        ///< specifies if factors are valid
+
+    /**
+     * \brief Modifies factors so that they become factors of A + alpha*v*v^T.
+     * \param v update vector
+     * \param alpha update scale
+     * \param eps minimum value treated as not-zero
+     * \return mc::Result::Success on success and mc::Result::Failure on failure
+     */
+    Result RankOneModify(const VectorN<TYPE, SIZE>& v, double alpha, double eps)
+    {
+        if (!_valid)
+        {
+            return Result::Failure;
+        }
+
+        VectorN<TYPE, SIZE> w = v;
+        double a = alpha;
+
+        for (unsigned int j = 0; j < SIZE; ++j)
+        {
+            double p = w(j);
+            double d = _ld(j,j);
+            double d_new = d + a * p * p;
+
+            if (fabs(d_new) < fabs(eps))
+            {
+                _valid = false;
+                return Result::Failure;
+            }
+
+            double d_new_inv = 1.0 / d_new;
+            double b = p * a * d_new_inv;
+            a *= d * d_new_inv;
+            _ld(j,j) = d_new;
+
+            for (unsigned int i = j + 1; i < SIZE; ++i)
+            {
+                w(i) -= p * _ld(i,j);
+                _ld(i,j) += b * w(i);
+            }
+        }
+
+        return Result::Success;
+    }
+};
+
+} // namespace mc
+
+#endif // MCUTILS_MATH_LDLT_H_
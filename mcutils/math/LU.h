@@ -0,0 +1,287 @@
+/****************************************************************************//*
+ * Copyright (C) 2026 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_LU_H_
+#define MCUTILS_MATH_LU_H_
+
+#include <cmath>
+#include <utility>
+
+#include <mcutils/Result.h>
+
+#include <mcutils/math/Matrix.h>
+#include <mcutils/math/Vector.h>
+
+namespace mc {
+
+/**
+ * \brief LU factorization with partial pivoting.
+ *
+ * Factorizes matrix once as P*A = L*U, where L is unit lower triangular
+ * and U is upper triangular, both stored in a single matrix. Each solve
+ * against the stored factors is O(n^2), compared to O(n^3) of
+ * SolveGaussJordan(), which pays off when many right hand sides are solved
+ * against the same matrix, e.g. an implicit integrator Jacobian.
+ *
+ * \tparam TYPE matrix element type
+ * \tparam SIZE matrix size
+ *
+ * ### Refernces:
+ * - Press W., et al.: Numerical Recipes: The Art of Scientific Computing, 2007, p.48
+ * - Golub G., Van Loan C.: Matrix Computations, 2013, p.111
+ * - [LU decomposition - Wikipedia](https://en.wikipedia.org/wiki/LU_decomposition)
+ */
+template <typename TYPE, unsigned int SIZE>
+class LU
+{
+public:
+
+    /** \brief Constructor. */
+    LU() = default;
+
+    /**
+     * \brief Constructor, factorizes the given matrix.
+     * \param mtr matrix to be factorized
+     * \param eps minimum value treated as not-zero pivot
+     */
+    explicit LU(const MatrixNxN<TYPE, SIZE>& mtr, double eps = 1.0e-9)
+    {
+        Factorize(mtr, eps);
+    }
+
+    /**
+     * \brief Factorizes the given matrix, replacing previous factors.
+     * Pivot of each column is the element of the largest magnitude on
+     * or below the diagonal.
+     * \param mtr matrix to be factorized
+     * \param eps minimum value treated as not-zero pivot
+     * \return mc::Result::Success on success and mc::Result::Failure if matrix is singular
+     */
+    Result Factorize(const MatrixNxN<TYPE, SIZE>& mtr, double eps = 1.0e-9)
+    {
+        _lu = mtr;
+        _sign = 1;
+        _valid = false;
+
+        for (unsigned int i = 0; i < SIZE; ++i)
+        {
+            _perm[i] = i;
+        }
+
+        for (unsigned int k = 0; k < SIZE; ++k)
+        {
+            // searching for the pivot
+            unsigned int p = k;
+            double p_abs = fabs(_lu(k,k));
+            for (unsigned int i = k + 1; i < SIZE; ++i)
+            {
+                double a_abs = fabs(_lu(i,k));
+                if (a_abs > p_abs)
+                {
+                    p = i;
+                    p_abs = a_abs;
+                }
+            }
+
+            if (p_abs < fabs(eps))
+            {
+                return Result::Failure;
+            }
+
+            if (p != k)
+            {
+                _lu.SwapRows(k, p);
+                std::swap(_perm[k], _perm[p]);
+                _sign = -_sign;
+            }
+
+            // eliminating elements below the pivot, multipliers are stored in their place
+            double a_kk_inv = 1.0 / _lu(k,k);
+            for (unsigned int i = k + 1; i < SIZE; ++i)
+            {
+                double l_ik = _lu(i,k) * a_kk_inv;
+                _lu(i,k) = l_ik;
+                for (unsigned int j = k + 1; j < SIZE; ++j)
+                {
+                    _lu(i,j) -= l_ik * _lu(k,j);
+                }
+            }
+        }
+
+        _valid = true;
+
+        return Result::Success;
+    }
+
+    /**
+     * \brief Solves system of linear equations using stored factors.
+     * \param rhs right hand side vector
+     * \param x result vector, may be the right hand side vector
+     * \return mc::Result::Success on success and mc::Result::Failure if there are no valid factors
+     */
+    Result Solve(const VectorN<TYPE, SIZE>& rhs, VectorN<TYPE, SIZE>* x) const
+    {
+        if (!_valid)
+        {
+            return Result::Failure;
+        }
+
+        VectorN<TYPE, SIZE> y;
+
+        // forward substitution, L*y = P*b
+        for (unsigned int i = 0; i < SIZE; ++i)
+        {
+            TYPE sum = rhs(_perm[i]);
+            for (unsigned int k = 0; k < i; ++k)
+            {
+                sum -= _lu(i,k) * y(k);
+            }
+            y(i) = sum;
+        }
+
+        // back substitution, U*x = y
+        for (unsigned int i = SIZE; i-- > 0;)
+        {
+            TYPE sum = y(i);
+            for (unsigned int k = i + 1; k < SIZE; ++k)
+            {
+                sum -= _lu(i,k) * y(k);
+            }
+            y(i) = sum / _lu(i,i);
+        }
+
+        *x = y;
+
+        return Result::Success;
+    }
+
+    /**
+     * \brief Solves system of linear equations for many right hand sides at once.
+     * Rows are processed as a whole, so the inner loop goes along contiguous memory.
+     * \param rhs right hand side matrix, each column is a separate right hand side
+     * \param x result matrix, may be the right hand side matrix
+     * \return mc::Result::Success on success and mc::Result::Failure if there are no valid factors
+     */
+    template <unsigned int COLS>
+    Result Solve(const MatrixMxN<TYPE, SIZE, COLS>& rhs, MatrixMxN<TYPE, SIZE, COLS>* x) const
+    {
+        if (!_valid)
+        {
+            return Result::Failure;
+        }
+
+        MatrixMxN<TYPE, SIZE, COLS> y;
+
+        // forward substitution, L*Y = P*B
+        for (unsigned int i = 0; i < SIZE; ++i)
+        {
+            for (unsigned int c = 0; c < COLS; ++c)
+            {
+                y(i,c) = rhs(_perm[i],c);
+            }
+            for (unsigned int k = 0; k < i; ++k)
+            {
+                double l_ik = _lu(i,k);
+                for (unsigned int c = 0; c < COLS; ++c)
+                {
+                    y(i,c) -= l_ik * y(k,c);
+                }
+            }
+        }
+
+        // back substitution, U*X = Y
+        for (unsigned int i = SIZE; i-- > 0;)
+        {
+            for (unsigned int k = i + 1; k < SIZE; ++k)
+            {
+                double u_ik = _lu(i,k);
+                for (unsigned int c = 0; c < COLS; ++c)
+                {
+                    y(i,c) -= u_ik * y(k,c);
+                }
+            }
+            double u_ii_inv = 1.0 / _lu(i,i);
+            for (unsigned int c = 0; c < COLS; ++c)
+            {
+                y(i,c) *= u_ii_inv;
+            }
+        }
+
+        *x = y;
+
+        return Result::Success;
+    }
+
+    /**
+     * \brief Calculates inverse matrix using stored factors.
+     * \param inv result inverse matrix
+     * \return mc::Result::Success on success and mc::Result::Failure if there are no valid factors
+     */
+    Result GetInverse(MatrixNxN<TYPE, SIZE>* inv) const
+    {
+        if (!_valid)
+        {
+            return Result::Failure;
+        }
+
+        *inv = MatrixNxN<TYPE, SIZE>::GetIdentityMatrix();
+        return Solve(*inv, inv);
+    }
+
+    /**
+     * \brief Returns determinant calculated from stored factors.
+     * \return determinant, zero if matrix is singular
+     */
+    double GetDeterminant() const
+    {
+        if (!_valid)
+        {
+            return 0.0;
+        }
+
+        double det = _sign;
+        for (unsigned int i = 0; i < SIZE; ++i)
+        {
+            det *= _lu(i,i);
+        }
+        return det;
+    }
+
+    /** \return true if factors are valid, false if matrix is singular or was not factorized */
+    inline bool IsValid() const { return _valid; }
+
+    /** \return combined factors, L below and U on and above the diagonal */
+    inline const MatrixNxN<TYPE, SIZE>& GetFactors() const { return _lu; }
+
+    /** \return index of the original row at the given row of factors */
+    inline unsigned int GetPermutation(unsigned int row) const { return _perm[row]; }
+
+private:
+
+    MatrixNxN<TYPE, SIZE> _lu;          ///< combined factors
+    unsigned int _perm[SIZE] = { 0 };   ///< row permutation
+    int _sign = 1;                      ///< permutation sign
+    bool _valid = false;                ///< specifies if factors are valid
+};
+
+} // namespace mc
+
+#endif // MCUTILS_MATH_LU_H_
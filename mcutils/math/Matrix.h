@@ -31,6 +31,7 @@
 #include <mcutils/math/MatrixMxN.h>
 #include <mcutils/math/MatrixNxN.h>
 #include <mcutils/math/Matrix3x3.h>
+#include <mcutils/math/MatrixX.h>
 #include <mcutils/math/RMatrix.h>
 
 namespace mc {
@@ -38,6 +39,7 @@ namespace mc {
 using Matrix3x3d = Matrix3x3<double>;
 using Matrix4x4d = MatrixNxN<double, 4>;
 using Matrix6x6d = MatrixNxN<double, 6>;
+using MatrixXd = MatrixX<double>;
 
 } // namespace mc
 
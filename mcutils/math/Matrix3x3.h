@@ -35,7 +35,7 @@ class Matrix3x3 : public MatrixNxN<TYPE, 3>
 public:
 
     /** \brief Creates identity matrix. */
-    static Matrix3x3<TYPE> GetIdentityMatrix()
+    static constexpr Matrix3x3<TYPE> GetIdentityMatrix()
     {
         return Matrix3x3<TYPE>(TYPE{1}, TYPE{0}, TYPE{0},
                                TYPE{0}, TYPE{1}, TYPE{0},
@@ -43,9 +43,9 @@ public:
     }
 
     /** \brief Constructor. */
-    Matrix3x3(TYPE xx = TYPE{0}, TYPE xy = TYPE{0}, TYPE xz = TYPE{0},
-              TYPE yx = TYPE{0}, TYPE yy = TYPE{0}, TYPE yz = TYPE{0},
-              TYPE zx = TYPE{0}, TYPE zy = TYPE{0}, TYPE zz = TYPE{0})
+    constexpr Matrix3x3(TYPE xx = TYPE{0}, TYPE xy = TYPE{0}, TYPE xz = TYPE{0},
+                        TYPE yx = TYPE{0}, TYPE yy = TYPE{0}, TYPE yz = TYPE{0},
+                        TYPE zx = TYPE{0}, TYPE zy = TYPE{0}, TYPE zz = TYPE{0})
     {
         Set(xx, xy, xz, yx, yy, yz, zx, zy, zz);
     }
@@ -62,9 +62,9 @@ public:
      * \param zy item at position zy
      * \param zz item at position zz
      */
-    void Set(TYPE xx, TYPE xy, TYPE xz,
-             TYPE yx, TYPE yy, TYPE yz,
-             TYPE zx, TYPE zy, TYPE zz)
+    constexpr void Set(TYPE xx, TYPE xy, TYPE xz,
+                       TYPE yx, TYPE yy, TYPE yz,
+                       TYPE zx, TYPE zy, TYPE zz)
     {
         this->_elements[0] = xx;
         this->_elements[1] = xy;
@@ -77,28 +77,28 @@ public:
         this->_elements[8] = zz;
     }
 
-    inline TYPE xx() const { return this->_elements[0]; }
-    inline TYPE xy() const { return this->_elements[1]; }
-    inline TYPE xz() const { return this->_elements[2]; }
-    inline TYPE yx() const { return this->_elements[3]; }
-    inline TYPE yy() const { return this->_elements[4]; }
-    inline TYPE yz() const { return this->_elements[5]; }
-    inline TYPE zx() const { return this->_elements[6]; }
-    inline TYPE zy() const { return this->_elements[7]; }
-    inline TYPE zz() const { return this->_elements[8]; }
-
-    inline TYPE& xx() { return this->_elements[0]; }
-    inline TYPE& xy() { return this->_elements[1]; }
-    inline TYPE& xz() { return this->_elements[2]; }
-    inline TYPE& yx() { return this->_elements[3]; }
-    inline TYPE& yy() { return this->_elements[4]; }
-    inline TYPE& yz() { return this->_elements[5]; }
-    inline TYPE& zx() { return this->_elements[6]; }
-    inline TYPE& zy() { return this->_elements[7]; }
-    inline TYPE& zz() { return this->_elements[8]; }
+    constexpr TYPE xx() const { return this->_elements[0]; }
+    constexpr TYPE xy() const { return this->_elements[1]; }
+    constexpr TYPE xz() const { return this->_elements[2]; }
+    constexpr TYPE yx() const { return this->_elements[3]; }
+    constexpr TYPE yy() const { return this->_elements[4]; }
+    constexpr TYPE yz() const { return this->_elements[5]; }
+    constexpr TYPE zx() const { return this->_elements[6]; }
+    constexpr TYPE zy() const { return this->_elements[7]; }
+    constexpr TYPE zz() const { return this->_elements[8]; }
+
+    constexpr TYPE& xx() { return this->_elements[0]; }
+    constexpr TYPE& xy() { return this->_elements[1]; }
+    constexpr TYPE& xz() { return this->_elements[2]; }
+    constexpr TYPE& yx() { return this->_elements[3]; }
+    constexpr TYPE& yy() { return this->_elements[4]; }
+    constexpr TYPE& yz() { return this->_elements[5]; }
+    constexpr TYPE& zx() { return this->_elements[6]; }
+    constexpr TYPE& zy() { return this->_elements[7]; }
+    constexpr TYPE& zz() { return this->_elements[8]; }
 
     /** \brief Returns transposed matrix. */
-    Matrix3x3<TYPE> GetTransposed() const
+    constexpr Matrix3x3<TYPE> GetTransposed() const
     {
         Matrix3x3<TYPE> result(*this);
         result.Transpose();
@@ -106,7 +106,7 @@ public:
     }
 
     /** \brief Addition operator. */
-    Matrix3x3<TYPE> operator+(const Matrix3x3<TYPE>& matrix) const
+    constexpr Matrix3x3<TYPE> operator+(const Matrix3x3<TYPE>& matrix) const
     {
         Matrix3x3<TYPE> result(*this);
         result.Add(matrix);
@@ -114,7 +114,7 @@ public:
     }
 
     /** \brief Negation operator. */
-    Matrix3x3<TYPE> operator-() const
+    constexpr Matrix3x3<TYPE> operator-() const
     {
         Matrix3x3<TYPE> result(*this);
         result.Negate();
@@ -122,7 +122,7 @@ public:
     }
 
     /** \brief Subtraction operator. */
-    Matrix3x3<TYPE> operator-(const Matrix3x3<TYPE>& matrix) const
+    constexpr Matrix3x3<TYPE> operator-(const Matrix3x3<TYPE>& matrix) const
     {
         Matrix3x3<TYPE> result(*this);
         result.Substract(matrix);
@@ -130,7 +130,7 @@ public:
     }
 
     /** \brief Multiplication operator (by number). */
-    Matrix3x3<TYPE> operator*(double value) const
+    constexpr Matrix3x3<TYPE> operator*(double value) const
     {
         Matrix3x3<TYPE> result(*this);
         result.MultiplyByValue(value);
@@ -138,7 +138,7 @@ public:
     }
 
     /** \brief Multiplication operator (by matrix). */
-    Matrix3x3<TYPE> operator*(const Matrix3x3<TYPE>& matrix) const
+    constexpr Matrix3x3<TYPE> operator*(const Matrix3x3<TYPE>& matrix) const
     {
         Matrix3x3<TYPE> result;
         this->MultiplyByMatrix(matrix, &result);
@@ -146,7 +146,7 @@ public:
     }
 
     /** \brief Multiplication operator (by vector). */
-    Vector3<TYPE> operator*(const Vector3<TYPE>& vect) const
+    constexpr Vector3<TYPE> operator*(const Vector3<TYPE>& vect) const
     {
         Vector3<TYPE> result;
         this->MultiplyByVector(vect, &result);
@@ -154,7 +154,7 @@ public:
     }
 
     /** \brief Division operator (by number). */
-    Matrix3x3<TYPE> operator/(double value) const
+    constexpr Matrix3x3<TYPE> operator/(double value) const
     {
         Matrix3x3<TYPE> result(*this);
         result.DivideByValue(value);
@@ -162,37 +162,61 @@ public:
     }
 
     /** \brief Unary addition operator. */
-    Matrix3x3<TYPE>& operator+=(const Matrix3x3<TYPE>& matrix)
+    constexpr Matrix3x3<TYPE>& operator+=(const Matrix3x3<TYPE>& matrix)
     {
         this->Add(matrix);
         return *this;
     }
 
     /** \brief Unary subtraction operator. */
-    Matrix3x3<TYPE>& operator-=(const Matrix3x3<TYPE>& matrix)
+    constexpr Matrix3x3<TYPE>& operator-=(const Matrix3x3<TYPE>& matrix)
     {
         this->Substract(matrix);
         return *this;
     }
 
     /** \brief Unary multiplication operator (by number). */
-    Matrix3x3<TYPE>& operator*=(double value)
+    constexpr Matrix3x3<TYPE>& operator*=(double value)
     {
         this->MultiplyByValue(value);
         return *this;
     }
 
     /** \brief Unary division operator (by number). */
-    Matrix3x3<TYPE>& operator/=(double value)
+    constexpr Matrix3x3<TYPE>& operator/=(double value)
     {
         this->DivideByValue(value);
         return *this;
     }
+
+protected:
+
+    /**
+     * \brief Multiplies matrix by matrix.
+     * Products are written out explicitly, which makes it usable in constant
+     * expressions and is as fast as MatrixKernels::Multiply() for 3x3.
+     * \param matrix right-hand side matrix
+     * \param result result matrix, must not be this matrix nor the given matrix
+     */
+    constexpr void MultiplyByMatrix(const Matrix3x3<TYPE>& matrix, Matrix3x3<TYPE>* result) const
+    {
+        result->Set(xx() * matrix.xx() + xy() * matrix.yx() + xz() * matrix.zx(),
+                    xx() * matrix.xy() + xy() * matrix.yy() + xz() * matrix.zy(),
+                    xx() * matrix.xz() + xy() * matrix.yz() + xz() * matrix.zz(),
+
+                    yx() * matrix.xx() + yy() * matrix.yx() + yz() * matrix.zx(),
+                    yx() * matrix.xy() + yy() * matrix.yy() + yz() * matrix.zy(),
+                    yx() * matrix.xz() + yy() * matrix.yz() + yz() * matrix.zz(),
+
+                    zx() * matrix.xx() + zy() * matrix.yx() + zz() * matrix.zx(),
+                    zx() * matrix.xy() + zy() * matrix.yy() + zz() * matrix.zy(),
+                    zx() * matrix.xz() + zy() * matrix.yz() + zz() * matrix.zz());
+    }
 };
 
 /** \brief Multiplication operator (by number). */
 template <typename TYPE>
-inline Matrix3x3<TYPE> operator*(double value, const Matrix3x3<TYPE>& matrix)
+constexpr Matrix3x3<TYPE> operator*(double value, const Matrix3x3<TYPE>& matrix)
 {
     return matrix * value;
 }
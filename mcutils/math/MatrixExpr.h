@@ -0,0 +1,310 @@
+/****************************************************************************//*
+ * Copyright (C) 2026 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_MATRIXEXPR_H_
+#define MCUTILS_MATH_MATRIXEXPR_H_
+
+#include <type_traits>
+#include <utility>
+
+#include <mcutils/math/MatrixMxN.h>
+#include <mcutils/math/VectorExpr.h>
+
+namespace mc {
+
+/**
+ * \brief Matrix expression base class template.
+ *
+ * Matrix expressions are built of MatrixTerm objects combined with addition,
+ * subtraction and multiplication by number. Matrix expression multiplied by
+ * vector expression gives vector expression, so state space update such as
+ * (MatrixTerm(a) * VectorTerm(x) + MatrixTerm(b) * VectorTerm(u)) is
+ * evaluated in a single pass when it is assigned to a vector, without any
+ * intermediate vectors. Products of matrices are not part of expressions,
+ * MatrixMxN multiplication operator should be used for them.
+ *
+ * Expressions refer to the matrices of their terms, which therefore have to
+ * outlive the expression.
+ *
+ * \tparam DERIVED derived expression type
+ */
+template <typename DERIVED>
+class MatrixExpr
+{
+public:
+
+    /** \return derived expression */
+    inline const DERIVED& derived() const
+    {
+        return static_cast<const DERIVED&>(*this);
+    }
+
+    /**
+     * \brief Evaluates expression into the given matrix.
+     * \param result output matrix
+     */
+    template <typename TYPE, unsigned int ROWS, unsigned int COLS>
+    void AssignTo(MatrixMxN<TYPE, ROWS, COLS>* result) const
+    {
+        static_assert(ROWS == DERIVED::kRows && COLS == DERIVED::kCols, "Matrix sizes must match");
+
+        for (unsigned int r = 0; r < ROWS; ++r)
+        {
+            for (unsigned int c = 0; c < COLS; ++c)
+            {
+                (*result)(r, c) = derived()(r, c);
+            }
+        }
+    }
+
+    /** \return matrix of the expression elements */
+    auto Evaluate() const
+    {
+        MatrixMxN<typename DERIVED::ValType, DERIVED::kRows, DERIVED::kCols> result;
+        AssignTo(&result);
+        return result;
+    }
+
+    /**
+     * \brief Converts expression to matrix, see AssignTo().
+     * \tparam MATRIX matrix type, MatrixMxN or one of its derived classes
+     */
+    template <typename MATRIX, typename EXPR = DERIVED,
+              typename std::enable_if<std::is_base_of<MatrixMxN<typename EXPR::ValType, EXPR::kRows, EXPR::kCols>, MATRIX>::value, int>::type = 0>
+    operator MATRIX() const
+    {
+        MATRIX result;
+        AssignTo(&result);
+        return result;
+    }
+
+protected:
+
+    MatrixExpr() = default;
+};
+
+/**
+ * \brief Matrix expression term.
+ * Refers to the matrix, which therefore has to outlive the expression.
+ */
+template <typename TYPE, unsigned int ROWS, unsigned int COLS>
+class MatrixTerm : public MatrixExpr<MatrixTerm<TYPE, ROWS, COLS>>
+{
+public:
+
+    using ValType = TYPE;
+
+    static constexpr unsigned int kRows = ROWS; ///< number of rows
+    static constexpr unsigned int kCols = COLS; ///< number of columns
+
+    /**
+     * \brief Constructor.
+     * \param matrix matrix
+     */
+    explicit MatrixTerm(const MatrixMxN<TYPE, ROWS, COLS>& matrix)
+        : _matrix(&matrix)
+    {}
+
+    /** \brief Elements accessor. */
+    inline double operator()(unsigned int row, unsigned int col) const
+    {
+        return (*_matrix)(row, col);
+    }
+
+private:
+
+    const MatrixMxN<TYPE, ROWS, COLS>* _matrix = nullptr;   ///< matrix
+};
+
+/**
+ * \brief Matrix expression multiplied by number.
+ */
+template <typename EXPR>
+class MatrixScaled : public MatrixExpr<MatrixScaled<EXPR>>
+{
+public:
+
+    using ValType = typename EXPR::ValType;
+
+    static constexpr unsigned int kRows = EXPR::kRows; ///< number of rows
+    static constexpr unsigned int kCols = EXPR::kCols; ///< number of columns
+
+    /**
+     * \brief Constructor.
+     * \param expr expression
+     * \param factor factor
+     */
+    MatrixScaled(const EXPR& expr, double factor)
+        : _expr(expr)
+        , _factor(factor)
+    {}
+
+    /** \brief Elements accessor. */
+    inline double operator()(unsigned int row, unsigned int col) const
+    {
+        return _expr(row, col) * _factor;
+    }
+
+private:
+
+    EXPR _expr;         ///< expression
+    double _factor;     ///< factor
+};
+
+/**
+ * \brief Sum of matrix expressions.
+ */
+template <typename LHS, typename RHS>
+class MatrixSum : public MatrixExpr<MatrixSum<LHS, RHS>>
+{
+public:
+
+    static_assert(LHS::kRows == RHS::kRows && LHS::kCols == RHS::kCols, "Matrix sizes must match");
+    static_assert(std::is_same<typename LHS::ValType, typename RHS::ValType>::value, "Value types must match");
+
+    using ValType = typename LHS::ValType;
+
+    static constexpr unsigned int kRows = LHS::kRows; ///< number of rows
+    static constexpr unsigned int kCols = LHS::kCols; ///< number of columns
+
+    /**
+     * \brief Constructor.
+     * \param lhs left hand side operand
+     * \param rhs right hand side operand
+     */
+    MatrixSum(const LHS& lhs, const RHS& rhs)
+        : _lhs(lhs)
+        , _rhs(rhs)
+    {}
+
+    /** \brief Elements accessor. */
+    inline double operator()(unsigned int row, unsigned int col) const
+    {
+        return _lhs(row, col) + _rhs(row, col);
+    }
+
+private:
+
+    LHS _lhs;   ///< left hand side operand
+    RHS _rhs;   ///< right hand side operand
+};
+
+/**
+ * \brief Matrix expression multiplied by vector expression.
+ * Vector operand is evaluated once on construction, so that it is neither
+ * recomputed for every row nor affected by assigning the product to one
+ * of its terms, e.g. x = MatrixTerm(a) * VectorTerm(x).
+ */
+template <typename MTX, typename VEC>
+class MatrixVectorProduct : public VectorExpr<MatrixVectorProduct<MTX, VEC>>
+{
+public:
+
+    static_assert(MTX::kCols == VEC::kSize, "Matrix columns count must match vector size");
+
+    using ValType = decltype(std::declval<const MTX&>()(0, 0) * std::declval<typename VEC::ValType>());
+
+    static constexpr unsigned int kSize = MTX::kRows; ///< vector size
+
+    /**
+     * \brief Constructor.
+     * \param mtx matrix operand
+     * \param vec vector operand
+     */
+    MatrixVectorProduct(const MTX& mtx, const VEC& vec)
+        : _mtx(mtx)
+    {
+        for (unsigned int i = 0; i < MTX::kCols; ++i)
+        {
+            _vec[i] = vec(i);
+        }
+    }
+
+    /** \brief Items accessor. */
+    inline ValType operator()(unsigned int index) const
+    {
+        ValType sum = ValType{0};
+        MCUTILS_MATRIX_KERNELS_UNROLL
+        for (unsigned int i = 0; i < MTX::kCols; ++i)
+        {
+            sum += _mtx(index, i) * _vec[i];
+        }
+        return sum;
+    }
+
+private:
+
+    MTX _mtx;                                       ///< matrix operand
+    typename VEC::ValType _vec[MTX::kCols] = {};    ///< evaluated vector operand
+};
+
+/** \brief Addition operator. */
+template <typename LHS, typename RHS>
+inline MatrixSum<LHS, RHS> operator+(const MatrixExpr<LHS>& lhs, const MatrixExpr<RHS>& rhs)
+{
+    return MatrixSum<LHS, RHS>(lhs.derived(), rhs.derived());
+}
+
+/** \brief Subtraction operator. */
+template <typename LHS, typename RHS>
+inline MatrixSum<LHS, MatrixScaled<RHS>> operator-(const MatrixExpr<LHS>& lhs, const MatrixExpr<RHS>& rhs)
+{
+    return MatrixSum<LHS, MatrixScaled<RHS>>(lhs.derived(), MatrixScaled<RHS>(rhs.derived(), -1.0));
+}
+
+/** \brief Negation operator. */
+template <typename EXPR>
+inline MatrixScaled<EXPR> operator-(const MatrixExpr<EXPR>& expr)
+{
+    return MatrixScaled<EXPR>(expr.derived(), -1.0);
+}
+
+/** \brief Multiplication operator (by number). */
+template <typename EXPR>
+inline MatrixScaled<EXPR> operator*(const MatrixExpr<EXPR>& expr, double val)
+{
+    return MatrixScaled<EXPR>(expr.derived(), val);
+}
+
+/** \brief Multiplication operator (by number). */
+template <typename EXPR>
+inline MatrixScaled<EXPR> operator*(double val, const MatrixExpr<EXPR>& expr)
+{
+    return MatrixScaled<EXPR>(expr.derived(), val);
+}
+
+/** \brief Division operator (by number). */
+template <typename EXPR>
+inline MatrixScaled<EXPR> operator/(const MatrixExpr<EXPR>& expr, double val)
+{
+    return MatrixScaled<EXPR>(expr.derived(), 1.0 / val);
+}
+
+/** \brief Multiplication operator (by vector). */
+template <typename MTX, typename VEC>
+inline MatrixVectorProduct<MTX, VEC> operator*(const MatrixExpr<MTX>& mtx, const VectorExpr<VEC>& vec)
+{
+    return MatrixVectorProduct<MTX, VEC>(mtx.derived(), vec.derived());
+}
+
+} // namespace mc
+
+#endif // MCUTILS_MATH_MATRIXEXPR_H_
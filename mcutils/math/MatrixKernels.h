@@ -0,0 +1,343 @@
+/****************************************************************************//*
+ * Copyright (C) 2026 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_MATRIXKERNELS_H_
+#define MCUTILS_MATH_MATRIXKERNELS_H_
+
+// micro-kernel loops are unrolled regardless of the optimization options,
+// so the accumulators are kept in registers
+#if defined(__GNUC__) || defined(__clang__)
+#   define MCUTILS_MATRIX_KERNELS_UNROLL   _Pragma("GCC unroll 16")
+#   define MCUTILS_MATRIX_KERNELS_UNROLL_K _Pragma("GCC unroll 4")
+#else
+#   define MCUTILS_MATRIX_KERNELS_UNROLL
+#   define MCUTILS_MATRIX_KERNELS_UNROLL_K
+#endif
+
+#if !defined(MCUTILS_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || defined(__AVX__))
+#   include <immintrin.h>
+#endif
+
+namespace mc {
+namespace MatrixKernels {
+
+constexpr unsigned int kBlockK = 64;    ///< inner dimension block size
+
+/**
+ * \brief Scalar pack.
+ * Pack of a single matrix element, used for element types other than
+ * double, for the columns left over by the vector packs and when SIMD is
+ * not available or disabled with MCUTILS_NO_SIMD.
+ * \tparam TYPE element type
+ */
+template <typename TYPE>
+struct PackScalar
+{
+    using Type = TYPE;
+    using Narrower = void;
+
+    static constexpr unsigned int kLanes = 1;   ///< number of elements
+    static constexpr unsigned int kRows  = 4;   ///< micro-kernel rows
+    static constexpr unsigned int kPacks = 4;   ///< micro-kernel columns expressed in packs
+
+    static inline Type Zero() { return TYPE{0}; }
+    static inline Type Load(const TYPE* ptr) { return *ptr; }
+    static inline Type Broadcast(TYPE value) { return value; }
+    static inline void Store(TYPE* ptr, Type value) { *ptr = value; }
+    static inline Type MulAdd(Type a, Type b, Type c) { return c + a * b; }
+};
+
+#if !defined(MCUTILS_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64))
+/** \brief SSE2 pack of 2 doubles. */
+struct PackSse2
+{
+    using Type = __m128d;
+    using Narrower = PackScalar<double>;
+
+    static constexpr unsigned int kLanes = 2;
+    static constexpr unsigned int kRows  = 4;
+    static constexpr unsigned int kPacks = 2;
+
+    static inline Type Zero() { return _mm_setzero_pd(); }
+    static inline Type Load(const double* ptr) { return _mm_loadu_pd(ptr); }
+    static inline Type Broadcast(double value) { return _mm_set1_pd(value); }
+    static inline void Store(double* ptr, Type value) { _mm_storeu_pd(ptr, value); }
+#   if defined(__FMA__)
+    static inline Type MulAdd(Type a, Type b, Type c) { return _mm_fmadd_pd(a, b, c); }
+#   else
+    static inline Type MulAdd(Type a, Type b, Type c) { return _mm_add_pd(c, _mm_mul_pd(a, b)); }
+#   endif
+};
+#   define MCUTILS_MATRIX_KERNELS_PACK_SSE2
+#endif
+
+#if !defined(MCUTILS_NO_SIMD) && defined(__AVX__) && defined(MCUTILS_MATRIX_KERNELS_PACK_SSE2)
+/** \brief AVX pack of 4 doubles. */
+struct PackAvx
+{
+    using Type = __m256d;
+    using Narrower = PackSse2;
+
+    static constexpr unsigned int kLanes = 4;
+    static constexpr unsigned int kRows  = 4;
+    static constexpr unsigned int kPacks = 2;
+
+    static inline Type Zero() { return _mm256_setzero_pd(); }
+    static inline Type Load(const double* ptr) { return _mm256_loadu_pd(ptr); }
+    static inline Type Broadcast(double value) { return _mm256_set1_pd(value); }
+    static inline void Store(double* ptr, Type value) { _mm256_storeu_pd(ptr, value); }
+#   if defined(__FMA__)
+    static inline Type MulAdd(Type a, Type b, Type c) { return _mm256_fmadd_pd(a, b, c); }
+#   else
+    static inline Type MulAdd(Type a, Type b, Type c) { return _mm256_add_pd(c, _mm256_mul_pd(a, b)); }
+#   endif
+};
+#   define MCUTILS_MATRIX_KERNELS_PACK_AVX
+#endif
+
+#if !defined(MCUTILS_NO_SIMD) && defined(__AVX512F__) && defined(MCUTILS_MATRIX_KERNELS_PACK_AVX)
+/** \brief AVX-512 pack of 8 doubles. */
+struct PackAvx512
+{
+    using Type = __m512d;
+    using Narrower = PackAvx;
+
+    static constexpr unsigned int kLanes = 8;
+    static constexpr unsigned int kRows  = 4;
+    static constexpr unsigned int kPacks = 4;
+
+    static inline Type Zero() { return _mm512_setzero_pd(); }
+    static inline Type Load(const double* ptr) { return _mm512_loadu_pd(ptr); }
+    static inline Type Broadcast(double value) { return _mm512_set1_pd(value); }
+    static inline void Store(double* ptr, Type value) { _mm512_storeu_pd(ptr, value); }
+    static inline Type MulAdd(Type a, Type b, Type c) { return _mm512_fmadd_pd(a, b, c); }
+};
+#   define MCUTILS_MATRIX_KERNELS_PACK_AVX512
+#endif
+
+/**
+ * \brief The widest pack available for the given element type.
+ * \tparam TYPE element type
+ */
+template <typename TYPE>
+struct WidestPack
+{
+    using Type = PackScalar<TYPE>;
+};
+
+/** \brief The widest pack available for doubles. */
+template <>
+struct WidestPack<double>
+{
+#if defined(MCUTILS_MATRIX_KERNELS_PACK_AVX512)
+    using Type = PackAvx512;
+#elif defined(MCUTILS_MATRIX_KERNELS_PACK_AVX)
+    using Type = PackAvx;
+#elif defined(MCUTILS_MATRIX_KERNELS_PACK_SSE2)
+    using Type = PackSse2;
+#else
+    using Type = PackScalar<double>;
+#endif
+};
+
+/**
+ * \brief Multiplies block of ROWS x PACKS*kLanes result elements.
+ * All the block elements are accumulated in registers, each loaded
+ * right-hand side pack is used ROWS times and each broadcast left-hand side
+ * element PACKS times.
+ * \tparam PACK pack type
+ * \tparam ROWS number of block rows
+ * \tparam PACKS number of block columns expressed in packs
+ * \tparam LDA left-hand side matrix leading dimension (number of columns)
+ * \tparam LDB right-hand side and result matrices leading dimension
+ * \tparam K number of products to accumulate
+ * \param a left-hand side matrix block first element
+ * \param b right-hand side matrix block first element
+ * \param c result matrix block first element
+ * \param accumulate specifies if result is added to the existing result values
+ */
+template <typename PACK, unsigned int ROWS, unsigned int PACKS,
+          unsigned int LDA, unsigned int LDB, unsigned int K, typename TYPE>
+inline void MultiplyBlock(const TYPE* a, const TYPE* b, TYPE* c, bool accumulate)
+{
+    constexpr unsigned int kLanes = PACK::kLanes;
+
+    typename PACK::Type acc[ROWS][PACKS];
+
+    MCUTILS_MATRIX_KERNELS_UNROLL
+    for (unsigned int r = 0; r < ROWS; ++r)
+    {
+        MCUTILS_MATRIX_KERNELS_UNROLL
+        for (unsigned int p = 0; p < PACKS; ++p)
+        {
+            acc[r][p] = accumulate ? PACK::Load(c + r * LDB + p * kLanes) : PACK::Zero();
+        }
+    }
+
+    MCUTILS_MATRIX_KERNELS_UNROLL_K
+    for (unsigned int i = 0; i < K; ++i)
+    {
+        typename PACK::Type bp[PACKS];
+
+        MCUTILS_MATRIX_KERNELS_UNROLL
+        for (unsigned int p = 0; p < PACKS; ++p)
+        {
+            bp[p] = PACK::Load(b + i * LDB + p * kLanes);
+        }
+
+        MCUTILS_MATRIX_KERNELS_UNROLL
+        for (unsigned int r = 0; r < ROWS; ++r)
+        {
+            const typename PACK::Type ar = PACK::Broadcast(a[r * LDA + i]);
+
+            MCUTILS_MATRIX_KERNELS_UNROLL
+            for (unsigned int p = 0; p < PACKS; ++p)
+            {
+                acc[r][p] = PACK::MulAdd(ar, bp[p], acc[r][p]);
+            }
+        }
+    }
+
+    MCUTILS_MATRIX_KERNELS_UNROLL
+    for (unsigned int r = 0; r < ROWS; ++r)
+    {
+        MCUTILS_MATRIX_KERNELS_UNROLL
+        for (unsigned int p = 0; p < PACKS; ++p)
+        {
+            PACK::Store(c + r * LDB + p * kLanes, acc[r][p]);
+        }
+    }
+}
+
+/**
+ * \brief Multiplies column strip of PACKS*kLanes result elements of all rows.
+ * \tparam M number of rows
+ * \tparam LDA left-hand side matrix leading dimension
+ * \tparam LDB right-hand side and result matrices leading dimension
+ */
+template <typename PACK, unsigned int PACKS, unsigned int M,
+          unsigned int LDA, unsigned int LDB, unsigned int K, typename TYPE>
+inline void MultiplyStrip(const TYPE* a, const TYPE* b, TYPE* c, bool accumulate)
+{
+    constexpr unsigned int kRows = PACK::kRows;
+    constexpr unsigned int kFull = M / kRows * kRows;
+
+    for (unsigned int r = 0; r < kFull; r += kRows)
+    {
+        MultiplyBlock<PACK, kRows, PACKS, LDA, LDB, K>(a + r * LDA, b, c + r * LDB, accumulate);
+    }
+
+    if constexpr (kFull < M)
+    {
+        MultiplyBlock<PACK, M - kFull, PACKS, LDA, LDB, K>(a + kFull * LDA, b, c + kFull * LDB, accumulate);
+    }
+}
+
+/**
+ * \brief Multiplies result columns from COL to the last one.
+ * Columns are covered with strips of the widest pack first, columns left
+ * are passed to the narrower pack.
+ * \tparam PACK pack type
+ * \tparam COL first column
+ * \tparam M number of rows
+ * \tparam N number of columns
+ * \tparam LDA left-hand side matrix leading dimension
+ * \tparam K number of products to accumulate
+ */
+template <typename PACK, unsigned int COL, unsigned int M, unsigned int N,
+          unsigned int LDA, unsigned int K, typename TYPE>
+inline void MultiplyColumns(const TYPE* a, const TYPE* b, TYPE* c, bool accumulate)
+{
+    constexpr unsigned int kLanes = PACK::kLanes;
+    constexpr unsigned int kStrip = PACK::kPacks * kLanes;
+    constexpr unsigned int kFull  = COL + (N - COL) / kStrip * kStrip;
+    constexpr unsigned int kRest  = (N - kFull) / kLanes;
+    constexpr unsigned int kNext  = kFull + kRest * kLanes;
+
+    for (unsigned int col = COL; col < kFull; col += kStrip)
+    {
+        MultiplyStrip<PACK, PACK::kPacks, M, LDA, N, K>(a, b + col, c + col, accumulate);
+    }
+
+    if constexpr (kRest > 0)
+    {
+        MultiplyStrip<PACK, kRest, M, LDA, N, K>(a, b + kFull, c + kFull, accumulate);
+    }
+
+    if constexpr (kNext < N)
+    {
+        MultiplyColumns<typename PACK::Narrower, kNext, M, N, LDA, K>(a, b, c, accumulate);
+    }
+}
+
+/**
+ * \brief Multiplies matrices.
+ * Computes result = lhs * rhs, where all the matrices are stored in
+ * row-major order. Result is computed by register blocks, which are
+ * vectorized with the widest SIMD instruction set enabled by the compiler
+ * options (AVX-512, AVX, SSE2). Scalar code is used for the element types
+ * other than double or if MCUTILS_NO_SIMD is defined. Inner dimension is
+ * split into blocks of kBlockK, so large right-hand side matrices are
+ * processed by panels fitting in cache.
+ * Result must not overlap the operands.
+ * \tparam TYPE element type
+ * \tparam M number of lhs rows
+ * \tparam K number of lhs columns and rhs rows
+ * \tparam N number of rhs columns
+ * \param lhs left-hand side matrix elements
+ * \param rhs right-hand side matrix elements
+ * \param result result matrix elements
+ */
+template <typename TYPE, unsigned int M, unsigned int K, unsigned int N>
+inline void Multiply(const TYPE* lhs, const TYPE* rhs, TYPE* result)
+{
+    if constexpr (M > 0 && N > 0)
+    {
+        if constexpr (K == 0)
+        {
+            for (unsigned int i = 0; i < M * N; ++i)
+            {
+                result[i] = TYPE{0};
+            }
+        }
+        else
+        {
+            using Pack = typename WidestPack<TYPE>::Type;
+
+            constexpr unsigned int kFull = K / kBlockK * kBlockK;
+
+            for (unsigned int k0 = 0; k0 < kFull; k0 += kBlockK)
+            {
+                MultiplyColumns<Pack, 0, M, N, K, kBlockK>(lhs + k0, rhs + k0 * N, result, k0 > 0);
+            }
+
+            if constexpr (kFull < K)
+            {
+                MultiplyColumns<Pack, 0, M, N, K, K - kFull>(lhs + kFull, rhs + kFull * N, result, kFull > 0);
+            }
+        }
+    }
+}
+
+} // namespace MatrixKernels
+} // namespace mc
+
+#endif // MCUTILS_MATH_MATRIXKERNELS_H_
@@ -25,9 +25,11 @@
 #include <limits>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
+#include <mcutils/math/MatrixKernels.h>
 #include <mcutils/math/Vector.h>
 #include <mcutils/misc/Check.h>
 #include <mcutils/misc/String.h>
@@ -43,6 +45,8 @@ namespace mc {
 template <typename TYPE, unsigned int ROWS, unsigned int COLS>
 class MatrixMxN
 {
+    template <typename, unsigned int, unsigned int> friend class MatrixMxN;
+
 public:
 
     static constexpr unsigned int kRows = ROWS;        ///< number of rows
@@ -53,7 +57,7 @@ public:
      * \brief Fills all matrix elements with the given value.
      * \param value given value to fill all matrix elements
      */
-    void Fill(double value)
+    constexpr void Fill(double value)
     {
         for (unsigned int i = 0; i < kSize; ++i)
         {
@@ -111,24 +115,22 @@ public:
     {
         if (kSize > 0)
         {
-            std::vector<TYPE> elements(kSize);
-
-            for (unsigned int i = 0; i < kSize; ++i)
-            {
-                _elements[i] = TYPE{std::numeric_limits<double>::quiet_NaN()};
-            }
-
-            std::stringstream ss(String::StripSpaces(str));
+            std::string_view sv(str);
             bool valid = true;
             for (unsigned int i = 0; i < kSize && valid; ++i)
             {
                 double temp = std::numeric_limits<double>::quiet_NaN();
-                ss >> temp;
-                valid &= mc::IsValid(temp);
-                elements[i] = TYPE{temp};
+                valid &= String::ParseNumber(&sv, &temp) && mc::IsValid(temp);
+                _elements[i] = TYPE{temp};
             }
 
-            if ( valid ) SetFromVector(elements);
+            if (!valid)
+            {
+                for (unsigned int i = 0; i < kSize; ++i)
+                {
+                    _elements[i] = TYPE{std::numeric_limits<double>::quiet_NaN()};
+                }
+            }
         }
     }
 
@@ -172,7 +174,7 @@ public:
      * \param col element column number
      * \return element value
      */
-    inline double operator()(unsigned int row, unsigned int col) const
+    constexpr double operator()(unsigned int row, unsigned int col) const
     {
         return _elements[row * kCols + col];
     }
@@ -185,13 +187,13 @@ public:
      * \param row element row number
      * \param col element column number
      */
-    inline double& operator()(unsigned int row, unsigned int col)
+    constexpr double& operator()(unsigned int row, unsigned int col)
     {
         return _elements[row * kCols + col];
     }
 
     /** \brief Addition operator. */
-    MatrixMxN<TYPE, ROWS, COLS> operator+(const MatrixMxN<TYPE, ROWS, COLS>& matrix) const
+    constexpr MatrixMxN<TYPE, ROWS, COLS> operator+(const MatrixMxN<TYPE, ROWS, COLS>& matrix) const
     {
         MatrixMxN<TYPE, ROWS, COLS> result(*this);
         result.Add(matrix);
@@ -199,7 +201,7 @@ public:
     }
 
     /** \brief Negation operator. */
-    MatrixMxN<TYPE, ROWS, COLS> operator-() const
+    constexpr MatrixMxN<TYPE, ROWS, COLS> operator-() const
     {
         MatrixMxN<TYPE, ROWS, COLS> result(*this);
         result.Negate();
@@ -207,7 +209,7 @@ public:
     }
 
     /** \brief Subtraction operator. */
-    MatrixMxN<TYPE, ROWS, COLS> operator-(const MatrixMxN<TYPE, ROWS, COLS>& matrix) const
+    constexpr MatrixMxN<TYPE, ROWS, COLS> operator-(const MatrixMxN<TYPE, ROWS, COLS>& matrix) const
     {
         MatrixMxN<TYPE, ROWS, COLS> result(*this);
         result.Substract(matrix);
@@ -215,7 +217,7 @@ public:
     }
 
     /** \brief Multiplication operator (by number). */
-    MatrixMxN<TYPE, ROWS, COLS> operator*(double value) const
+    constexpr MatrixMxN<TYPE, ROWS, COLS> operator*(double value) const
     {
         MatrixMxN<TYPE, ROWS, COLS> result(*this);
         result.MultiplyByValue(value);
@@ -223,15 +225,24 @@ public:
     }
 
     /** \brief Multiplication operator (by vector). */
-    VectorN<TYPE, ROWS> operator*(const VectorN<TYPE, COLS>& vect) const
+    constexpr VectorN<TYPE, ROWS> operator*(const VectorN<TYPE, COLS>& vect) const
     {
         VectorN<TYPE, ROWS> result;
         MultiplyByVector(vect, &result);
         return result;
     }
 
+    /** \brief Multiplication operator (by matrix). */
+    template <unsigned int RHS_COLS>
+    MatrixMxN<TYPE, ROWS, RHS_COLS> operator*(const MatrixMxN<TYPE, COLS, RHS_COLS>& matrix) const
+    {
+        MatrixMxN<TYPE, ROWS, RHS_COLS> result;
+        MatrixKernels::Multiply<TYPE, ROWS, COLS, RHS_COLS>(_elements, matrix._elements, result._elements);
+        return result;
+    }
+
     /** \brief Division operator (by number). */
-    MatrixMxN<TYPE, ROWS, COLS> operator/(double value) const
+    constexpr MatrixMxN<TYPE, ROWS, COLS> operator/(double value) const
     {
         MatrixMxN<TYPE, ROWS, COLS> result(*this);
         result.DivideByValue(value);
@@ -239,35 +250,35 @@ public:
     }
 
     /** \brief Unary addition operator. */
-    MatrixMxN<TYPE, ROWS, COLS>& operator+=(const MatrixMxN<TYPE, ROWS, COLS>& matrix)
+    constexpr MatrixMxN<TYPE, ROWS, COLS>& operator+=(const MatrixMxN<TYPE, ROWS, COLS>& matrix)
     {
         Add(matrix);
         return *this;
     }
 
     /** \brief Unary subtraction operator. */
-    MatrixMxN<TYPE, ROWS, COLS>& operator-=(const MatrixMxN<TYPE, ROWS, COLS>& matrix)
+    constexpr MatrixMxN<TYPE, ROWS, COLS>& operator-=(const MatrixMxN<TYPE, ROWS, COLS>& matrix)
     {
         Substract(matrix);
         return *this;
     }
 
     /** \brief Unary multiplication operator (by number). */
-    MatrixMxN<TYPE, ROWS, COLS>& operator*=(double value)
+    constexpr MatrixMxN<TYPE, ROWS, COLS>& operator*=(double value)
     {
         MultiplyByValue(value);
         return *this;
     }
 
     /** \brief Unary division operator (by number). */
-    MatrixMxN<TYPE, ROWS, COLS>& operator/=(double value)
+    constexpr MatrixMxN<TYPE, ROWS, COLS>& operator/=(double value)
     {
         DivideByValue(value);
         return *this;
     }
 
     /** \brief Equality operator. */
-    bool operator==(const MatrixMxN<TYPE, ROWS, COLS>& matrix) const
+    constexpr bool operator==(const MatrixMxN<TYPE, ROWS, COLS>& matrix) const
     {
         bool result = true;
 
@@ -280,7 +291,7 @@ public:
     }
 
     /** \brief Inequality operator. */
-    bool operator!=(const MatrixMxN<TYPE, ROWS, COLS>& matrix) const
+    constexpr bool operator!=(const MatrixMxN<TYPE, ROWS, COLS>& matrix) const
     {
         return !(*this == matrix);
     }
@@ -290,7 +301,7 @@ protected:
     TYPE _elements[kSize] = { 0 };  ///< matrix elements
 
     /** \brief Adds matrix. */
-    void Add(const MatrixMxN<TYPE, ROWS, COLS>& matrix)
+    constexpr void Add(const MatrixMxN<TYPE, ROWS, COLS>& matrix)
     {
         for (unsigned int i = 0; i < kSize; ++i)
         {
@@ -299,7 +310,7 @@ protected:
     }
 
     /** \brief Negates matrix. */
-    void Negate()
+    constexpr void Negate()
     {
         for (unsigned int i = 0; i < kSize; ++i)
         {
@@ -308,7 +319,7 @@ protected:
     }
 
     /** \brief Substracts matrix. */
-    void Substract(const MatrixMxN<TYPE, ROWS, COLS>& matrix)
+    constexpr void Substract(const MatrixMxN<TYPE, ROWS, COLS>& matrix)
     {
         for (unsigned int i = 0; i < kSize; ++i)
         {
@@ -317,7 +328,7 @@ protected:
     }
 
     /** \brief Multiplies by value. */
-    void MultiplyByValue(double value)
+    constexpr void MultiplyByValue(double value)
     {
         for (unsigned int i = 0; i < kSize; ++i)
         {
@@ -327,20 +338,21 @@ protected:
 
     /** \brief Multiplies by vector. */
     template <typename LHS_TYPE, typename RHS_TYPE>
-    void MultiplyByVector(const VectorN<LHS_TYPE, COLS>& vect, VectorN<RHS_TYPE, ROWS>* result) const
+    constexpr void MultiplyByVector(const VectorN<LHS_TYPE, COLS>& vect, VectorN<RHS_TYPE, ROWS>* result) const
     {
         for (unsigned int r = 0; r < kRows; ++r)
         {
-            (*result)(r) = RHS_TYPE{0};
+            RHS_TYPE sum = RHS_TYPE{0};
             for (unsigned int c = 0; c < kCols; ++c)
             {
-                (*result)(r) += (_elements[r*kCols + c] * vect(c));
+                sum += (_elements[r*kCols + c] * vect(c));
             }
+            (*result)(r) = sum;
         }
     }
 
     /** \brief Divides by value. */
-    void DivideByValue(double value)
+    constexpr void DivideByValue(double value)
     {
         double value_inv = 1.0 / value;
         for (unsigned int i = 0; i < kSize; ++i)
@@ -352,7 +364,7 @@ protected:
 
 /** \brief Multiplication operator (by number). */
 template <typename TYPE, unsigned int ROWS, unsigned int COLS>
-inline MatrixMxN<TYPE, ROWS, COLS> operator*(double value, const MatrixMxN<TYPE, ROWS, COLS>& matrix)
+constexpr MatrixMxN<TYPE, ROWS, COLS> operator*(double value, const MatrixMxN<TYPE, ROWS, COLS>& matrix)
 {
     return matrix * value;
 }
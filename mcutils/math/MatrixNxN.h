@@ -22,6 +22,7 @@
 #ifndef MCUTILS_MATH_MATRIXNXN_H_
 #define MCUTILS_MATH_MATRIXNXN_H_
 
+#include <mcutils/math/MatrixKernels.h>
 #include <mcutils/math/MatrixMxN.h>
 
 namespace mc {
@@ -37,7 +38,7 @@ class MatrixNxN : public MatrixMxN<TYPE, SIZE, SIZE>
 public:
 
     /** \brief Creates identity matrix. */
-    static MatrixNxN<TYPE, SIZE> GetIdentityMatrix()
+    static constexpr MatrixNxN<TYPE, SIZE> GetIdentityMatrix()
     {
         MatrixNxN<TYPE, SIZE> result;
         for (unsigned int i = 0; i < SIZE; ++i)
@@ -48,19 +49,21 @@ public:
     }
 
     /** \brief Transposes matrix. */
-    void Transpose()
+    constexpr void Transpose()
     {
         for (unsigned int r = 0; r < SIZE; ++r)
         {
             for (unsigned int c = r + 1; c < SIZE; ++c)
             {
-                std::swap(this->_elements[c*SIZE + r], this->_elements[r*SIZE + c]);
+                TYPE temp = this->_elements[c*SIZE + r];
+                this->_elements[c*SIZE + r] = this->_elements[r*SIZE + c];
+                this->_elements[r*SIZE + c] = temp;
             }
         }
     }
 
     /** \brief Returns transposed matrix. */
-    MatrixNxN<TYPE, SIZE> GetTransposed() const
+    constexpr MatrixNxN<TYPE, SIZE> GetTransposed() const
     {
         MatrixNxN<TYPE, SIZE> result(*this);
         result.Transpose();
@@ -68,7 +71,7 @@ public:
     }
 
     /** \brief Addition operator. */
-    MatrixNxN<TYPE, SIZE> operator+(const MatrixNxN<TYPE, SIZE>& matrix) const
+    constexpr MatrixNxN<TYPE, SIZE> operator+(const MatrixNxN<TYPE, SIZE>& matrix) const
     {
         MatrixNxN<TYPE, SIZE> result(*this);
         result.Add(matrix);
@@ -76,7 +79,7 @@ public:
     }
 
     /** \brief Negation operator. */
-    MatrixNxN<TYPE, SIZE> operator-() const
+    constexpr MatrixNxN<TYPE, SIZE> operator-() const
     {
         MatrixNxN<TYPE, SIZE> result(*this);
         result.Negate();
@@ -84,7 +87,7 @@ public:
     }
 
     /** \brief Subtraction operator. */
-    MatrixNxN<TYPE, SIZE> operator-(const MatrixNxN<TYPE, SIZE>& matrix) const
+    constexpr MatrixNxN<TYPE, SIZE> operator-(const MatrixNxN<TYPE, SIZE>& matrix) const
     {
         MatrixNxN<TYPE, SIZE> result(*this);
         result.Substract(matrix);
@@ -92,7 +95,7 @@ public:
     }
 
     /** \brief Multiplication operator (by number). */
-    MatrixNxN<TYPE, SIZE> operator*(double value) const
+    constexpr MatrixNxN<TYPE, SIZE> operator*(double value) const
     {
         MatrixNxN<TYPE, SIZE> result(*this);
         result.MultiplyByValue(value);
@@ -102,13 +105,13 @@ public:
     /** \brief Multiplication operator (by matrix). */
     MatrixNxN<TYPE, SIZE> operator*(const MatrixNxN<TYPE, SIZE>& matrix) const
     {
-        MatrixNxN<TYPE, SIZE> result( *this );
+        MatrixNxN<TYPE, SIZE> result;
         MultiplyByMatrix(matrix, &result);
         return result;
     }
 
     /** \brief Division operator (by number). */
-    MatrixNxN<TYPE, SIZE> operator/(double value) const
+    constexpr MatrixNxN<TYPE, SIZE> operator/(double value) const
     {
         MatrixNxN<TYPE, SIZE> result(*this);
         result.DivideByValue(value);
@@ -116,28 +119,28 @@ public:
     }
 
     /** \brief Unary addition operator. */
-    MatrixNxN<TYPE, SIZE>& operator+=(const MatrixNxN<TYPE, SIZE>& matrix)
+    constexpr MatrixNxN<TYPE, SIZE>& operator+=(const MatrixNxN<TYPE, SIZE>& matrix)
     {
         this->Add(matrix);
         return *this;
     }
 
     /** \brief Unary subtraction operator. */
-    MatrixNxN<TYPE, SIZE>& operator-=(const MatrixNxN<TYPE, SIZE>& matrix)
+    constexpr MatrixNxN<TYPE, SIZE>& operator-=(const MatrixNxN<TYPE, SIZE>& matrix)
     {
         this->Substract(matrix);
         return *this;
     }
 
     /** \brief Unary multiplication operator (by number). */
-    MatrixNxN<TYPE, SIZE>& operator*=(double value)
+    constexpr MatrixNxN<TYPE, SIZE>& operator*=(double value)
     {
         this->MultiplyByValue(value);
         return *this;
     }
 
     /** \brief Unary division operator (by number). */
-    MatrixNxN<TYPE, SIZE>& operator/=(double value)
+    constexpr MatrixNxN<TYPE, SIZE>& operator/=(double value)
     {
         this->DivideByValue(value);
         return *this;
@@ -147,28 +150,19 @@ protected:
 
     /**
      * \brief Multiplies matrix by matrix.
-     * \param matrix
-     * \param result
+     * See MatrixKernels::Multiply().
+     * \param matrix right-hand side matrix
+     * \param result result matrix, must not be this matrix nor the given matrix
      */
     void MultiplyByMatrix(const MatrixNxN<TYPE, SIZE>& matrix, MatrixNxN<TYPE, SIZE>* result) const
     {
-        for (unsigned int r = 0; r < SIZE; ++r)
-        {
-            for (unsigned int c = 0; c < SIZE; ++c)
-            {
-                (*result)(r,c) = 0.0;
-                for (unsigned int i = 0; i < SIZE; ++i)
-                {
-                    (*result)(r,c) += (this->_elements[r*SIZE + i] * matrix(i,c));
-                }
-            }
-        }
+        MatrixKernels::Multiply<TYPE, SIZE, SIZE, SIZE>(this->_elements, matrix._elements, result->_elements);
     }
 };
 
 /** \brief Multiplication operator (by number). */
 template <typename TYPE, unsigned int SIZE>
-inline MatrixNxN<TYPE, SIZE> operator*(double value, const MatrixNxN<TYPE, SIZE>& matrix)
+constexpr MatrixNxN<TYPE, SIZE> operator*(double value, const MatrixNxN<TYPE, SIZE>& matrix)
 {
     return matrix * value;
 }
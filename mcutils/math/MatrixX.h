@@ -0,0 +1,571 @@
+/****************************************************************************//*
+ * Copyright (C) 2026 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_MATRIXX_H_
+#define MCUTILS_MATH_MATRIXX_H_
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <mcutils/math/VectorX.h>
+#include <mcutils/misc/Arena.h>
+#include <mcutils/misc/Check.h>
+#include <mcutils/misc/String.h>
+
+namespace mc {
+
+/**
+ * \brief Runtime-sized matrix class template.
+ *
+ * Counterpart of MatrixMxN and MatrixNxN for systems which size is known
+ * only at runtime. Matrix storage is obtained from the given allocator,
+ * e.g. Arena, or from the heap if no allocator is given. Results of the
+ * arithmetic operators are allocated with the allocator of the left hand
+ * side operand. Unary operators, assignment of matrices of the same size,
+ * MultiplyByVector() and MultiplyByMatrix() do not allocate.
+ *
+ * Operands of the arithmetic operators must be of matching sizes.
+ *
+ * \tparam TYPE matrix element type
+ */
+template <typename TYPE>
+class MatrixX
+{
+public:
+
+    /**
+     * \brief Creates identity matrix.
+     * \param size number of rows and columns
+     * \param allocator allocator, if nullptr storage is allocated from the heap
+     */
+    static MatrixX<TYPE> GetIdentityMatrix(unsigned int size, Allocator* allocator = nullptr)
+    {
+        MatrixX<TYPE> result(size, size, allocator);
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            result(i,i) = TYPE{1};
+        }
+        return result;
+    }
+
+    /**
+     * \brief Constructor.
+     * \param rows number of rows
+     * \param cols number of columns
+     * \param allocator allocator, if nullptr storage is allocated from the heap
+     */
+    explicit MatrixX(unsigned int rows = 0, unsigned int cols = 0, Allocator* allocator = nullptr)
+        : _allocator(allocator)
+        , _rows(rows)
+        , _cols(cols)
+        , _size(rows * cols)
+    {
+        _elements = AllocateArray<TYPE>(_allocator, _size);
+    }
+
+    /** \brief Copy constructor, uses allocator of the given matrix. */
+    MatrixX(const MatrixX<TYPE>& matrix)
+        : MatrixX(matrix._rows, matrix._cols, matrix._allocator)
+    {
+        std::copy(matrix._elements, matrix._elements + _size, _elements);
+    }
+
+    /** \brief Move constructor. */
+    MatrixX(MatrixX<TYPE>&& matrix)
+        : _allocator(matrix._allocator)
+        , _rows(std::exchange(matrix._rows, 0))
+        , _cols(std::exchange(matrix._cols, 0))
+        , _size(std::exchange(matrix._size, 0))
+        , _elements(std::exchange(matrix._elements, nullptr))
+    {}
+
+    /** \brief Destructor. */
+    ~MatrixX()
+    {
+        DeallocateArray(_allocator, _elements, _size);
+    }
+
+    /** \return number of rows */
+    inline unsigned int rows() const { return _rows; }
+
+    /** \return number of columns */
+    inline unsigned int cols() const { return _cols; }
+
+    /** \return number of elements */
+    inline unsigned int size() const { return _size; }
+
+    /** \return matrix allocator */
+    inline Allocator* GetAllocator() const { return _allocator; }
+
+    /**
+     * \brief Resizes matrix, elements are set to zero.
+     * Does not allocate if number of elements does not change.
+     * \param rows number of rows
+     * \param cols number of columns
+     */
+    void Resize(unsigned int rows, unsigned int cols)
+    {
+        if (rows * cols != _size)
+        {
+            DeallocateArray(_allocator, _elements, _size);
+            _size = rows * cols;
+            _elements = AllocateArray<TYPE>(_allocator, _size);
+        }
+        else
+        {
+            Fill(TYPE{0});
+        }
+
+        _rows = rows;
+        _cols = cols;
+    }
+
+    /**
+     * \brief Fills all matrix elements with the given value.
+     * \param value given value to fill all matrix elements
+     */
+    void Fill(TYPE value)
+    {
+        for (unsigned int i = 0; i < _size; ++i)
+        {
+            _elements[i] = value;
+        }
+    }
+
+    /** \return "true" if all elements are valid */
+    bool IsValid() const
+    {
+        return mc::IsValid(_elements, _size);
+    }
+
+    /**
+     * \brief Gets a std::vector of matrix elements.
+     * Elements index should match following scheme:
+     * i = i_row * n_col + i_col
+     * \return vector of matrix elements
+     */
+    std::vector<TYPE> GetVector() const
+    {
+        return std::vector<TYPE>(_elements, _elements + _size);
+    }
+
+    /**
+     * \brief Sets matrix elements from a std::vector.
+     * Elements index should match following scheme:
+     * i = i_row * n_col + i_col
+     * \param elements input std::vector of matrix elements
+     */
+    void SetFromVector(const std::vector<TYPE>& elements)
+    {
+        assert(elements.size() == _size);
+        std::copy(elements.begin(), elements.end(), _elements);
+    }
+
+    /**
+     * \brief Sets matrix elements from string.
+     * Values in the given string should be separated with whitespaces.
+     * \param str given string
+     */
+    void SetFromString(const char* str)
+    {
+        if (_size > 0)
+        {
+            std::string_view sv(str);
+            bool valid = true;
+            for (unsigned int i = 0; i < _size && valid; ++i)
+            {
+                double temp = std::numeric_limits<double>::quiet_NaN();
+                valid &= String::ParseNumber(&sv, &temp) && mc::IsValid(temp);
+                _elements[i] = TYPE{temp};
+            }
+
+            if (!valid)
+            {
+                Fill(TYPE{std::numeric_limits<double>::quiet_NaN()});
+            }
+        }
+    }
+
+    /** \brief Swaps matrix rows. */
+    void SwapRows(unsigned int row1, unsigned int row2)
+    {
+        if (row1 < _rows && row2 < _rows)
+        {
+            std::swap_ranges(_elements + row1 * _cols, _elements + (row1 + 1) * _cols,
+                             _elements + row2 * _cols);
+        }
+    }
+
+    /** \brief Returns string representation of the matrix. */
+    std::string ToString() const
+    {
+        std::stringstream ss;
+
+        for (unsigned int r = 0; r < _rows; ++r)
+        {
+            for (unsigned int c = 0; c < _cols; ++c)
+            {
+                if (r > 0 || c >  0) ss << "\t";
+                if (r > 0 && c == 0) ss << std::endl;
+
+                ss << _elements[r * _cols + c];
+            }
+        }
+
+        return ss.str();
+    }
+
+    /**
+     * \brief Transposes matrix.
+     * Square matrices are transposed in place, other ones are reallocated.
+     */
+    void Transpose()
+    {
+        if (_rows == _cols)
+        {
+            for (unsigned int r = 0; r < _rows; ++r)
+            {
+                for (unsigned int c = r + 1; c < _cols; ++c)
+                {
+                    std::swap(_elements[c*_cols + r], _elements[r*_cols + c]);
+                }
+            }
+        }
+        else
+        {
+            *this = GetTransposed();
+        }
+    }
+
+    /** \brief Returns transposed matrix. */
+    MatrixX<TYPE> GetTransposed() const
+    {
+        MatrixX<TYPE> result(_cols, _rows, _allocator);
+        for (unsigned int r = 0; r < _rows; ++r)
+        {
+            for (unsigned int c = 0; c < _cols; ++c)
+            {
+                result._elements[c*_rows + r] = _elements[r*_cols + c];
+            }
+        }
+        return result;
+    }
+
+    /**
+     * \brief Multiplies matrix by vector.
+     * \param vect vector, its size must be equal to the number of columns
+     * \param result result vector, its size must be equal to the number of rows, must not be the given vector
+     */
+    void MultiplyByVector(const VectorX<TYPE>& vect, VectorX<TYPE>* result) const
+    {
+        assert(vect.size() == _cols && result->size() == _rows);
+
+        const TYPE* v = vect.data();
+        TYPE* res = result->data();
+
+        for (unsigned int r = 0; r < _rows; ++r)
+        {
+            const TYPE* row = _elements + r * _cols;
+
+            TYPE sum = TYPE{0};
+            for (unsigned int c = 0; c < _cols; ++c)
+            {
+                sum += row[c] * v[c];
+            }
+            res[r] = sum;
+        }
+    }
+
+    /**
+     * \brief Multiplies matrix by matrix.
+     * Goes along rows of both the given and the result matrix (i-k-j order),
+     * so that the inner loop is contiguous and can be vectorized.
+     * \param matrix right hand side matrix, its rows count must be equal to the number of columns
+     * \param result result matrix of matching size, must not be this matrix nor the given matrix
+     */
+    void MultiplyByMatrix(const MatrixX<TYPE>& matrix, MatrixX<TYPE>* result) const
+    {
+        assert(matrix._rows == _cols && result->_rows == _rows && result->_cols == matrix._cols);
+
+        const unsigned int n = matrix._cols;
+
+        for (unsigned int r = 0; r < _rows; ++r)
+        {
+            TYPE* res_row = result->_elements + r * n;
+
+            for (unsigned int c = 0; c < n; ++c)
+            {
+                res_row[c] = TYPE{0};
+            }
+
+            for (unsigned int k = 0; k < _cols; ++k)
+            {
+                const TYPE a_rk = _elements[r * _cols + k];
+                const TYPE* rhs_row = matrix._elements + k * n;
+
+                for (unsigned int c = 0; c < n; ++c)
+                {
+                    res_row[c] += a_rk * rhs_row[c];
+                }
+            }
+        }
+    }
+
+    /** \return pointer to the matrix elements */
+    inline const TYPE* data() const { return _elements; }
+
+    /** \return pointer to the matrix elements */
+    inline TYPE* data() { return _elements; }
+
+    /**
+     * \brief Elements accessor.
+     * Please notice that this operator is NOT bound-checked.
+     * \param row element row number
+     * \param col element column number
+     * \return element value
+     */
+    inline TYPE operator()(unsigned int row, unsigned int col) const
+    {
+        return _elements[row * _cols + col];
+    }
+
+    /**
+     * \brief Elements accessor.
+     * Please notice that this operator is NOT bound-checked.
+     * \param row element row number
+     * \param col element column number
+     */
+    inline TYPE& operator()(unsigned int row, unsigned int col)
+    {
+        return _elements[row * _cols + col];
+    }
+
+    /** \brief Addition operator. */
+    MatrixX<TYPE> operator+(const MatrixX<TYPE>& matrix) const
+    {
+        MatrixX<TYPE> result(*this);
+        result.Add(matrix);
+        return result;
+    }
+
+    /** \brief Negation operator. */
+    MatrixX<TYPE> operator-() const
+    {
+        MatrixX<TYPE> result(*this);
+        result.Negate();
+        return result;
+    }
+
+    /** \brief Subtraction operator. */
+    MatrixX<TYPE> operator-(const MatrixX<TYPE>& matrix) const
+    {
+        MatrixX<TYPE> result(*this);
+        result.Substract(matrix);
+        return result;
+    }
+
+    /** \brief Multiplication operator (by number). */
+    MatrixX<TYPE> operator*(double value) const
+    {
+        MatrixX<TYPE> result(*this);
+        result.MultiplyByValue(value);
+        return result;
+    }
+
+    /** \brief Multiplication operator (by vector). */
+    VectorX<TYPE> operator*(const VectorX<TYPE>& vect) const
+    {
+        VectorX<TYPE> result(_rows, _allocator);
+        MultiplyByVector(vect, &result);
+        return result;
+    }
+
+    /** \brief Multiplication operator (by matrix). */
+    MatrixX<TYPE> operator*(const MatrixX<TYPE>& matrix) const
+    {
+        MatrixX<TYPE> result(_rows, matrix._cols, _allocator);
+        MultiplyByMatrix(matrix, &result);
+        return result;
+    }
+
+    /** \brief Division operator (by number). */
+    MatrixX<TYPE> operator/(double value) const
+    {
+        MatrixX<TYPE> result(*this);
+        result.DivideByValue(value);
+        return result;
+    }
+
+    /**
+     * \brief Assignment operator.
+     * Does not allocate if matrices have the same number of elements,
+     * otherwise storage is reallocated with the allocator of this matrix.
+     */
+    MatrixX<TYPE>& operator=(const MatrixX<TYPE>& matrix)
+    {
+        if (this != &matrix)
+        {
+            if (matrix._size != _size)
+            {
+                DeallocateArray(_allocator, _elements, _size);
+                _size = matrix._size;
+                _elements = AllocateArray<TYPE>(_allocator, _size);
+            }
+            _rows = matrix._rows;
+            _cols = matrix._cols;
+            std::copy(matrix._elements, matrix._elements + _size, _elements);
+        }
+        return *this;
+    }
+
+    /** \brief Move assignment operator, takes allocator of the given matrix. */
+    MatrixX<TYPE>& operator=(MatrixX<TYPE>&& matrix)
+    {
+        if (this != &matrix)
+        {
+            DeallocateArray(_allocator, _elements, _size);
+            _allocator = matrix._allocator;
+            _rows      = std::exchange(matrix._rows, 0);
+            _cols      = std::exchange(matrix._cols, 0);
+            _size      = std::exchange(matrix._size, 0);
+            _elements  = std::exchange(matrix._elements, nullptr);
+        }
+        return *this;
+    }
+
+    /** \brief Unary addition operator. */
+    MatrixX<TYPE>& operator+=(const MatrixX<TYPE>& matrix)
+    {
+        Add(matrix);
+        return *this;
+    }
+
+    /** \brief Unary subtraction operator. */
+    MatrixX<TYPE>& operator-=(const MatrixX<TYPE>& matrix)
+    {
+        Substract(matrix);
+        return *this;
+    }
+
+    /** \brief Unary multiplication operator (by number). */
+    MatrixX<TYPE>& operator*=(double value)
+    {
+        MultiplyByValue(value);
+        return *this;
+    }
+
+    /** \brief Unary division operator (by number). */
+    MatrixX<TYPE>& operator/=(double value)
+    {
+        DivideByValue(value);
+        return *this;
+    }
+
+    /** \brief Equality operator. */
+    bool operator==(const MatrixX<TYPE>& matrix) const
+    {
+        bool result = _rows == matrix._rows && _cols == matrix._cols;
+        for (unsigned int i = 0; i < _size && result; ++i)
+        {
+            result = result && (_elements[i] == matrix._elements[i]);
+        }
+        return result;
+    }
+
+    /** \brief Inequality operator. */
+    bool operator!=(const MatrixX<TYPE>& matrix) const
+    {
+        return !(*this == matrix);
+    }
+
+protected:
+
+    Allocator* _allocator = nullptr;    ///< allocator
+    unsigned int _rows = 0;             ///< number of rows
+    unsigned int _cols = 0;             ///< number of columns
+    unsigned int _size = 0;             ///< number of elements
+    TYPE* _elements = nullptr;          ///< matrix elements
+
+    /** \brief Adds matrix. */
+    void Add(const MatrixX<TYPE>& matrix)
+    {
+        assert(matrix._rows == _rows && matrix._cols == _cols);
+        for (unsigned int i = 0; i < _size; ++i)
+        {
+            _elements[i] += matrix._elements[i];
+        }
+    }
+
+    /** \brief Negates matrix. */
+    void Negate()
+    {
+        for (unsigned int i = 0; i < _size; ++i)
+        {
+            _elements[i] = -_elements[i];
+        }
+    }
+
+    /** \brief Substracts matrix. */
+    void Substract(const MatrixX<TYPE>& matrix)
+    {
+        assert(matrix._rows == _rows && matrix._cols == _cols);
+        for (unsigned int i = 0; i < _size; ++i)
+        {
+            _elements[i] -= matrix._elements[i];
+        }
+    }
+
+    /** \brief Multiplies by value. */
+    void MultiplyByValue(double value)
+    {
+        for (unsigned int i = 0; i < _size; ++i)
+        {
+            _elements[i] *= value;
+        }
+    }
+
+    /** \brief Divides by value. */
+    void DivideByValue(double value)
+    {
+        double value_inv = 1.0 / value;
+        for (unsigned int i = 0; i < _size; ++i)
+        {
+            _elements[i] *= value_inv;
+        }
+    }
+};
+
+/** \brief Multiplication operator (by number). */
+template <typename TYPE>
+inline MatrixX<TYPE> operator*(double value, const MatrixX<TYPE>& matrix)
+{
+    return matrix * value;
+}
+
+} // namespace mc
+
+#endif // MCUTILS_MATH_MATRIXX_H_
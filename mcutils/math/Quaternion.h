@@ -56,8 +56,8 @@ class Quaternion
 public:
 
     /** \brief Constructor. */
-    explicit Quaternion(double e0 = 1.0, double ex = 0.0,
-                        double ey = 0.0, double ez = 0.0)
+    constexpr explicit Quaternion(double e0 = 1.0, double ex = 0.0,
+                                  double ey = 0.0, double ez = 0.0)
     {
         Set(e0, ex, ey, ez);
     }
@@ -115,7 +115,7 @@ public:
     }
 
     /** \brief Conjugates quaternion. */
-    void Conjugate()
+    constexpr void Conjugate()
     {
         _ex = -_ex;
         _ey = -_ey;
@@ -143,7 +143,7 @@ public:
     }
 
     /** \return vector length squared */
-    double GetLength2() const
+    constexpr double GetLength2() const
     {
         return _e0*_e0 + _ex*_ex + _ey*_ey + _ez*_ez;
     }
@@ -184,7 +184,7 @@ public:
     }
 
     /** \brief Returns conjugated quaternion. */
-    Quaternion GetConjugated() const
+    constexpr Quaternion GetConjugated() const
     {
         Quaternion result(*this);
         result.Conjugate();
@@ -197,7 +197,7 @@ public:
      * \param lambda free parameter (usually set to a small multiple of the integration time step)
      * \return quaternion derivative
      */
-    Quaternion GetDerivative(const Vector3_rad_per_s& omega, double lambda = 0.0) const
+    constexpr Quaternion GetDerivative(const Vector3_rad_per_s& omega, double lambda = 0.0) const
     {
         Quaternion result;
 
@@ -259,7 +259,7 @@ public:
     }
 
     /** \brief Sets quaternion values. */
-    void Set(double e0, double ex, double ey, double ez)
+    constexpr void Set(double e0, double ex, double ey, double ez)
     {
         _e0 = e0;
         _ex = ex;
@@ -275,17 +275,17 @@ public:
         return ss.str();
     }
 
-    inline double  e0() const { return _e0; }
-    inline double  ex() const { return _ex; }
-    inline double  ey() const { return _ey; }
-    inline double  ez() const { return _ez; }
-    inline double& e0()       { return _e0; }
-    inline double& ex()       { return _ex; }
-    inline double& ey()       { return _ey; }
-    inline double& ez()       { return _ez; }
+    constexpr double  e0() const { return _e0; }
+    constexpr double  ex() const { return _ex; }
+    constexpr double  ey() const { return _ey; }
+    constexpr double  ez() const { return _ez; }
+    constexpr double& e0()       { return _e0; }
+    constexpr double& ex()       { return _ex; }
+    constexpr double& ey()       { return _ey; }
+    constexpr double& ez()       { return _ez; }
 
     /** \brief Addition operator. */
-    Quaternion operator+(const Quaternion& quat) const
+    constexpr Quaternion operator+(const Quaternion& quat) const
     {
         Quaternion result;
 
@@ -298,7 +298,7 @@ public:
     }
 
     /** \brief Subtraction operator. */
-    Quaternion operator-(const Quaternion& quat) const
+    constexpr Quaternion operator-(const Quaternion& quat) const
     {
         Quaternion result;
 
@@ -311,7 +311,7 @@ public:
     }
 
     /** \brief Multiplication operator (by number). */
-    Quaternion operator*(double val) const
+    constexpr Quaternion operator*(double val) const
     {
         Quaternion result;
 
@@ -324,7 +324,7 @@ public:
     }
 
     /** \brief Multiplication operator (by quaternion). */
-    Quaternion operator*(const Quaternion& quat) const
+    constexpr Quaternion operator*(const Quaternion& quat) const
     {
         Quaternion result;
 
@@ -352,7 +352,7 @@ public:
     }
 
     /** \brief Division operator (by number). */
-    Quaternion operator/(double val) const
+    constexpr Quaternion operator/(double val) const
     {
         Quaternion result;
 
@@ -365,7 +365,7 @@ public:
     }
 
     /** \brief Unary addition operator. */
-    Quaternion& operator+=(const Quaternion& quat)
+    constexpr Quaternion& operator+=(const Quaternion& quat)
     {
         _e0 += quat._e0;
         _ex += quat._ex;
@@ -376,7 +376,7 @@ public:
     }
 
     /** \brief Unary subtraction operator. */
-    Quaternion& operator-=(const Quaternion& quat)
+    constexpr Quaternion& operator-=(const Quaternion& quat)
     {
         _e0 -= quat._e0;
         _ex -= quat._ex;
@@ -387,7 +387,7 @@ public:
     }
 
     /** \brief Unary multiplication operator (by number). */
-    Quaternion& operator*=(double val)
+    constexpr Quaternion& operator*=(double val)
     {
         _e0 *= val;
         _ex *= val;
@@ -398,7 +398,7 @@ public:
     }
 
     /** \brief Unary division operator (by number). */
-    Quaternion& operator/=(double val)
+    constexpr Quaternion& operator/=(double val)
     {
         _e0 /= val;
         _ex /= val;
@@ -409,7 +409,7 @@ public:
     }
 
     /** \brief Equality operator. */
-    bool operator==(const Quaternion& quat) const
+    constexpr bool operator==(const Quaternion& quat) const
     {
         return (_e0 == quat._e0)
             && (_ex == quat._ex)
@@ -418,7 +418,7 @@ public:
     }
 
     /** \brief Inequality operator. */
-    bool operator!=(const Quaternion& quat) const
+    constexpr bool operator!=(const Quaternion& quat) const
     {
         return !(*this == quat);
     }
@@ -432,7 +432,7 @@ private:
 };
 
 /** \brief Multiplication operator (by number). */
-inline Quaternion operator*(double val, const Quaternion& quat)
+constexpr Quaternion operator*(double val, const Quaternion& quat)
 {
     return quat * val;
 }
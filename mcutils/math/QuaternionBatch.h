@@ -0,0 +1,338 @@
+/****************************************************************************//*
+ * Copyright (C) 2026 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_QUATERNIONBATCH_H_
+#define MCUTILS_MATH_QUATERNIONBATCH_H_
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+#include <vector>
+
+#include <mcutils/math/BatchKernels.h>
+#include <mcutils/math/Quaternion.h>
+#include <mcutils/misc/Arena.h>
+#include <mcutils/misc/Check.h>
+
+namespace mc {
+
+/**
+ * \brief Batch of quaternions in structure-of-arrays layout.
+ *
+ * Stores e0, ex, ey and ez components of all quaternions in separate
+ * contiguous arrays, so that operations applied to the whole batch are
+ * vectorized by BatchKernels. Individual quaternions are converted to and
+ * from Quaternion with Get() and Set().
+ *
+ * Storage is obtained from the given allocator, e.g. Arena, or from the
+ * heap if no allocator is given, and is padded with zeros to a multiple
+ * of BatchKernels::kLanes. Batch operations do not allocate.
+ */
+class QuaternionBatch
+{
+public:
+
+    /**
+     * \brief Constructor, all quaternions are set to identity.
+     * \param size number of quaternions
+     * \param allocator allocator, if nullptr storage is allocated from the heap
+     */
+    explicit QuaternionBatch(unsigned int size = 0, Allocator* allocator = nullptr)
+        : _allocator(allocator)
+        , _size(size)
+        , _padded(BatchKernels::GetPaddedSize(size))
+    {
+        _elements = AllocateArray<double>(_allocator, 4 * _padded);
+        SetIdentity();
+    }
+
+    /** \brief Copy constructor, uses allocator of the given batch. */
+    QuaternionBatch(const QuaternionBatch& batch)
+        : _allocator(batch._allocator)
+        , _size(batch._size)
+        , _padded(batch._padded)
+    {
+        _elements = AllocateArray<double>(_allocator, 4 * _padded);
+        std::copy(batch._elements, batch._elements + 4 * _padded, _elements);
+    }
+
+    /** \brief Move constructor. */
+    QuaternionBatch(QuaternionBatch&& batch)
+        : _allocator(batch._allocator)
+        , _size(std::exchange(batch._size, 0))
+        , _padded(std::exchange(batch._padded, 0))
+        , _elements(std::exchange(batch._elements, nullptr))
+    {}
+
+    /** \brief Destructor. */
+    ~QuaternionBatch()
+    {
+        DeallocateArray(_allocator, _elements, 4 * _padded);
+    }
+
+    /** \return number of quaternions */
+    inline unsigned int size() const { return _size; }
+
+    /** \return batch allocator */
+    inline Allocator* GetAllocator() const { return _allocator; }
+
+    /**
+     * \brief Resizes batch, all quaternions are set to identity.
+     * Does not allocate if padded size does not change.
+     * \param size new number of quaternions
+     */
+    void Resize(unsigned int size)
+    {
+        unsigned int padded = BatchKernels::GetPaddedSize(size);
+        if (padded != _padded)
+        {
+            DeallocateArray(_allocator, _elements, 4 * _padded);
+            _padded = padded;
+            _elements = AllocateArray<double>(_allocator, 4 * _padded);
+        }
+        _size = size;
+        SetIdentity();
+    }
+
+    /** \return TRUE if all items are valid */
+    bool IsValid() const
+    {
+        return mc::IsValid(_elements, 4 * _padded);
+    }
+
+    /**
+     * \brief Returns single quaternion.
+     * \param index quaternion index
+     * \return quaternion
+     */
+    inline Quaternion Get(unsigned int index) const
+    {
+        assert(index < _size);
+        return Quaternion(e0()[index], ex()[index], ey()[index], ez()[index]);
+    }
+
+    /**
+     * \brief Sets single quaternion.
+     * \param index quaternion index
+     * \param quat quaternion
+     */
+    inline void Set(unsigned int index, const Quaternion& quat)
+    {
+        assert(index < _size);
+        e0()[index] = quat.e0();
+        ex()[index] = quat.ex();
+        ey()[index] = quat.ey();
+        ez()[index] = quat.ez();
+    }
+
+    /**
+     * \brief Gets std::vector of quaternions.
+     * \return vector of quaternions
+     */
+    std::vector<Quaternion> GetVector() const
+    {
+        std::vector<Quaternion> quats(_size);
+        for (unsigned int i = 0; i < _size; ++i)
+        {
+            quats[i] = Get(i);
+        }
+        return quats;
+    }
+
+    /**
+     * \brief Sets batch from std::vector of quaternions, batch is resized if needed.
+     * \param quats vector of quaternions
+     */
+    void SetFromVector(const std::vector<Quaternion>& quats)
+    {
+        Resize(static_cast<unsigned int>(quats.size()));
+        for (unsigned int i = 0; i < _size; ++i)
+        {
+            Set(i, quats[i]);
+        }
+    }
+
+    /** \brief Sets all quaternions to identity, padding is set to zero. */
+    void SetIdentity()
+    {
+        std::fill(_elements, _elements + 4 * _padded, 0.0);
+        std::fill(e0(), e0() + _size, 1.0);
+    }
+
+    /** \brief Conjugates all quaternions. */
+    void Conjugate()
+    {
+        BatchKernels::Scale(3 * _padded, ex(), -1.0);
+    }
+
+    /** \brief Normalizes all quaternions, zero quaternions remain unchanged. */
+    void Normalize()
+    {
+        BatchKernels::Normalize4(_padded, e0(), ex(), ey(), ez());
+    }
+
+    /**
+     * \brief Multiplies the corresponding quaternions, result = this * batch.
+     * \param batch right hand side batch of the same size
+     * \param result result batch of the same size, must not be this batch nor the given batch
+     */
+    void Multiply(const QuaternionBatch& batch, QuaternionBatch* result) const
+    {
+        assert(batch._size == _size && result->_size == _size);
+        assert(result != this && result != &batch);
+        BatchKernels::QuaternionProduct(_padded,
+                                        e0(), ex(), ey(), ez(),
+                                        batch.e0(), batch.ex(), batch.ey(), batch.ez(),
+                                        result->e0(), result->ex(), result->ey(), result->ez());
+    }
+
+    /**
+     * \brief Adds scaled quaternions of the given batch, e.g. integrates attitudes.
+     * \param batch batch of the same size
+     * \param value scale factor
+     */
+    void AddScaled(const QuaternionBatch& batch, double value)
+    {
+        assert(batch._size == _size);
+        if (&batch == this)
+        {
+            BatchKernels::Scale(4 * _padded, _elements, 1.0 + value);
+        }
+        else
+        {
+            BatchKernels::AddScaled(4 * _padded, _elements, batch._elements, value);
+        }
+    }
+
+    /** \return e0 components array */
+    inline const double* e0() const { return _elements; }
+
+    /** \return ex components array */
+    inline const double* ex() const { return _elements + _padded; }
+
+    /** \return ey components array */
+    inline const double* ey() const { return _elements + 2 * _padded; }
+
+    /** \return ez components array */
+    inline const double* ez() const { return _elements + 3 * _padded; }
+
+    /** \return e0 components array */
+    inline double* e0() { return _elements; }
+
+    /** \return ex components array */
+    inline double* ex() { return _elements + _padded; }
+
+    /** \return ey components array */
+    inline double* ey() { return _elements + 2 * _padded; }
+
+    /** \return ez components array */
+    inline double* ez() { return _elements + 3 * _padded; }
+
+    /**
+     * \brief Assignment operator.
+     * Does not allocate if padded sizes are equal, otherwise storage
+     * is reallocated with the allocator of this batch.
+     */
+    QuaternionBatch& operator=(const QuaternionBatch& batch)
+    {
+        if (this != &batch)
+        {
+            if (batch._padded != _padded)
+            {
+                DeallocateArray(_allocator, _elements, 4 * _padded);
+                _padded = batch._padded;
+                _elements = AllocateArray<double>(_allocator, 4 * _padded);
+            }
+            _size = batch._size;
+            std::copy(batch._elements, batch._elements + 4 * _padded, _elements);
+        }
+        return *this;
+    }
+
+    /** \brief Move assignment operator, takes allocator of the given batch. */
+    QuaternionBatch& operator=(QuaternionBatch&& batch)
+    {
+        if (this != &batch)
+        {
+            DeallocateArray(_allocator, _elements, 4 * _padded);
+            _allocator = batch._allocator;
+            _size      = std::exchange(batch._size, 0);
+            _padded    = std::exchange(batch._padded, 0);
+            _elements  = std::exchange(batch._elements, nullptr);
+        }
+        return *this;
+    }
+
+    /** \brief Unary addition operator. */
+    QuaternionBatch& operator+=(const QuaternionBatch& batch)
+    {
+        assert(batch._size == _size);
+        if (&batch == this)
+        {
+            BatchKernels::Scale(4 * _padded, _elements, 2.0);
+        }
+        else
+        {
+            BatchKernels::Add(4 * _padded, _elements, batch._elements);
+        }
+        return *this;
+    }
+
+    /** \brief Unary subtraction operator. */
+    QuaternionBatch& operator-=(const QuaternionBatch& batch)
+    {
+        assert(batch._size == _size);
+        if (&batch == this)
+        {
+            BatchKernels::Scale(4 * _padded, _elements, 0.0);
+        }
+        else
+        {
+            BatchKernels::Substract(4 * _padded, _elements, batch._elements);
+        }
+        return *this;
+    }
+
+    /** \brief Unary multiplication operator (by number). */
+    QuaternionBatch& operator*=(double value)
+    {
+        BatchKernels::Scale(4 * _padded, _elements, value);
+        return *this;
+    }
+
+    /** \brief Unary division operator (by number). */
+    QuaternionBatch& operator/=(double value)
+    {
+        BatchKernels::Scale(4 * _padded, _elements, 1.0 / value);
+        return *this;
+    }
+
+protected:
+
+    Allocator* _allocator = nullptr;    ///< allocator
+    unsigned int _size = 0;             ///< number of quaternions
+    unsigned int _padded = 0;           ///< number of quaternions padded to a multiple of BatchKernels::kLanes
+    double* _elements = nullptr;        ///< e0, ex, ey and ez components arrays, one after another
+};
+
+} // namespace mc
+
+#endif // MCUTILS_MATH_QUATERNIONBATCH_H_
@@ -49,7 +49,7 @@ class RMatrix : public Matrix3x3<double>
 public:
 
     /** \brief Creates identity matrix. */
-    static RMatrix GetIdentityMatrix()
+    static constexpr RMatrix GetIdentityMatrix()
     {
         return RMatrix(1.0, 0.0, 0.0,
                     0.0, 1.0, 0.0,
@@ -57,9 +57,9 @@ public:
     }
 
     /** \brief Constructor. */
-    RMatrix(double xx = 0.0, double xy = 0.0, double xz = 0.0,
-            double yx = 0.0, double yy = 0.0, double yz = 0.0,
-            double zx = 0.0, double zy = 0.0, double zz = 0.0)
+    constexpr RMatrix(double xx = 0.0, double xy = 0.0, double xz = 0.0,
+                      double yx = 0.0, double yy = 0.0, double yz = 0.0,
+                      double zx = 0.0, double zy = 0.0, double zz = 0.0)
         : Matrix3x3<double>(xx, xy, xz, yx, yy, yz, zx, zy, zz)
     {}
 
@@ -92,7 +92,7 @@ public:
     }
 
     /** \brief Creates passive (alias) rotation matrix. */
-    explicit RMatrix(const Quaternion& qtrn)
+    constexpr explicit RMatrix(const Quaternion& qtrn)
     {
         double e0 = qtrn.e0();
         double ex = qtrn.ex();
@@ -196,7 +196,7 @@ public:
     }
 
     /** \brief Returns transposed matrix. */
-    RMatrix GetTransposed() const
+    constexpr RMatrix GetTransposed() const
     {
         RMatrix result(*this);
         result.Transpose();
@@ -204,7 +204,7 @@ public:
     }
 
     /** \brief Addition operator. */
-    RMatrix operator+(const RMatrix& matrix) const
+    constexpr RMatrix operator+(const RMatrix& matrix) const
     {
         RMatrix result(*this);
         result.Add(matrix);
@@ -212,7 +212,7 @@ public:
     }
 
     /** \brief Negation operator. */
-    RMatrix operator-() const
+    constexpr RMatrix operator-() const
     {
         RMatrix result(*this);
         result.Negate();
@@ -220,7 +220,7 @@ public:
     }
 
     /** \brief Subtraction operator. */
-    RMatrix operator-(const RMatrix& matrix) const
+    constexpr RMatrix operator-(const RMatrix& matrix) const
     {
         RMatrix result(*this);
         result.Substract(matrix);
@@ -228,7 +228,7 @@ public:
     }
 
     /** \brief Multiplication operator (by number). */
-    RMatrix operator*(double value) const
+    constexpr RMatrix operator*(double value) const
     {
         RMatrix result(*this);
         result.MultiplyByValue(value);
@@ -236,7 +236,7 @@ public:
     }
 
     /** \brief Multiplication operator (by matrix). */
-    RMatrix operator*(const RMatrix& matrix) const
+    constexpr RMatrix operator*(const RMatrix& matrix) const
     {
         RMatrix result;
         MultiplyByMatrix(matrix, &result);
@@ -245,7 +245,7 @@ public:
 
     /** \brief Multiplication operator (by vector). */
     template <class T>
-    UVector3<T> operator*(const UVector3<T>& vect) const
+    constexpr UVector3<T> operator*(const UVector3<T>& vect) const
     {
         UVector3<T> result;
         MultiplyByVector(vect, &result);
@@ -253,7 +253,7 @@ public:
     }
 
     /** \brief Multiplication operator (by vector). */
-    Vector3d operator*(const Vector3d& vect) const
+    constexpr Vector3d operator*(const Vector3d& vect) const
     {
         Vector3d result;
         MultiplyByVector(vect, &result);
@@ -261,7 +261,7 @@ public:
     }
 
     /** \brief Division operator (by number). */
-    RMatrix operator/(double value) const
+    constexpr RMatrix operator/(double value) const
     {
         RMatrix result(*this);
         result.DivideByValue(value);
@@ -269,28 +269,28 @@ public:
     }
 
     /** \brief Unary addition operator. */
-    RMatrix& operator+=(const RMatrix& matrix)
+    constexpr RMatrix& operator+=(const RMatrix& matrix)
     {
         Add(matrix);
         return *this;
     }
 
     /** \brief Unary subtraction operator. */
-    RMatrix& operator-=(const RMatrix& matrix)
+    constexpr RMatrix& operator-=(const RMatrix& matrix)
     {
         Substract(matrix);
         return *this;
     }
 
     /** \brief Unary multiplication operator (by number). */
-    RMatrix& operator*=(double value)
+    constexpr RMatrix& operator*=(double value)
     {
         MultiplyByValue(value);
         return *this;
     }
 
     /** \brief Unary division operator (by number). */
-    RMatrix& operator/=(double value)
+    constexpr RMatrix& operator/=(double value)
     {
         DivideByValue(value);
         return *this;
@@ -298,7 +298,7 @@ public:
 };
 
 /** \brief Multiplication operator (by number). */
-inline RMatrix operator*(double value, const RMatrix& matrix)
+constexpr RMatrix operator*(double value, const RMatrix& matrix)
 {
     return matrix * value;
 }
@@ -0,0 +1,242 @@
+/****************************************************************************//*
+ * Copyright (C) 2026 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_SPARSEMATRIX_H_
+#define MCUTILS_MATH_SPARSEMATRIX_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <vector>
+
+#include <mcutils/math/Matrix.h>
+#include <mcutils/math/Vector.h>
+#include <mcutils/misc/Check.h>
+
+namespace mc {
+
+/**
+ * \brief Sparse matrix class template in compressed sparse row (CSR) format.
+ *
+ * Only non-zero elements are stored, row by row, together with their
+ * column indices, so that memory and matrix-vector product cost is
+ * O(number of non-zero elements). Dimensions are fixed, to interoperate
+ * with VectorN, while the sparsity pattern is set at runtime. Values of
+ * stored elements can be modified in place, without rebuilding the pattern.
+ *
+ * \tparam TYPE matrix element type
+ * \tparam ROWS matrix rows count
+ * \tparam COLS matrix columns count
+ */
+template <typename TYPE, unsigned int ROWS, unsigned int COLS>
+class SparseMatrix
+{
+public:
+
+    static constexpr unsigned int kRows = ROWS;     ///< number of rows
+    static constexpr unsigned int kCols = COLS;     ///< number of columns
+
+    /** \brief Matrix element given as row, column and value. */
+    struct Triplet
+    {
+        unsigned int row = 0;   ///< element row
+        unsigned int col = 0;   ///< element column
+        TYPE value = TYPE{0};   ///< element value
+    };
+
+    /**
+     * \brief Sets matrix from the given elements.
+     * Elements may be given in any order, values of duplicated elements are summed up.
+     * \param triplets matrix elements
+     */
+    void SetFromTriplets(std::vector<Triplet> triplets)
+    {
+        std::sort(triplets.begin(), triplets.end(),
+                  [](const Triplet& t1, const Triplet& t2)
+                  {
+                      return t1.row < t2.row || (t1.row == t2.row && t1.col < t2.col);
+                  });
+
+        _values.clear();
+        _col_indices.clear();
+        _values.reserve(triplets.size());
+        _col_indices.reserve(triplets.size());
+
+        for (unsigned int r = 0; r <= ROWS; ++r)
+        {
+            _row_offsets[r] = 0;
+        }
+
+        for (unsigned int i = 0; i < triplets.size(); ++i)
+        {
+            const Triplet& t = triplets[i];
+            assert(t.row < ROWS && t.col < COLS);
+
+            if (i > 0 && t.row == triplets[i-1].row && t.col == triplets[i-1].col)
+            {
+                _values.back() += t.value;
+            }
+            else
+            {
+                _values.push_back(t.value);
+                _col_indices.push_back(t.col);
+                _row_offsets[t.row + 1]++;
+            }
+        }
+
+        for (unsigned int r = 0; r < ROWS; ++r)
+        {
+            _row_offsets[r + 1] += _row_offsets[r];
+        }
+    }
+
+    /**
+     * \brief Sets matrix from the given dense matrix.
+     * \param matrix dense matrix
+     * \param eps elements of magnitude not greater than this value are not stored
+     */
+    void SetFromMatrix(const MatrixMxN<TYPE, ROWS, COLS>& matrix, double eps = 0.0)
+    {
+        _values.clear();
+        _col_indices.clear();
+        _row_offsets[0] = 0;
+
+        for (unsigned int r = 0; r < ROWS; ++r)
+        {
+            for (unsigned int c = 0; c < COLS; ++c)
+            {
+                if (fabs(matrix(r,c)) > eps)
+                {
+                    _values.push_back(matrix(r,c));
+                    _col_indices.push_back(c);
+                }
+            }
+            _row_offsets[r + 1] = static_cast<unsigned int>(_values.size());
+        }
+    }
+
+    /**
+     * \brief Checks if all stored elements are valid.
+     * \return true if all stored elements are valid, false otherwise
+     */
+    bool IsValid() const
+    {
+        return mc::IsValid(_values.data(), static_cast<unsigned int>(_values.size()));
+    }
+
+    /** \return number of stored elements */
+    inline unsigned int GetNonZerosCount() const
+    {
+        return static_cast<unsigned int>(_values.size());
+    }
+
+    /**
+     * \brief Returns pointer to the stored element value.
+     * Allows updating values without rebuilding the sparsity pattern.
+     * \param row element row
+     * \param col element column
+     * \return pointer to the element value, nullptr if element is not stored
+     */
+    TYPE* GetValuePtr(unsigned int row, unsigned int col)
+    {
+        int index = FindIndex(row, col);
+        return index < 0 ? nullptr : &_values[index];
+    }
+
+    /**
+     * \brief Multiplies matrix by vector.
+     * \param vect vector
+     * \param result result vector, must not be the given vector
+     */
+    void MultiplyByVector(const VectorN<TYPE, COLS>& vect, VectorN<TYPE, ROWS>* result) const
+    {
+        for (unsigned int r = 0; r < ROWS; ++r)
+        {
+            TYPE sum = TYPE{0};
+            for (unsigned int i = _row_offsets[r]; i < _row_offsets[r + 1]; ++i)
+            {
+                sum += _values[i] * vect(_col_indices[i]);
+            }
+            (*result)(r) = sum;
+        }
+    }
+
+    /** \return stored element values, row by row */
+    inline const std::vector<TYPE>& GetValues() const { return _values; }
+
+    /** \return stored element column indices */
+    inline const std::vector<unsigned int>& GetColIndices() const { return _col_indices; }
+
+    /** \return index of the first stored element of the given row, last item is the number of stored elements */
+    inline const unsigned int* GetRowOffsets() const { return _row_offsets; }
+
+    /**
+     * \brief Element accessor.
+     * \param row element row
+     * \param col element column
+     * \return element value, zero if element is not stored
+     */
+    TYPE operator()(unsigned int row, unsigned int col) const
+    {
+        int index = FindIndex(row, col);
+        return index < 0 ? TYPE{0} : _values[index];
+    }
+
+    /** \brief Multiplication operator (by vector). */
+    VectorN<TYPE, ROWS> operator*(const VectorN<TYPE, COLS>& vect) const
+    {
+        VectorN<TYPE, ROWS> result;
+        MultiplyByVector(vect, &result);
+        return result;
+    }
+
+protected:
+
+    std::vector<TYPE> _values;                      ///< stored element values
+    std::vector<unsigned int> _col_indices;         ///< stored element column indices
+    unsigned int _row_offsets[ROWS + 1] = { 0 };    ///< index of the first stored element of each row
+
+    /**
+     * \brief Finds index of the stored element using binary search within the row.
+     * \param row element row
+     * \param col element column
+     * \return element index, -1 if element is not stored
+     */
+    int FindIndex(unsigned int row, unsigned int col) const
+    {
+        assert(row < ROWS && col < COLS);
+
+        auto begin = _col_indices.begin() + _row_offsets[row];
+        auto end   = _col_indices.begin() + _row_offsets[row + 1];
+        auto iter  = std::lower_bound(begin, end, col);
+
+        if (iter != end && *iter == col)
+        {
+            return static_cast<int>(iter - _col_indices.begin());
+        }
+
+        return -1;
+    }
+};
+
+} // namespace mc
+
+#endif // MCUTILS_MATH_SPARSEMATRIX_H_
@@ -0,0 +1,186 @@
+/****************************************************************************//*
+ * Copyright (C) 2026 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_STATICTABLE_H_
+#define MCUTILS_MATH_STATICTABLE_H_
+
+#include <array>
+#include <limits>
+#include <vector>
+
+#include <mcutils/math/Table.h>
+
+namespace mc {
+
+/**
+ * \brief Compile-time table and linear interpolation class template.
+ * Table data is stored in fixed size arrays and interpolation data is
+ * calculated by the constexpr constructor, so tables defined as constexpr
+ * variables require neither heap allocation nor startup computations.
+ * \tparam KEY_TYPE key type
+ * \tparam VAL_TYPE value type
+ * \tparam SIZE number of table elements
+ */
+template <typename KEY_TYPE, typename VAL_TYPE, unsigned int SIZE>
+class StaticTable
+{
+public:
+
+    static_assert(SIZE > 0, "Table has to have at least one element.");
+
+    static constexpr unsigned int kSize = SIZE;         ///< number of table elements
+    static constexpr unsigned int kLast = SIZE - 1;     ///< last element index
+
+    /**
+     * \brief Constructor.
+     * \param key_values key values ordered array
+     * \param table_data table values ordered array
+     */
+    constexpr StaticTable(const std::array<KEY_TYPE, SIZE>& key_values,
+                          const std::array<VAL_TYPE, SIZE>& table_data)
+        : _key_values(key_values)
+        , _table_data(table_data)
+    {
+        for (unsigned int i = 0; i < kLast; ++i)
+        {
+            _inter_data[i] = static_cast<double>(_table_data[i + 1] - _table_data[i])
+                           / static_cast<double>(_key_values[i + 1] - _key_values[i]);
+        }
+    }
+
+    /**
+     * \brief Returns key for the given index.
+     * \param index index
+     * \return key value on success or NaN on failure
+     */
+    constexpr KEY_TYPE GetKeyByIndex(unsigned int index) const
+    {
+        if (index < SIZE)
+        {
+            return _key_values[index];
+        }
+
+        return KEY_TYPE{std::numeric_limits<double>::quiet_NaN()};
+    }
+
+    /**
+     * \brief Returns table value for the given key.
+     * Returns table value for the given key value using linear interpolation
+     * algorithm. This function does not modify any state.
+     * \param key_value key value
+     * \return interpolated value
+     */
+    constexpr VAL_TYPE GetValue(KEY_TYPE key_value) const
+    {
+        if (key_value <= _key_values[0])
+        {
+            return _table_data[0];
+        }
+
+        if (key_value >= _key_values[kLast])
+        {
+            return _table_data[kLast];
+        }
+
+        // binary search
+        // invariant: _key_values[lo] <= key_value < _key_values[hi]
+        unsigned int lo = 0;
+        unsigned int hi = kLast;
+
+        while (hi - lo > 1)
+        {
+            unsigned int mid = lo + (hi - lo) / 2;
+
+            if (key_value < _key_values[mid])
+            {
+                hi = mid;
+            }
+            else
+            {
+                lo = mid;
+            }
+        }
+
+        return (key_value - _key_values[lo]) * VAL_TYPE{_inter_data[lo]} + _table_data[lo];
+    }
+
+    /**
+     * \brief Returns table value for the given key index.
+     * \param key_index key index
+     * \return value on success or NaN on failure
+     */
+    constexpr VAL_TYPE GetValueByIndex(unsigned int key_index) const
+    {
+        if (key_index < SIZE)
+        {
+            return _table_data[key_index];
+        }
+
+        return VAL_TYPE{std::numeric_limits<double>::quiet_NaN()};
+    }
+
+    /**
+     * \brief Returns table first value.
+     * \return table first value
+     */
+    constexpr VAL_TYPE GetFirstValue() const
+    {
+        return _table_data[0];
+    }
+
+    /**
+     * \brief Returns table last value.
+     * \return table last value
+     */
+    constexpr VAL_TYPE GetLastValue() const
+    {
+        return _table_data[kLast];
+    }
+
+    /**
+     * \brief Returns dynamic table initialized with this table data.
+     * \return dynamic table
+     */
+    Table<KEY_TYPE,VAL_TYPE> GetTable() const
+    {
+        std::vector<KEY_TYPE> key_values(_key_values.begin(), _key_values.end());
+        std::vector<VAL_TYPE> table_data(_table_data.begin(), _table_data.end());
+        return Table<KEY_TYPE,VAL_TYPE>(key_values, table_data);
+    }
+
+    inline constexpr unsigned int size() const { return SIZE; }
+
+    /** \brief Conversion operator. */
+    operator Table<KEY_TYPE,VAL_TYPE>() const
+    {
+        return GetTable();
+    }
+
+private:
+
+    std::array<KEY_TYPE, SIZE> _key_values;         ///< key values
+    std::array<VAL_TYPE, SIZE> _table_data;         ///< table data
+    std::array<double, SIZE> _inter_data = {};      ///< interpolation data
+};
+
+} // namespace mc
+
+#endif // MCUTILS_MATH_STATICTABLE_H_
@@ -22,13 +22,25 @@
 #ifndef MCUTILS_MATH_TABLE_H_
 #define MCUTILS_MATH_TABLE_H_
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <limits>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include <mcutils/Result.h>
+
+#include <mcutils/math/TableBinary.h>
+
 #include <mcutils/misc/Check.h>
 #include <mcutils/misc/PtrUtils.h>
 #include <mcutils/misc/String.h>
@@ -36,39 +48,158 @@
 namespace mc {
 
 /**
- * \brief Table and linear interpolation class template.
+ * \brief Table interpolation data scalar type.
+ * Interpolation data (slopes and polynomial coefficients) is stored with
+ * the precision of the table values, i.e. as float for float values and
+ * float based units, and as double otherwise. Single precision tables take
+ * half the memory bandwidth, while interpolation is always computed in
+ * double precision.
  */
-template <typename KEY_TYPE, typename VAL_TYPE>
-class Table
+template <typename VAL_TYPE, typename = void>
+struct TableScalar
 {
-public:
+    using type = double;
+};
 
-    /** \brief Copy constructor. */
-    Table(const Table<KEY_TYPE,VAL_TYPE>& table)
-        : _size(table._size)
-        , _last(table._last)
+/** \brief Table interpolation data scalar type for float values. */
+template <>
+struct TableScalar<float>
+{
+    using type = float;
+};
+
+/** \brief Table interpolation data scalar type for units values. */
+template <typename VAL_TYPE>
+struct TableScalar<VAL_TYPE, std::void_t<typename VAL_TYPE::underlying_type>>
+{
+    using type = typename TableScalar<typename VAL_TYPE::underlying_type>::type;
+};
+
+/**
+ * \brief Table lookup cursor.
+ * Caller owned search hint used by Table lookups. Each thread should use its
+ * own cursor, so one immutable table may be shared between threads.
+ */
+struct TableCursor
+{
+    unsigned int index = 0;     ///< recently found interval index
+};
+
+/**
+ * \brief Table interpolation method.
+ */
+enum class TableInterpolation
+{
+    Linear,             ///< linear interpolation
+    MonotoneCubic,      ///< monotone cubic Hermite interpolation (Fritsch-Carlson)
+    Akima               ///< Akima spline interpolation
+};
+
+/**
+ * \brief Finds index of the interval containing the given key.
+ * Searches sorted keys of a single table axis. Key value has to be within
+ * keys range, the last interval contains the last key.
+ * \param key_values key values array
+ * \param count number of keys
+ * \param key_value key value
+ * \param hint index of the interval where searching starts
+ * \return index of the interval beginning
+ */
+template <typename KEY_TYPE>
+inline unsigned int FindTableInterval(const KEY_TYPE* key_values, unsigned int count,
+                                      KEY_TYPE key_value, unsigned int hint)
+{
+    if (count < 2)
     {
-        if (_size > 0)
+        return 0;
+    }
+
+    const unsigned int last = count - 2;
+
+    // it is possible that new query is within the same or neighbouring
+    // interval so there is no need to search through all the data
+    if (hint <= last)
+    {
+        if (key_value >= key_values[hint])
         {
-            CreateArrays();
+            if (key_value < key_values[hint + 1] || hint == last)
+            {
+                return hint;
+            }
 
-            for (unsigned int i = 0; i < _size; ++i)
+            if (key_value < key_values[hint + 2] || hint + 1 == last)
             {
-                _key_values[i] = table._key_values[i];
-                _table_data[i] = table._table_data[i];
-                _inter_data[i] = table._inter_data[i];
+                return hint + 1;
             }
         }
+        else if (hint > 0 && key_value >= key_values[hint - 1])
+        {
+            return hint - 1;
+        }
+    }
+
+    // branch-free binary search for the last interval beginning
+    // less or equal to the given key
+    unsigned int index = 0;
+    unsigned int len = count - 1;
+
+    while (len > 1)
+    {
+        const unsigned int half = len / 2;
+        index += (key_value >= key_values[index + half]) ? half : 0;
+        len -= half;
     }
 
+    return index;
+}
+
+template <typename DERIVED> class TableExpr;
+template <typename KEY_TYPE, typename VAL_TYPE> class TableTerm;
+
+/**
+ * \brief Table and interpolation class template.
+ * Linear interpolation is used by default, cubic interpolation methods can
+ * be selected with SetInterpolation().
+ */
+template <typename KEY_TYPE, typename VAL_TYPE>
+class Table
+{
+    template <typename DERIVED> friend class TableExpr;
+    template <typename KEY, typename VAL> friend class TableTerm;
+
+public:
+
+    /**
+     * \brief Copy constructor.
+     * Table data is not copied but shared, see MakeArraysUnique().
+     */
+    Table(const Table<KEY_TYPE,VAL_TYPE>& table)
+        : _size(table._size)
+        , _last(table._last)
+        , _uniform(table._uniform)
+        , _step_inv(table._step_inv)
+        , _interpolation(table._interpolation)
+
+        , _key_values(table._key_values)
+        , _records(table._records)
+        , _cubic_data(table._cubic_data)
+
+        , _storage(table._storage)
+    {}
+
     /** \brief Move constructor. */
     Table(Table<KEY_TYPE,VAL_TYPE>&& table) noexcept
         : _size(std::exchange(table._size, 0))
         , _last(std::exchange(table._last, 0))
+        , _uniform(std::exchange(table._uniform, false))
+        , _step_inv(std::exchange(table._step_inv, 0.0))
+        , _interpolation(std::exchange(table._interpolation, TableInterpolation::Linear))
 
         , _key_values(std::exchange(table._key_values, nullptr))
-        , _table_data(std::exchange(table._table_data, nullptr))
-        , _inter_data(std::exchange(table._inter_data, nullptr))
+        , _records(std::exchange(table._records, nullptr))
+        , _cubic_data(std::exchange(table._cubic_data, nullptr))
+
+        , _storage(std::move(table._storage))
     {}
 
     /**
@@ -86,8 +217,9 @@ public:
         CreateArrays();
 
         _key_values[0] = key;
-        _table_data[0] = val;
-        _inter_data[0] = 0.0;
+
+        _records[0].value = val;
+        _records[0].slope = 0.0;
     }
 
     /**
@@ -128,52 +260,32 @@ public:
      */
     KEY_TYPE GetKeyOfValueMin() const
     {
-        KEY_TYPE result    = KEY_TYPE{ std::numeric_limits<double>::quiet_NaN() };
-        VAL_TYPE min_value = VAL_TYPE{ std::numeric_limits<double>::max() };
-
-        for (unsigned int i = 0; i < _size; ++i)
+        if (_size > 0)
         {
-            if (_table_data[i] < min_value)
-            {
-                result = _key_values[i];
-                min_value = _table_data[i];
-            }
+            return _key_values[ScanIndexOfExtremum<false>(0, _last)];
         }
 
-        return result;
+        return KEY_TYPE{ std::numeric_limits<double>::quiet_NaN() };
     }
 
     /**
      * \brief Returns key of minimum table value within given range.
+     * Wide ranges are queried using range index which is built on first
+     * use and shared between copies of the table.
      * \param key_min range minimum
      * \param key_max range maximum
      * \return key of minimum table value
      */
     KEY_TYPE GetKeyOfValueMin(KEY_TYPE key_min, KEY_TYPE key_max) const
     {
-        KEY_TYPE result    = KEY_TYPE{ std::numeric_limits<double>::quiet_NaN() };
-        VAL_TYPE min_value = { std::numeric_limits<double>::max() };
+        unsigned int index = 0;
 
-        for (unsigned int i = 0; i < _size; ++i)
+        if (FindIndexOfExtremum<false>(key_min, key_max, &index))
         {
-            if (_table_data[i] < min_value)
-            {
-                if (_key_values[i] <= key_max)
-                {
-                    if (_key_values[i] >= key_min)
-                    {
-                        result = _key_values[i];
-                        min_value = _table_data[i];
-                    }
-                }
-                else
-                {
-                    break;
-                }
-            }
+            return _key_values[index];
         }
 
-        return result;
+        return KEY_TYPE{ std::numeric_limits<double>::quiet_NaN() };
     }
 
     /**
@@ -182,97 +294,177 @@ public:
      */
     KEY_TYPE GetKeyOfValueMax() const
     {
-        KEY_TYPE result    = KEY_TYPE{ std::numeric_limits<double>::quiet_NaN() };
-        VAL_TYPE max_value = VAL_TYPE{ std::numeric_limits<double>::min() };
-
-        for (unsigned int i = 0; i < _size; ++i)
+        if (_size > 0)
         {
-            if (_table_data[i] > max_value)
-            {
-                result = _key_values[i];
-                max_value = _table_data[i];
-            }
+            return _key_values[ScanIndexOfExtremum<true>(0, _last)];
         }
 
-        return result;
+        return KEY_TYPE{ std::numeric_limits<double>::quiet_NaN() };
     }
 
     /**
      * \brief Returns key of maximum table value within given range.
+     * Wide ranges are queried using range index which is built on first
+     * use and shared between copies of the table.
      * \param key_min range minimum
      * \param key_max range maximum
      * \return key of maximum table value
      */
     KEY_TYPE GetKeyOfValueMax(KEY_TYPE key_min, KEY_TYPE key_max) const
     {
-        KEY_TYPE result    = KEY_TYPE{ std::numeric_limits<double>::quiet_NaN() };
-        VAL_TYPE max_value = VAL_TYPE{ std::numeric_limits<double>::min() };
+        unsigned int index = 0;
 
-        for (unsigned int i = 0; i < _size; ++i)
+        if (FindIndexOfExtremum<true>(key_min, key_max, &index))
         {
-            if (_table_data[i] > max_value)
-            {
-                if (_key_values[i] <= key_max)
-                {
-                    if (_key_values[i] >= key_min)
-                    {
-                        result = _key_values[i];
-                        max_value = _table_data[i];
-                    }
-                }
-                else
-                {
-                    break;
-                }
-            }
+            return _key_values[index];
         }
 
-        return result;
+        return KEY_TYPE{ std::numeric_limits<double>::quiet_NaN() };
     }
 
     /**
      * \brief Returns table value for the given key.
      * Returns table value for the given key value using linear interpolation
-     * algorithm.
+     * algorithm. Recently found interval is stored inside the table object
+     * to speed up subsequent queries, therefore this function should not be
+     * called on a table shared between threads. Use GetValue(KEY_TYPE,TableCursor*)
+     * or GetValueStateless(KEY_TYPE) instead.
      * \param key_value key value
      * \return interpolated value on success or NaN on failure
      */
     VAL_TYPE GetValue(KEY_TYPE key_value) const
     {
-        if (_size > 0)
+        return CalculateValue(key_value, &_prev);
+    }
+
+    /**
+     * \brief Returns table value for the given key.
+     * Returns table value for the given key value using linear interpolation
+     * algorithm. Recently found interval is stored in the given caller owned
+     * cursor, so the table itself is not modified.
+     * \param key_value key value
+     * \param cursor lookup cursor
+     * \return interpolated value on success or NaN on failure
+     */
+    VAL_TYPE GetValue(KEY_TYPE key_value, TableCursor* cursor) const
+    {
+        return CalculateValue(key_value, &cursor->index);
+    }
+
+    /**
+     * \brief Returns table value for the given key.
+     * Returns table value for the given key value using linear interpolation
+     * algorithm. Neither the table nor any other state is modified.
+     * \param key_value key value
+     * \return interpolated value on success or NaN on failure
+     */
+    VAL_TYPE GetValueStateless(KEY_TYPE key_value) const
+    {
+        unsigned int prev = _last;
+        return CalculateValue(key_value, &prev);
+    }
+
+    /**
+     * \brief Returns table values for the given keys.
+     * Keys are processed in blocks. Sorted blocks are evaluated sequentially
+     * starting from the recently found interval. For unsorted blocks
+     * branch-free binary searches for all the keys are run in lockstep, so
+     * they do not suffer from branch mispredictions and can be vectorized
+     * by the compiler.
+     * \param key_values key values array
+     * \param values output array of interpolated values (NaN on failure)
+     * \param count number of keys
+     */
+    void GetValues(const KEY_TYPE* key_values, VAL_TYPE* values, unsigned int count) const
+    {
+        if (_size == 0)
         {
-            // checking if previous index is still valid
-            // change between two subsequent queries is typically small
-            // it is possible that new query is within the same interval
-            // so there is no need to iterate through all the data
-            if (DoesIndexMatchKey(_prev, key_value))
+            for (unsigned int i = 0; i < count; ++i)
             {
-                return CalculateInterpolatedValue(_prev, key_value);
+                values[i] = VAL_TYPE{ std::numeric_limits<double>::quiet_NaN() };
             }
 
-            if (key_value <= _key_values[0])
+            return;
+        }
+
+        constexpr unsigned int kBlockSize = 64;
+
+        KEY_TYPE keys[kBlockSize];
+        unsigned int indices[kBlockSize];
+
+        unsigned int prev = 0;
+
+        for (unsigned int i0 = 0; i0 < count; i0 += kBlockSize)
+        {
+            const unsigned int n = std::min(kBlockSize, count - i0);
+
+            bool sorted = true;
+            for (unsigned int j = 1; j < n; ++j)
             {
-                _prev = 0;
-                return _table_data[0];
+                sorted &= !(key_values[i0 + j] < key_values[i0 + j - 1]);
             }
 
-            if (key_value >= _key_values[_last])
+            if (sorted)
+            {
+                for (unsigned int j = 0; j < n; ++j)
+                {
+                    values[i0 + j] = CalculateValue(key_values[i0 + j], &prev);
+                }
+
+                continue;
+            }
+
+            for (unsigned int j = 0; j < n; ++j)
             {
-                _prev = _last;
-                return _table_data[_last];
+                KEY_TYPE key_value = key_values[i0 + j];
+                if (key_value < _key_values[0])     key_value = _key_values[0];
+                if (key_value > _key_values[_last]) key_value = _key_values[_last];
+                keys[j] = key_value;
+                indices[j] = 0;
             }
 
-            for (unsigned int i = 0; i < _size; ++i)
+            // after the search index points to the last key less or equal
+            // to the given key, interpolation data of the last element is 0
+            if (_uniform)
+            {
+                for (unsigned int j = 0; j < n; ++j)
+                {
+                    indices[j] = (keys[j] < _key_values[_last]) ? FindIndexUniform(keys[j]) : _last;
+                }
+            }
+            else
             {
-                if (DoesIndexMatchKey(i, key_value))
+                unsigned int len = _size;
+                while (len > 1)
                 {
-                    _prev = i;
-                    return CalculateInterpolatedValue(i, key_value);
+                    const unsigned int half = len / 2;
+                    for (unsigned int j = 0; j < n; ++j)
+                    {
+                        indices[j] += (keys[j] >= _key_values[indices[j] + half]) ? half : 0;
+                    }
+                    len -= half;
                 }
             }
+
+            for (unsigned int j = 0; j < n; ++j)
+            {
+                values[i0 + j] = CalculateInterpolatedValue(indices[j], keys[j]);
+            }
+
+            prev = indices[n - 1];
         }
+    }
 
-        return VAL_TYPE{ std::numeric_limits<double>::quiet_NaN() };
+    /**
+     * \brief Returns table values for the given keys.
+     * \param key_values key values vector
+     * \return vector of interpolated values (NaN on failure)
+     */
+    std::vector<VAL_TYPE> GetValues(const std::vector<KEY_TYPE>& key_values) const
+    {
+        std::vector<VAL_TYPE> values(key_values.size());
+        GetValues(key_values.data(), values.data(), static_cast<unsigned int>(key_values.size()));
+        return values;
     }
 
     /**
@@ -284,7 +476,7 @@ public:
     {
         if (_size > 0 && key_index < _size)
         {
-            return _table_data[key_index];
+            return _records[key_index].value;
         }
 
         return VAL_TYPE{ std::numeric_limits<double>::quiet_NaN() };
@@ -298,7 +490,7 @@ public:
     {
         if (_size > 0)
         {
-            return _table_data[0];
+            return _records[0].value;
         }
 
         return VAL_TYPE{ std::numeric_limits<double>::quiet_NaN() };
@@ -312,7 +504,7 @@ public:
     {
         if (_size > 0)
         {
-            return _table_data[_last];
+            return _records[_last].value;
         }
 
         return VAL_TYPE{ std::numeric_limits<double>::quiet_NaN() };
@@ -332,9 +524,9 @@ public:
 
             for (unsigned int i = 0; i < _size; ++i)
             {
-                if ( _table_data[i] < result )
+                if ( _records[i].value < result )
                 {
-                    result = _table_data[i];
+                    result = _records[i].value;
                 }
             }
         }
@@ -356,9 +548,9 @@ public:
 
             for (unsigned int i = 0; i < _size; ++i)
             {
-                if (_table_data[i] > result)
+                if (_records[i].value > result)
                 {
-                    result = _table_data[i];
+                    result = _records[i].value;
                 }
             }
         }
@@ -377,8 +569,8 @@ public:
         for (unsigned int i = 0; i < _size; ++i)
         {
             if (result) result = mc::IsValid(_key_values[i]);
-            if (result) result = mc::IsValid(_table_data[i]);
-            if (result) result = mc::IsValid(_inter_data[i]);
+            if (result) result = mc::IsValid(_records[i].value);
+            if (result) result = mc::IsValid(_records[i].slope);
 
             if (!result) break;
         }
@@ -392,6 +584,8 @@ public:
      */
     void MultiplyKeys(double factor)
     {
+        MakeArraysUnique();
+
         for (unsigned int i = 0; i < _size; ++i)
         {
             _key_values[i] *= factor;
@@ -406,9 +600,11 @@ public:
      */
     void MultiplyValues(double factor)
     {
+        MakeArraysUnique();
+
         for (unsigned int i = 0; i < _size; ++i)
         {
-            _table_data[i] *= factor;
+            _records[i].value *= factor;
         }
 
         UpdateInterpolationData();
@@ -422,28 +618,22 @@ public:
     void SetData(const std::vector<KEY_TYPE>& key_values,
                  const std::vector<VAL_TYPE>& table_data)
     {
-        DeleteArrays();
-
-        _size = 0;
-        _last = 0;
-        _prev = 0;
-
         if (key_values.size() > 0 && key_values.size() == table_data.size())
         {
-            _size = static_cast<unsigned int>(key_values.size());
-            _last = _size - 1;
-
-            CreateArrays();
+            ResetArrays(static_cast<unsigned int>(key_values.size()));
 
             for (unsigned int i = 0; i < _size; ++i)
             {
                 _key_values[i] = key_values[i];
-                _table_data[i] = table_data[i];
-                _inter_data[i] = 0.0;
+                _records[i].value = table_data[i];
             }
 
             UpdateInterpolationData();
         }
+        else
+        {
+            ResetArrays(0);
+        }
     }
 
     /**
@@ -453,36 +643,37 @@ public:
      */
     void SetFromString(const char* str)
     {
-        std::vector<KEY_TYPE> key_values_temp;
-        std::vector<VAL_TYPE> table_data_temp;
+        std::string_view sv(str);
+
+        unsigned int count = String::CountTokens(sv);
+        bool valid = count > 0 && count % 2 == 0;
 
-        std::stringstream ss(String::StripSpaces(str));
-        bool valid = true;
+        // parsing straight into table arrays
+        ResetArrays(valid ? count / 2 : 0);
 
-        while (!ss.eof() && valid)
+        for (unsigned int i = 0; i < _size && valid; ++i)
         {
             double key = std::numeric_limits<double>::quiet_NaN();
             double val = std::numeric_limits<double>::quiet_NaN();
 
-            ss >> key;
-            ss >> val;
+            valid &= String::ParseNumber(&sv, &key) && mc::IsValid(key);
+            valid &= String::ParseNumber(&sv, &val) && mc::IsValid(val);
 
-            valid &= mc::IsValid(key) && mc::IsValid(val);
-
-            key_values_temp.push_back(KEY_TYPE{key});
-            table_data_temp.push_back(VAL_TYPE{val});
+            _key_values[i] = KEY_TYPE{key};
+            _records[i].value = VAL_TYPE{val};
         }
 
-        std::vector<KEY_TYPE> key_values { KEY_TYPE{ std::numeric_limits<double>::quiet_NaN() } };
-        std::vector<VAL_TYPE> table_data { VAL_TYPE{ std::numeric_limits<double>::quiet_NaN() } };
+        valid &= String::SkipSpaces(sv).empty();
 
-        if (valid)
+        if (!valid)
         {
-            key_values = key_values_temp;
-            table_data = table_data_temp;
+            ResetArrays(1);
+
+            _key_values[0] = KEY_TYPE{ std::numeric_limits<double>::quiet_NaN() };
+            _records[0].value = VAL_TYPE{ std::numeric_limits<double>::quiet_NaN() };
         }
 
-        SetData(key_values, table_data);
+        UpdateInterpolationData();
     }
 
     /**
@@ -495,30 +686,136 @@ public:
         for (unsigned int i = 0; i < _size; ++i)
         {
             ss << static_cast<double>(_key_values[i]) << "\t";
-            ss << static_cast<double>(_table_data[i]) << std::endl;
+            ss << static_cast<double>(_records[i].value) << std::endl;
         }
 
         return ss.str();
     }
 
+    /**
+     * \brief Returns binary representation of the table.
+     * Binary representation contains table data together with precomputed
+     * interpolation data, see TableBinaryHeader for format description.
+     * \return binary table data
+     */
+    std::vector<char> ToBinary() const
+    {
+        const std::uint64_t lengths[] = {
+            _size * sizeof(KEY_TYPE),
+            _size * sizeof(Record),
+            _cubic_data ? _size * sizeof(CubicData) : 0
+        };
+
+        const void* sections[] = { _key_values, _records, _cubic_data };
+
+        TableBinaryHeader header;
+        InitTableBinaryHeader(&header, lengths, 3);
+
+        header.dimensions    = 1;
+        header.key_size[0]   = sizeof(KEY_TYPE);
+        header.record_size   = sizeof(Record);
+        header.count[0]      = _size;
+        header.interpolation = static_cast<std::uint32_t>(_interpolation);
+        header.flags         = _uniform ? kTableBinaryFlagUniform : 0;
+        header.step_inv      = _step_inv;
+
+        return WriteTableBinary(header, sections);
+    }
+
+    /**
+     * \brief Sets table data from binary data.
+     * Table data is copied with a single memcpy per data section, no
+     * interpolation data is recalculated.
+     * \param data binary table data (see ToBinary())
+     * \param size binary table data size expressed in bytes
+     * \return Result::Success on success or Result::Failure on failure
+     */
+    Result SetFromBinary(const void* data, std::size_t size)
+    {
+        return LoadBinary(data, size, false);
+    }
+
+    /**
+     * \brief Wraps binary data without copying it.
+     * Table refers to the given data (e.g. memory mapped file region), which
+     * must remain valid and unchanged as long as the table uses it. Data has
+     * to be aligned to the kTableBinaryAlignment. Table makes its own copy
+     * of the data before any modification.
+     * \param data binary table data (see ToBinary())
+     * \param size binary table data size expressed in bytes
+     * \return Result::Success on success or Result::Failure on failure
+     */
+    Result WrapBinary(const void* data, std::size_t size)
+    {
+        return LoadBinary(data, size, true);
+    }
+
+    /** \return true if table wraps external data */
+    inline bool IsWrapped() const { return _storage && _storage->wrapped; }
+
+    /** \return true if table data is shared with other tables */
+    inline bool IsShared() const { return _storage && _storage.use_count() > 1; }
+
     inline unsigned int size() const { return _size; }
 
-    /** \brief Addition operator. */
+    /** \return true if table keys are equally spaced */
+    inline bool IsUniform() const { return _uniform; }
+
+    /** \return interpolation method */
+    inline TableInterpolation GetInterpolation() const { return _interpolation; }
+
+    /**
+     * \brief Sets interpolation method.
+     * Cubic interpolation coefficients are calculated once here and updated
+     * whenever table data changes, so evaluation requires only a single
+     * Horner step after the interval search.
+     * \param interpolation interpolation method
+     */
+    void SetInterpolation(TableInterpolation interpolation)
+    {
+        MakeArraysUnique();
+
+        _interpolation = interpolation;
+
+        if (_storage)
+        {
+            DeletePtrArray(_storage->cubic_data);
+
+            if (_interpolation != TableInterpolation::Linear)
+            {
+                _storage->cubic_data = new CubicData [_size];
+            }
+
+            _cubic_data = _storage->cubic_data;
+
+            UpdateInterpolationData();
+        }
+    }
+
+    /**
+     * \brief Addition operator.
+     * Resulting table keys are the keys of this table. Both tables are
+     * swept once, so the cost is linear in the sum of their sizes. To add
+     * tables on the merged set of keys or to combine more tables without
+     * intermediate results, use TableTerm expressions (see TableExpr.h).
+     */
     Table<KEY_TYPE,VAL_TYPE> operator+(const Table<KEY_TYPE,VAL_TYPE>& table) const
     {
-        std::vector<KEY_TYPE> key_values;
-        std::vector<VAL_TYPE> table_data;
+        Table<KEY_TYPE,VAL_TYPE> result;
+        result.ResetArrays(_size);
+
+        unsigned int index = 0;
 
         for (unsigned int i = 0; i < _size; ++i)
         {
-            KEY_TYPE key = _key_values[i];
-            VAL_TYPE val = _table_data[i] + table.GetValue(key);
-
-            key_values.push_back(key);
-            table_data.push_back(val);
+            result._key_values[i]    = _key_values[i];
+            result._records[i].value = _records[i].value
+                                     + table.CalculateValueForward(_key_values[i], &index);
         }
 
-        return Table<KEY_TYPE,VAL_TYPE> (key_values, table_data);
+        result.UpdateInterpolationData();
+
+        return result;
     }
 
     /** \brief Multiplication operator (by number). */
@@ -529,27 +826,27 @@ public:
         return result;
     }
 
-    /** \brief Assignment operator. */
+    /**
+     * \brief Assignment operator.
+     * Table data is not copied but shared, see MakeArraysUnique().
+     */
     Table<KEY_TYPE,VAL_TYPE>& operator=(const Table<KEY_TYPE,VAL_TYPE>& table)
     {
         if (this != &table)
         {
-            DeleteArrays();
-
             _size = table._size;
             _last = table._last;
 
-            if (_size > 0)
-            {
-                CreateArrays();
+            _uniform  = table._uniform;
+            _step_inv = table._step_inv;
 
-                for (unsigned int i = 0; i < _size; ++i)
-                {
-                    _key_values[i] = table._key_values[i];
-                    _table_data[i] = table._table_data[i];
-                    _inter_data[i] = table._inter_data[i];
-                }
-            }
+            _interpolation = table._interpolation;
+
+            _key_values = table._key_values;
+            _records    = table._records;
+            _cubic_data = table._cubic_data;
+
+            _storage = table._storage;
         }
 
         return *this;
@@ -563,79 +860,845 @@ public:
         _size = std::exchange(table._size, 0);
         _last = std::exchange(table._last, 0);
 
+        _uniform  = std::exchange(table._uniform, false);
+        _step_inv = std::exchange(table._step_inv, 0.0);
+
+        _interpolation = std::exchange(table._interpolation, TableInterpolation::Linear);
+
         _key_values = std::exchange(table._key_values, nullptr);
-        _table_data = std::exchange(table._table_data, nullptr);
-        _inter_data = std::exchange(table._inter_data, nullptr);
+        _records = std::exchange(table._records, nullptr);
+        _cubic_data = std::exchange(table._cubic_data, nullptr);
+
+        _storage = std::move(table._storage);
 
         return *this;
     }
 
 private:
 
-    unsigned int _size = 0;             ///< number of table elements
-    unsigned int _last = 0;             ///< last element index
-
-    KEY_TYPE* _key_values = nullptr;    ///< key values
-    VAL_TYPE* _table_data = nullptr;    ///< table data
-    double* _inter_data = nullptr;      ///< interpolation data
-
-    mutable unsigned int _prev = 0;     ///< previous index
+    using Scalar = typename TableScalar<VAL_TYPE>::type;   ///< interpolation data type
 
-    bool DoesIndexMatchKey(int index, KEY_TYPE key_value) const
+    /** \brief Table record data. */
+    struct RecordData
     {
-        return key_value >= _key_values[index] && key_value < _key_values[index+1];
-    }
+        VAL_TYPE value;             ///< table value
+        Scalar slope;               ///< interpolation data (gradient)
+    };
 
-    VAL_TYPE CalculateInterpolatedValue(int index, KEY_TYPE key_value) const
-    {
-        return (key_value - _key_values[index]) * VAL_TYPE{_inter_data[index]} + _table_data[index];
-    }
+    /**
+     * \brief Table record.
+     * Value and interpolation data used by a single interpolation are stored
+     * together, while keys are kept in a separate compact array used for
+     * searching. Record is aligned to the power of 2 not less than its size,
+     * so it never crosses cache line boundary.
+     */
+    struct alignas(sizeof(RecordData) <=  8 ?  8 :
+                   sizeof(RecordData) <= 16 ? 16 :
+                   sizeof(RecordData) <= 32 ? 32 : 64) Record : RecordData {};
 
     /**
-     * \brief Calculates interpolation data (gradient).
-     * \param key_0 current key
-     * \param value_0 current value
-     * \param key_1 next key
-     * \param value_1 next value
-     * \return
+     * \brief Cubic interpolation data.
+     * Higher order coefficients of the polynomial
+     * v(x) = v_i + c1*dx + c2*dx^2 + c3*dx^3, where dx = x - x_i
+     * and c1 is stored as the record slope.
      */
-    double CalculateInterpolationData(KEY_TYPE key_0, VAL_TYPE value_0,
-                                      KEY_TYPE key_1, VAL_TYPE value_1) const
+    struct CubicData
     {
-        return static_cast<double>(value_1 - value_0) / static_cast<double>(key_1 - key_0);
-    }
+        Scalar c2 = 0.0;            ///< 2nd order coefficient
+        Scalar c3 = 0.0;            ///< 3rd order coefficient
+    };
 
-    /** Creates data tables. */
-    void CreateArrays()
+    /**
+     * \brief Range minimum and maximum index.
+     * Sparse tables of indices of minimum and maximum values of all
+     * intervals of length 2^level. Extremum of any range is obtained
+     * by comparing two overlapping intervals, which takes O(1) time.
+     * In case of equal values the lowest index is kept.
+     *
+     * ### Refernces:
+     * - Bender M., Farach-Colton M.: The LCA Problem Revisited, 2000
+     * - [Range minimum query - Wikipedia](https://en.wikipedia.org/wiki/Range_minimum_query)
+     */
+    struct RangeIndex
     {
-        _key_values = new KEY_TYPE [_size];
-        _table_data = new VAL_TYPE [_size];
-        _inter_data = new double [_size];
-    }
+        unsigned int size   = 0;            ///< number of table elements
+        unsigned int levels = 0;            ///< number of levels
+
+        unsigned int* index_min = nullptr;  ///< indices of minimum values (levels x size)
+        unsigned int* index_max = nullptr;  ///< indices of maximum values (levels x size)
+
+        /**
+         * \brief Constructor.
+         * \param records table records
+         * \param size number of table elements
+         */
+        RangeIndex(const Record* records, unsigned int size)
+            : size(size)
+        {
+            while ((1u << levels) <= size) ++levels;
 
-    /** Deletes data tables. */
-    void DeleteArrays()
+            index_min = new unsigned int [levels * size];
+            index_max = new unsigned int [levels * size];
+
+            for (unsigned int i = 0; i < size; ++i)
+            {
+                index_min[i] = i;
+                index_max[i] = i;
+            }
+
+            for (unsigned int level = 1; level < levels; ++level)
+            {
+                const unsigned int half  = 1u << (level - 1);
+                const unsigned int count = size - (1u << level) + 1;
+
+                const unsigned int* prev_min = index_min + (level - 1) * size;
+                const unsigned int* prev_max = index_max + (level - 1) * size;
+
+                unsigned int* curr_min = index_min + level * size;
+                unsigned int* curr_max = index_max + level * size;
+
+                for (unsigned int i = 0; i < count; ++i)
+                {
+                    curr_min[i] = SelectExtremum<false>(records, prev_min[i], prev_min[i + half]);
+                    curr_max[i] = SelectExtremum<true >(records, prev_max[i], prev_max[i + half]);
+                }
+            }
+        }
+
+        RangeIndex(const RangeIndex&) = delete;
+        RangeIndex& operator=(const RangeIndex&) = delete;
+
+        ~RangeIndex()
+        {
+            DeletePtrArray(index_min);
+            DeletePtrArray(index_max);
+        }
+
+        /**
+         * \brief Returns index of extremum value within given index range.
+         * \tparam MAX specifies if maximum (true) or minimum (false) is requested
+         * \param records table records
+         * \param first first index of the range
+         * \param last last index of the range
+         * \return index of extremum value
+         */
+        template <bool MAX>
+        unsigned int Query(const Record* records, unsigned int first, unsigned int last) const
+        {
+            const unsigned int length = last - first + 1;
+
+            unsigned int level = 0;
+            while ((2u << level) <= length) ++level;
+
+            const unsigned int* index = (MAX ? index_max : index_min) + level * size;
+
+            return SelectExtremum<MAX>(records, index[first], index[last + 1 - (1u << level)]);
+        }
+    };
+
+    /**
+     * \brief Table data storage.
+     * Storage is shared between copies of the table and is never modified
+     * while shared, see MakeArraysUnique().
+     */
+    struct Storage
+    {
+        KEY_TYPE*  key_values = nullptr;    ///< key values
+        Record*    records    = nullptr;    ///< interleaved table records
+        CubicData* cubic_data = nullptr;    ///< cubic interpolation data (cubic methods only)
+
+        bool wrapped = false;               ///< specifies if arrays point to wrapped external memory
+
+        std::atomic<RangeIndex*> range_index { nullptr };   ///< range index (built on demand)
+        std::mutex range_index_mutex;                       ///< range index building mutex
+
+        Storage() = default;
+        Storage(const Storage&) = delete;
+        Storage& operator=(const Storage&) = delete;
+
+        ~Storage()
+        {
+            ResetRangeIndex();
+
+            if (!wrapped)
+            {
+                DeletePtrArray(key_values);
+                DeletePtrArray(records);
+                DeletePtrArray(cubic_data);
+            }
+        }
+
+        /** \brief Deletes range index, has to be called when table data changes. */
+        void ResetRangeIndex()
+        {
+            RangeIndex* index = range_index.exchange(nullptr);
+            DeletePtr(index);
+        }
+    };
+
+    unsigned int _size = 0;             ///< number of table elements
+    unsigned int _last = 0;             ///< last element index
+
+    bool _uniform = false;              ///< specifies if keys are equally spaced
+    double _step_inv = 0.0;             ///< inverse of keys step (uniform tables only)
+
+    TableInterpolation _interpolation = TableInterpolation::Linear; ///< interpolation method
+
+    KEY_TYPE* _key_values = nullptr;    ///< key values (storage array)
+    Record* _records = nullptr;         ///< interleaved table records (storage array)
+    CubicData* _cubic_data = nullptr;   ///< cubic interpolation data (storage array)
+
+    std::shared_ptr<Storage> _storage;  ///< table data storage
+
+    mutable unsigned int _prev = 0;     ///< previous index
+
+    /**
+     * \brief Minimum index range length for which range index is used.
+     * Shorter ranges are scanned as it is faster than sparse table lookup.
+     */
+    static constexpr unsigned int kRangeIndexMinLength = 32;
+
+    /**
+     * \brief Selects index of extremum value out of two indices.
+     * \tparam MAX specifies if maximum (true) or minimum (false) is requested
+     * \param records table records
+     * \param index_1 first index, selected in case of equal values
+     * \param index_2 second index
+     * \return index of extremum value
+     */
+    template <bool MAX>
+    static inline unsigned int SelectExtremum(const Record* records,
+                                              unsigned int index_1,
+                                              unsigned int index_2)
+    {
+        if (MAX)
+        {
+            return records[index_2].value > records[index_1].value ? index_2 : index_1;
+        }
+
+        return records[index_2].value < records[index_1].value ? index_2 : index_1;
+    }
+
+    /**
+     * \brief Finds range of indices of keys within given range.
+     * \param key_min range minimum
+     * \param key_max range maximum
+     * \param first output first index
+     * \param last output last index
+     * \return true if range is not empty, false otherwise
+     */
+    bool FindIndexRange(KEY_TYPE key_min, KEY_TYPE key_max,
+                        unsigned int* first, unsigned int* last) const
+    {
+        const KEY_TYPE* begin = _key_values;
+        const KEY_TYPE* end   = _key_values + _size;
+
+        const KEY_TYPE* lower = std::lower_bound(begin, end, key_min);
+        const KEY_TYPE* upper = std::upper_bound(lower, end, key_max);
+
+        if (lower < upper)
+        {
+            *first = static_cast<unsigned int>(lower - begin);
+            *last  = static_cast<unsigned int>(upper - begin) - 1;
+            return true;
+        }
+
+        return false;
+    }
+
+    /**
+     * \brief Scans table for index of extremum value within given index range.
+     * \tparam MAX specifies if maximum (true) or minimum (false) is requested
+     * \param first first index of the range
+     * \param last last index of the range
+     * \return index of extremum value
+     */
+    template <bool MAX>
+    unsigned int ScanIndexOfExtremum(unsigned int first, unsigned int last) const
+    {
+        unsigned int result = first;
+
+        for (unsigned int i = first + 1; i <= last; ++i)
+        {
+            result = SelectExtremum<MAX>(_records, result, i);
+        }
+
+        return result;
+    }
+
+    /**
+     * \brief Finds index of extremum value within given keys range.
+     * Small tables are scanned in a single pass, otherwise the keys range
+     * bounds are found by bisection and range index is used for wide ranges.
+     * \tparam MAX specifies if maximum (true) or minimum (false) is requested
+     * \param key_min range minimum
+     * \param key_max range maximum
+     * \param index output index of extremum value
+     * \return true if range is not empty, false otherwise
+     */
+    template <bool MAX>
+    bool FindIndexOfExtremum(KEY_TYPE key_min, KEY_TYPE key_max, unsigned int* index) const
+    {
+        if (_size < kRangeIndexMinLength)
+        {
+            bool found = false;
+
+            for (unsigned int i = 0; i < _size; ++i)
+            {
+                if (_key_values[i] < key_min) continue;
+                if (key_max < _key_values[i]) break;
+
+                *index = found ? SelectExtremum<MAX>(_records, *index, i) : i;
+                found = true;
+            }
+
+            return found;
+        }
+
+        unsigned int first = 0;
+        unsigned int last  = 0;
+
+        if (FindIndexRange(key_min, key_max, &first, &last))
+        {
+            if (last - first < kRangeIndexMinLength)
+            {
+                *index = ScanIndexOfExtremum<MAX>(first, last);
+            }
+            else
+            {
+                *index = GetRangeIndex()->template Query<MAX>(_records, first, last);
+            }
+
+            return true;
+        }
+
+        return false;
+    }
+
+    /**
+     * \brief Returns range index, builds it if necessary.
+     * Range index is built once per storage, it is safe to call this
+     * function concurrently from many threads.
+     * \return range index
+     */
+    const RangeIndex* GetRangeIndex() const
+    {
+        RangeIndex* index = _storage->range_index.load(std::memory_order_acquire);
+
+        if (!index)
+        {
+            std::lock_guard<std::mutex> lock(_storage->range_index_mutex);
+
+            index = _storage->range_index.load(std::memory_order_relaxed);
+
+            if (!index)
+            {
+                index = new RangeIndex(_records, _size);
+                _storage->range_index.store(index, std::memory_order_release);
+            }
+        }
+
+        return index;
+    }
+
+    /**
+     * \brief Calculates table value for the given key.
+     * \param key_value key value
+     * \param prev previously found interval index, updated on return
+     * \return interpolated value on success or NaN on failure
+     */
+    VAL_TYPE CalculateValue(KEY_TYPE key_value, unsigned int* prev) const
+    {
+        if (_size > 0)
+        {
+            // checking if previous index is still valid first
+            // change between two subsequent queries is typically small
+            if (*prev < _last && DoesIndexMatchKey(*prev, key_value))
+            {
+                return CalculateInterpolatedValue(*prev, key_value);
+            }
+
+            if (key_value <= _key_values[0])
+            {
+                *prev = 0;
+                return _records[0].value;
+            }
+
+            if (key_value >= _key_values[_last])
+            {
+                *prev = _last;
+                return _records[_last].value;
+            }
+
+            *prev = FindIndex(key_value, *prev);
+            return CalculateInterpolatedValue(*prev, key_value);
+        }
+
+        return VAL_TYPE{ std::numeric_limits<double>::quiet_NaN() };
+    }
+
+    /**
+     * \brief Calculates table value for the given key searching forward.
+     * Keys of subsequent calls have to be non-decreasing, then the interval
+     * index only moves forward and the whole table is swept once.
+     * \param key_value key value
+     * \param index interval index, updated on return
+     * \return interpolated value on success or NaN on failure
+     */
+    VAL_TYPE CalculateValueForward(KEY_TYPE key_value, unsigned int* index) const
+    {
+        if (_size > 0)
+        {
+            if (key_value <= _key_values[0])
+            {
+                return _records[0].value;
+            }
+
+            if (key_value >= _key_values[_last])
+            {
+                return _records[_last].value;
+            }
+
+            // NaN fails comparison
+            while (*index + 1 < _last && !(key_value < _key_values[*index + 1])) ++(*index);
+
+            return CalculateInterpolatedValue(*index, key_value);
+        }
+
+        return VAL_TYPE{ std::numeric_limits<double>::quiet_NaN() };
+    }
+
+    bool DoesIndexMatchKey(unsigned int index, KEY_TYPE key_value) const
+    {
+        return key_value >= _key_values[index] && key_value < _key_values[index+1];
+    }
+
+    /**
+     * \brief Finds index of the interval containing the given key.
+     * Key value has to be within table range, i.e. greater than the first key
+     * and less than the last key.
+     * \param key_value key value
+     * \param hint index of the interval where searching starts
+     * \return index of the interval beginning
+     */
+    unsigned int FindIndex(KEY_TYPE key_value, unsigned int hint) const
+    {
+        if (_uniform)
+        {
+            return FindIndexUniform(key_value);
+        }
+
+        return FindTableInterval(_key_values, _size, key_value, hint);
+    }
+
+    VAL_TYPE CalculateInterpolatedValue(unsigned int index, KEY_TYPE key_value) const
+    {
+        const Record& record = _records[index];
+
+        // computed in double precision regardless of the storage precision
+        const double dx = static_cast<double>(key_value - _key_values[index]);
+
+        double slope = record.slope;
+
+        if (_cubic_data)
+        {
+            // Horner scheme
+            const CubicData& cubic = _cubic_data[index];
+            slope += dx * (static_cast<double>(cubic.c2) + dx * static_cast<double>(cubic.c3));
+        }
+
+        return static_cast<VAL_TYPE>(static_cast<double>(record.value) + dx * slope);
+    }
+
+    /**
+     * \brief Finds index of the interval containing the given key.
+     * Index is computed directly from the key value, so it can be used only
+     * for equally spaced keys. Key value has to be within table range.
+     * \param key_value key value
+     * \return index of the interval beginning
+     */
+    unsigned int FindIndexUniform(KEY_TYPE key_value) const
+    {
+        double pos = static_cast<double>(key_value - _key_values[0]) * _step_inv;
+
+        // NaN fails comparison
+        unsigned int index = (pos < static_cast<double>(_last))
+                           ? static_cast<unsigned int>(pos) : _last - 1;
+
+        // correction due to rounding errors
+        if (index > 0 && key_value < _key_values[index])
+        {
+            --index;
+        }
+        else if (index + 1 < _last && key_value >= _key_values[index + 1])
+        {
+            ++index;
+        }
+
+        return index;
+    }
+
+    /**
+     * \brief Calculates interpolation data (gradient).
+     * \param key_0 current key
+     * \param value_0 current value
+     * \param key_1 next key
+     * \param value_1 next value
+     * \return
+     */
+    double CalculateInterpolationData(KEY_TYPE key_0, VAL_TYPE value_0,
+                                      KEY_TYPE key_1, VAL_TYPE value_1) const
+    {
+        return static_cast<double>(value_1 - value_0) / static_cast<double>(key_1 - key_0);
+    }
+
+    /** Creates data tables. */
+    void CreateArrays()
+    {
+        _storage = std::make_shared<Storage>();
+
+        _storage->key_values = new KEY_TYPE [_size];
+        _storage->records    = new Record [_size];
+
+        if (_interpolation != TableInterpolation::Linear)
+        {
+            _storage->cubic_data = new CubicData [_size];
+        }
+
+        _key_values = _storage->key_values;
+        _records    = _storage->records;
+        _cubic_data = _storage->cubic_data;
+    }
+
+    /**
+     * \brief Deletes data tables and creates new ones of the given size.
+     * \param size number of table elements
+     */
+    void ResetArrays(unsigned int size)
+    {
+        DeleteArrays();
+
+        _size = size;
+        _last = _size > 0 ? _size - 1 : 0;
+        _prev = 0;
+
+        _uniform  = false;
+        _step_inv = 0.0;
+
+        if (_size > 0)
+        {
+            CreateArrays();
+        }
+    }
+
+    /** Deletes data tables. */
+    void DeleteArrays()
+    {
+        _storage.reset();
+
+        _key_values = nullptr;
+        _records    = nullptr;
+        _cubic_data = nullptr;
+    }
+
+    /**
+     * \brief Makes table data storage unique (copy-on-write).
+     * Copies data shared with other tables or wrapped external data into
+     * the table own storage. Has to be called before any modification of
+     * the table data.
+     */
+    void MakeArraysUnique()
+    {
+        if (_storage && (_storage->wrapped || _storage.use_count() > 1))
+        {
+            std::shared_ptr<Storage> storage = _storage;
+
+            CreateArrays();
+
+            for (unsigned int i = 0; i < _size; ++i)
+            {
+                _key_values[i] = storage->key_values[i];
+                _records[i] = storage->records[i];
+                if (_cubic_data) _cubic_data[i] = storage->cubic_data[i];
+            }
+        }
+    }
+
+    /**
+     * \brief Reads and validates binary table header.
+     * \param data binary table data
+     * \param size binary table data size expressed in bytes
+     * \param header output header
+     * \return Result::Success on success or Result::Failure on failure
+     */
+    static Result ReadBinaryHeader(const void* data, std::size_t size,
+                                   TableBinaryHeader* header)
     {
-        DeletePtrArray(_key_values);
-        DeletePtrArray(_table_data);
-        DeletePtrArray(_inter_data);
+        static_assert(std::is_trivially_copyable<KEY_TYPE>::value, "Key type must be trivially copyable");
+        static_assert(std::is_trivially_copyable<VAL_TYPE>::value, "Value type must be trivially copyable");
+
+        if (ReadTableBinaryHeader(data, size, header) != Result::Success)
+        {
+            return Result::Failure;
+        }
+
+        const std::uint64_t count = header->count[0];
+
+        bool cubic = header->interpolation != static_cast<std::uint32_t>(TableInterpolation::Linear);
+
+        if (header->dimensions != 1
+         || header->key_size[0] != sizeof(KEY_TYPE)
+         || header->record_size != sizeof(Record)
+         || header->interpolation > static_cast<std::uint32_t>(TableInterpolation::Akima)
+         || header->length[0] != count * sizeof(KEY_TYPE)
+         || header->length[1] != count * sizeof(Record)
+         || header->length[2] != (cubic ? count * sizeof(CubicData) : 0)
+         || header->length[3] != 0)
+        {
+            return Result::Failure;
+        }
+
+        return Result::Success;
+    }
+
+    /**
+     * \brief Sets table data from binary data.
+     * \param data binary table data
+     * \param size binary table data size expressed in bytes
+     * \param wrap specifies if table should wrap the given data instead of copying it
+     * \return Result::Success on success or Result::Failure on failure
+     */
+    Result LoadBinary(const void* data, std::size_t size, bool wrap)
+    {
+        TableBinaryHeader header;
+
+        if (ReadBinaryHeader(data, size, &header) != Result::Success)
+        {
+            return Result::Failure;
+        }
+
+        const char* bytes = static_cast<const char*>(data);
+
+        if (wrap)
+        {
+            std::uintptr_t address = reinterpret_cast<std::uintptr_t>(bytes);
+            if (address % alignof(KEY_TYPE)  != 0
+             || address % alignof(Record)    != 0
+             || address % alignof(CubicData) != 0)
+            {
+                return Result::Failure;
+            }
+        }
+
+        DeleteArrays();
+
+        _size = header.count[0];
+        _last = _size > 0 ? _size - 1 : 0;
+        _prev = 0;
+
+        _uniform  = (header.flags & kTableBinaryFlagUniform) != 0;
+        _step_inv = header.step_inv;
+
+        _interpolation = static_cast<TableInterpolation>(header.interpolation);
+
+        if (_size > 0)
+        {
+            if (wrap)
+            {
+                // wrapped data is never modified, see MakeArraysUnique()
+                _storage = std::make_shared<Storage>();
+                _storage->wrapped = true;
+
+                _storage->key_values = reinterpret_cast<KEY_TYPE*>(const_cast<char*>(bytes + header.offset[0]));
+                _storage->records    = reinterpret_cast<Record*>(const_cast<char*>(bytes + header.offset[1]));
+
+                if (header.length[2] > 0)
+                {
+                    _storage->cubic_data = reinterpret_cast<CubicData*>(const_cast<char*>(bytes + header.offset[2]));
+                }
+
+                _key_values = _storage->key_values;
+                _records    = _storage->records;
+                _cubic_data = _storage->cubic_data;
+            }
+            else
+            {
+                CreateArrays();
+
+                std::memcpy(static_cast<void*>(_key_values), bytes + header.offset[0],
+                            static_cast<std::size_t>(header.length[0]));
+                std::memcpy(static_cast<void*>(_records), bytes + header.offset[1],
+                            static_cast<std::size_t>(header.length[1]));
+
+                if (_cubic_data)
+                {
+                    std::memcpy(static_cast<void*>(_cubic_data), bytes + header.offset[2],
+                                static_cast<std::size_t>(header.length[2]));
+                }
+            }
+        }
+
+        return Result::Success;
     }
 
     /** \brief Updates interpolation data due to table data. */
     void UpdateInterpolationData()
     {
+        if (_storage)
+        {
+            _storage->ResetRangeIndex();
+        }
+
         for (unsigned int i = 0; i < _size; ++i)
         {
             if (i < _last)
             {
-                _inter_data[i] = CalculateInterpolationData(_key_values[i],
-                                                            _table_data[i],
-                                                            _key_values[i+1],
-                                                            _table_data[i+1]);
+                _records[i].slope = CalculateInterpolationData(_key_values[i],
+                                                               _records[i].value,
+                                                               _key_values[i+1],
+                                                               _records[i+1].value);
             }
             else
             {
-                _inter_data[i] = 0.0;
+                _records[i].slope = 0.0;
+            }
+        }
+
+        if (_cubic_data)
+        {
+            UpdateCubicData();
+        }
+
+        UpdateUniformData();
+    }
+
+    /**
+     * \brief Updates cubic interpolation data due to table data.
+     * Record slopes have to be up to date. On return record slopes are
+     * replaced with tangents at the interval beginnings.
+     *
+     * ### Refernces:
+     * - Fritsch F., Carlson R.: Monotone Piecewise Cubic Interpolation, 1980
+     * - Akima H.: A New Method of Interpolation and Smooth Curve Fitting Based on Local Procedures, 1970
+     * - [Monotone cubic interpolation - Wikipedia](https://en.wikipedia.org/wiki/Monotone_cubic_interpolation)
+     * - [Akima spline - Wikipedia](https://en.wikipedia.org/wiki/Akima_spline)
+     */
+    void UpdateCubicData()
+    {
+        std::vector<double> delta(_size, 0.0);      // secant slopes
+        std::vector<double> tangent(_size, 0.0);    // tangents at points
+
+        for (unsigned int i = 0; i < _last; ++i)
+        {
+            delta[i] = _records[i].slope;
+        }
+
+        if (_size < 3)
+        {
+            // single interval, cubic reduces to linear
+            tangent[0] = delta[0];
+            if (_size > 1) tangent[1] = delta[0];
+        }
+        else if (_interpolation == TableInterpolation::MonotoneCubic)
+        {
+            tangent[0]     = delta[0];
+            tangent[_last] = delta[_last - 1];
+
+            for (unsigned int i = 1; i < _last; ++i)
+            {
+                tangent[i] = (delta[i - 1] * delta[i] > 0.0)
+                           ? 0.5 * (delta[i - 1] + delta[i]) : 0.0;
+            }
+
+            for (unsigned int i = 0; i < _last; ++i)
+            {
+                if (delta[i] == 0.0)
+                {
+                    tangent[i]     = 0.0;
+                    tangent[i + 1] = 0.0;
+                }
+                else
+                {
+                    double alpha = tangent[i]     / delta[i];
+                    double beta  = tangent[i + 1] / delta[i];
+                    double r2 = alpha * alpha + beta * beta;
+
+                    if (r2 > 9.0)
+                    {
+                        double tau = 3.0 / sqrt(r2);
+                        tangent[i]     = tau * alpha * delta[i];
+                        tangent[i + 1] = tau * beta  * delta[i];
+                    }
+                }
+            }
+        }
+        else
+        {
+            // secant slopes extended by 2 at both ends
+            // d[k] stands for delta[k - 2]
+            std::vector<double> d(_last + 4, 0.0);
+
+            for (unsigned int i = 0; i < _last; ++i)
+            {
+                d[i + 2] = delta[i];
+            }
+
+            d[1] = 2.0 * d[2] - d[3];
+            d[0] = 2.0 * d[1] - d[2];
+            d[_last + 2] = 2.0 * d[_last + 1] - d[_last];
+            d[_last + 3] = 2.0 * d[_last + 2] - d[_last + 1];
+
+            for (unsigned int i = 0; i < _size; ++i)
+            {
+                double w_1 = fabs(d[i + 3] - d[i + 2]);
+                double w_2 = fabs(d[i + 1] - d[i]);
+
+                if (w_1 + w_2 > 0.0)
+                {
+                    tangent[i] = (w_1 * d[i + 1] + w_2 * d[i + 2]) / (w_1 + w_2);
+                }
+                else
+                {
+                    tangent[i] = 0.5 * (d[i + 1] + d[i + 2]);
+                }
+            }
+        }
+
+        for (unsigned int i = 0; i < _last; ++i)
+        {
+            double h = static_cast<double>(_key_values[i + 1] - _key_values[i]);
+
+            _records[i].slope = tangent[i];
+            _cubic_data[i].c2 = (3.0 * delta[i] - 2.0 * tangent[i] - tangent[i + 1]) / h;
+            _cubic_data[i].c3 = (tangent[i] + tangent[i + 1] - 2.0 * delta[i]) / (h * h);
+        }
+
+        _cubic_data[_last] = CubicData();
+    }
+
+    /** \brief Checks if keys are equally spaced and updates step data. */
+    void UpdateUniformData()
+    {
+        _uniform  = false;
+        _step_inv = 0.0;
+
+        if (_size > 2)
+        {
+            const double step = static_cast<double>(_key_values[_last] - _key_values[0]) / _last;
+            const double tol  = 1.0e-9 * fabs(step);
+
+            bool uniform = step > 0.0;
+
+            for (unsigned int i = 0; i < _last && uniform; ++i)
+            {
+                double delta = static_cast<double>(_key_values[i + 1] - _key_values[i]);
+                uniform = fabs(delta - step) <= tol;
+            }
+
+            if (uniform)
+            {
+                _uniform  = true;
+                _step_inv = 1.0 / step;
             }
         }
     }
@@ -648,6 +1711,22 @@ inline Table<KEY_TYPE,VAL_TYPE> operator*(double val, const Table<KEY_TYPE,VAL_T
     return table * val;
 }
 
+/**
+ * \brief Converts table from text format to binary format.
+ * \param str table in text format (see Table::SetFromString())
+ * \param interpolation interpolation method
+ * \return binary table data (see Table::ToBinary())
+ */
+template <typename KEY_TYPE, typename VAL_TYPE>
+std::vector<char> ConvertTableToBinary(const char* str,
+                                       TableInterpolation interpolation = TableInterpolation::Linear)
+{
+    Table<KEY_TYPE,VAL_TYPE> table;
+    table.SetFromString(str);
+    table.SetInterpolation(interpolation);
+    return table.ToBinary();
+}
+
 } // namespace mc
 
 #endif // MCUTILS_MATH_TABLE_H_
@@ -23,13 +23,21 @@
 #define MCUTILS_MATH_TABLE2_H_
 
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <limits>
+#include <memory>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include <mcutils/Result.h>
+
 #include <mcutils/math/Table.h>
+#include <mcutils/math/TableBinary.h>
 
 #include <mcutils/misc/Check.h>
 #include <mcutils/misc/PtrUtils.h>
@@ -37,34 +45,61 @@
 
 namespace mc {
 
+/**
+ * \brief 2D table lookup cursor.
+ * Caller owned search hint used by Table2 lookups. Each thread should use its
+ * own cursor, so one immutable table may be shared between threads.
+ */
+struct Table2Cursor
+{
+    unsigned int row = 0;       ///< recently found row interval index
+    unsigned int col = 0;       ///< recently found column interval index
+};
+
+template <typename ROW_TYPE, typename COL_TYPE, typename VAL_TYPE> class Table2Slice;
+
+/**
+ * \brief 2D table slice cache.
+ * Caller owned cache of the recently materialized 1-dimensional table, see
+ * Table2::GetTable(COL_TYPE,Table2SliceCache*). Cache shares the 2D table
+ * data storage, so modifying the 2D table copies its data (see
+ * Table2::MakeArraysUnique()) and invalidates the cached table.
+ */
+template <typename ROW_TYPE, typename COL_TYPE, typename VAL_TYPE>
+struct Table2SliceCache
+{
+    Table<ROW_TYPE,VAL_TYPE> table;         ///< cached 1-dimensional table
+    COL_TYPE col_value = COL_TYPE{0};       ///< column key value of the cached table
+    std::shared_ptr<const void> storage;    ///< 2D table data storage the cached table was created from
+};
+
 /**
  * \brief 2D table and bilinear interpolation class.
  */
 template <typename ROW_TYPE, typename COL_TYPE, typename VAL_TYPE>
 class Table2
 {
+    friend class Table2Slice<ROW_TYPE,COL_TYPE,VAL_TYPE>;
+
 public:
 
-    /** \brief Copy constructor. */
+    /**
+     * \brief Copy constructor.
+     * Table data is not copied but shared, see MakeArraysUnique().
+     */
     Table2(const Table2<ROW_TYPE,COL_TYPE,VAL_TYPE>& table)
         : _rows(table._rows)
         , _cols(table._cols)
         , _size(table._size)
-    {
-        if (_size > 0)
-        {
-            CreateArrays();
 
-            for (unsigned int i = 0; i < _rows; ++i) _row_values[i] = table._row_values[i];
-            for (unsigned int i = 0; i < _cols; ++i) _col_values[i] = table._col_values[i];
+        , _row_values(table._row_values)
+        , _col_values(table._col_values)
+        , _table_data(table._table_data)
 
-            for (unsigned int i = 0; i < _size; ++i)
-            {
-                _table_data[i] = table._table_data[i];
-                _inter_data[i] = table._inter_data[i];
-            }
-        }
-    }
+        , _inter_data(table._inter_data)
+
+        , _storage(table._storage)
+    {}
 
     /** \brief Move constructor. */
     Table2(Table2<ROW_TYPE,COL_TYPE,VAL_TYPE>&& table) noexcept
@@ -77,6 +112,8 @@ public:
         , _table_data(std::exchange(table._table_data, nullptr))
 
         , _inter_data(std::exchange(table._inter_data, nullptr))
+
+        , _storage(std::move(table._storage))
     {}
 
     /**
@@ -99,7 +136,6 @@ public:
         _row_values[0] = row_val;
         _col_values[0] = col_val;
         _table_data[0] = val;
-        _inter_data[0] = 0.0;
 
         UpdateInterpolationData();
     }
@@ -127,88 +163,121 @@ public:
 
     /**
      * \brief Returns 1-dimensional table for the given col value.
-     * \param colValue column key value
+     * \param col_value column key value
      * \return 1-dimensional table
      */
     Table<ROW_TYPE,VAL_TYPE> GetTable(COL_TYPE col_value) const
     {
-        std::vector<ROW_TYPE> keyValues;
-        std::vector<VAL_TYPE> tableData;
+        return GetSlice(col_value).ToTable();
+    }
 
-        for (unsigned int i = 0; i < _rows; ++i)
+    /**
+     * \brief Returns 1-dimensional table for the given col value.
+     * Table is created only if the column key value or the table data differ
+     * from the ones the cached table was created from.
+     * \param col_value column key value
+     * \param cache caller owned slice cache
+     * \return reference to the 1-dimensional table stored in the cache
+     */
+    const Table<ROW_TYPE,VAL_TYPE>& GetTable(COL_TYPE col_value,
+                                             Table2SliceCache<ROW_TYPE,COL_TYPE,VAL_TYPE>* cache) const
+    {
+        if (!_storage || cache->storage != _storage || cache->col_value != col_value)
         {
-            keyValues.push_back(_row_values[i]);
-            tableData.push_back(GetValue(_row_values[i], col_value));
+            cache->table     = GetSlice(col_value).ToTable();
+            cache->col_value = col_value;
+            cache->storage   = _storage;
         }
 
-        return Table<ROW_TYPE,VAL_TYPE>(keyValues, tableData);
+        return cache->table;
+    }
+
+    /**
+     * \brief Returns slice view of the table for the given col value.
+     * Slice neither copies table data nor allocates memory, see Table2Slice.
+     * \param col_value column key value
+     * \return slice view
+     */
+    Table2Slice<ROW_TYPE,COL_TYPE,VAL_TYPE> GetSlice(COL_TYPE col_value) const
+    {
+        return Table2Slice<ROW_TYPE,COL_TYPE,VAL_TYPE>(*this, col_value);
     }
 
     /**
      * \brief Returns table value for the given keys.
      * Returns table value for the given keys values using bilinear
-     * interpolation algorithm.
-     * \param rowValue row key value
-     * \param colValue column key value
+     * interpolation algorithm. Recently found cell is stored inside the table
+     * object to speed up subsequent queries, therefore this function should
+     * not be called on a table shared between threads. Use
+     * GetValue(ROW_TYPE,COL_TYPE,Table2Cursor*) or GetValueStateless()
+     * instead.
+     * \param row_value row key value
+     * \param col_value column key value
      * \return interpolated value on success or NaN on failure
      */
     VAL_TYPE GetValue(ROW_TYPE row_value, COL_TYPE col_value) const
     {
-        if (_size > 0)
-        {
-            if (row_value < _row_values[0])
-                return GetValue(_row_values[0], col_value);
-
-            if (col_value < _col_values[0])
-                return GetValue(row_value, _col_values[0]);
-
-            if (row_value > _row_values[_rows - 1])
-                return GetValue(_row_values[_rows - 1], col_value);
-
-            if (col_value > _col_values[_cols - 1])
-                return GetValue(row_value, _col_values[_cols - 1]);
-
-            unsigned int row_1 = 0;
-            unsigned int row_2 = 0;
-
-            for (unsigned int r = 1; r < _rows; ++r)
-            {
-                row_1 = r - 1;
-                row_2 = r;
-
-                if (row_value >= _row_values[row_1] && row_value < _row_values[row_2]) break;
-            }
-
-            unsigned int col_1 = 0;
-            unsigned int col_2 = 0;
-
-            for (unsigned int c = 1; c < _cols; ++c)
-            {
-                col_1 = c - 1;
-                col_2 = c;
+        return CalculateValue(row_value, col_value, &_prev);
+    }
 
-                if (col_value >= _col_values[col_1] && col_value < _col_values[col_2]) break;
-            }
+    /**
+     * \brief Returns table value for the given keys.
+     * Returns table value for the given keys values using bilinear
+     * interpolation algorithm. Recently found cell is stored in the given
+     * caller owned cursor, so the table itself is not modified.
+     * \param row_value row key value
+     * \param col_value column key value
+     * \param cursor lookup cursor
+     * \return interpolated value on success or NaN on failure
+     */
+    VAL_TYPE GetValue(ROW_TYPE row_value, COL_TYPE col_value, Table2Cursor* cursor) const
+    {
+        return CalculateValue(row_value, col_value, cursor);
+    }
 
-            VAL_TYPE result_1 = static_cast<double>(col_value - _col_values[col_1])
-                            * _inter_data[row_1 * _cols + col_1]
-                            + _table_data[row_1 * _cols + col_1];
+    /**
+     * \brief Returns table value for the given keys.
+     * Returns table value for the given keys values using bilinear
+     * interpolation algorithm. Neither the table nor any other state is
+     * modified.
+     * \param row_value row key value
+     * \param col_value column key value
+     * \return interpolated value on success or NaN on failure
+     */
+    VAL_TYPE GetValueStateless(ROW_TYPE row_value, COL_TYPE col_value) const
+    {
+        Table2Cursor cursor;
+        return CalculateValue(row_value, col_value, &cursor);
+    }
 
-            VAL_TYPE result_2 = static_cast<double>(col_value - _col_values[col_1])
-                            * _inter_data[row_2 * _cols + col_1]
-                            + _table_data[row_2 * _cols + col_1];
+    /**
+     * \brief Returns row key for the given row index.
+     * \param row_index row index
+     * \return row key value on success or NaN on failure
+     */
+    ROW_TYPE GetRowKeyByIndex(unsigned int row_index) const
+    {
+        if (row_index < _rows)
+        {
+            return _row_values[row_index];
+        }
 
-            double rowFactor = 0.0;
-            double rowDelta  = static_cast<double>(_row_values[row_2] - _row_values[row_1]);
-            if (fabs(rowDelta) > 1.0e-16)
-            {
-                rowFactor = (row_value - _row_values[row_1]) / rowDelta;
-            }
+        return ROW_TYPE{ std::numeric_limits<double>::quiet_NaN() };
+    }
 
-            return rowFactor * (result_2 - result_1) + result_1;
+    /**
+     * \brief Returns column key for the given column index.
+     * \param col_index column index
+     * \return column key value on success or NaN on failure
+     */
+    COL_TYPE GetColKeyByIndex(unsigned int col_index) const
+    {
+        if (col_index < _cols)
+        {
+            return _col_values[col_index];
         }
 
-        return VAL_TYPE{ std::numeric_limits<double>::quiet_NaN() };
+        return COL_TYPE{ std::numeric_limits<double>::quiet_NaN() };
     }
 
     /**
@@ -261,7 +330,9 @@ public:
             for (unsigned int i = 0; i < _size && result; ++i)
             {
                 result &= mc::IsValid(_table_data[i]);
-                result &= mc::IsValid(_inter_data[i]);
+                result &= mc::IsValid(_inter_data[i].row_slope);
+                result &= mc::IsValid(_inter_data[i].col_slope);
+                result &= mc::IsValid(_inter_data[i].twist);
             }
         }
 
@@ -274,6 +345,8 @@ public:
      */
     void MultiplyRows(double factor)
     {
+        MakeArraysUnique();
+
         for (unsigned int i = 0; i < _rows; ++i)
         {
             _row_values[i] *= factor;
@@ -288,6 +361,8 @@ public:
      */
     void MultiplyCols(double factor)
     {
+        MakeArraysUnique();
+
         for (unsigned int i = 0; i < _cols; ++i)
         {
             _col_values[i] *= factor;
@@ -302,6 +377,8 @@ public:
      */
     void MultiplyValues(double factor)
     {
+        MakeArraysUnique();
+
         for (unsigned int i = 0; i < _size; ++i)
         {
             _table_data[i] *= factor;
@@ -322,31 +399,28 @@ public:
                  const std::vector<COL_TYPE>& col_values,
                  const std::vector<VAL_TYPE>& table_data)
     {
-        DeleteArrays();
-
         if (row_values.size() * col_values.size() == table_data.size())
         {
-            _size = static_cast< unsigned int >( table_data.size() );
+            ResetArrays(static_cast<unsigned int>(row_values.size()),
+                        static_cast<unsigned int>(col_values.size()));
 
             if (_size > 0)
             {
-                _rows = static_cast<unsigned int>(row_values.size());
-                _cols = static_cast<unsigned int>(col_values.size());
-
-                CreateArrays();
-
                 for (unsigned int i = 0; i < _rows; ++i) _row_values[i] = row_values[i];
                 for (unsigned int i = 0; i < _cols; ++i) _col_values[i] = col_values[i];
 
                 for (unsigned int i = 0; i < _size; ++i)
                 {
                     _table_data[i] = table_data[i];
-                    _inter_data[i] = 0.0;
                 }
 
                 UpdateInterpolationData();
             }
         }
+        else
+        {
+            ResetArrays(0, 0);
+        }
     }
 
     /**
@@ -356,55 +430,51 @@ public:
      */
     void SetFromString(const char* str)
     {
-        std::vector<ROW_TYPE> row_values_tmp;
-        std::vector<COL_TYPE> col_values_tmp;
-        std::vector<VAL_TYPE> table_data_tmp;
+        std::string_view sv = String::SkipSpaces(str);
+
+        // first line contains columns keys
+        std::string_view::size_type eol = sv.find('\n');
+        unsigned int cols  = String::CountTokens(sv.substr(0, eol));
+        unsigned int count = String::CountTokens(sv);
 
-        std::stringstream ss(String::StripSpaces(str));
-        std::stringstream sl(String::GetFirstLine(ss.str()));
+        bool valid = cols > 0 && (count - cols) % (cols + 1) == 0;
 
-        bool valid = true;
+        // parsing straight into table arrays
+        ResetArrays(valid ? (count - cols) / (cols + 1) : 0, cols);
 
-        // cols keys
-        while (!sl.eof() && valid)
+        for (unsigned int c = 0; c < cols && valid; ++c)
         {
             double key = std::numeric_limits<double>::quiet_NaN();
-            sl >> key; // sic!
-            ss >> key; // sic!
-            valid &= mc::IsValid(key);
-            col_values_tmp.push_back(COL_TYPE{key});
+            valid &= String::ParseNumber(&sv, &key) && mc::IsValid(key);
+            if (_size > 0) _col_values[c] = COL_TYPE{key};
         }
 
-        // table rows
-        while (!ss.eof() && valid)
+        for (unsigned int r = 0; r < _rows && valid; ++r)
         {
             double key = std::numeric_limits<double>::quiet_NaN();
-            ss >> key;
-            valid &= mc::IsValid(key);
-            row_values_tmp.push_back(ROW_TYPE{key});
+            valid &= String::ParseNumber(&sv, &key) && mc::IsValid(key);
+            _row_values[r] = ROW_TYPE{key};
 
-            // table data
-            for (unsigned int i = 0; i < col_values_tmp.size(); i++)
+            for (unsigned int c = 0; c < _cols && valid; ++c)
             {
                 double val = std::numeric_limits<double>::quiet_NaN();
-                ss >> val;
-                valid &= mc::IsValid(val);
-                table_data_tmp.push_back(VAL_TYPE{val});
+                valid &= String::ParseNumber(&sv, &val) && mc::IsValid(val);
+                _table_data[r * _cols + c] = VAL_TYPE{val};
             }
         }
 
-        std::vector<ROW_TYPE> row_values { ROW_TYPE{std::numeric_limits<double>::quiet_NaN()} };
-        std::vector<COL_TYPE> col_values { COL_TYPE{std::numeric_limits<double>::quiet_NaN()} };
-        std::vector<VAL_TYPE> table_data { VAL_TYPE{std::numeric_limits<double>::quiet_NaN()} };
+        valid &= String::SkipSpaces(sv).empty();
 
-        if (valid)
+        if (!valid)
         {
-            row_values = row_values_tmp;
-            col_values = col_values_tmp;
-            table_data = table_data_tmp;
+            ResetArrays(1, 1);
+
+            _row_values[0] = ROW_TYPE{std::numeric_limits<double>::quiet_NaN()};
+            _col_values[0] = COL_TYPE{std::numeric_limits<double>::quiet_NaN()};
+            _table_data[0] = VAL_TYPE{std::numeric_limits<double>::quiet_NaN()};
         }
 
-        SetData(row_values, col_values, table_data);
+        UpdateInterpolationData();
     }
 
     /**
@@ -437,33 +507,92 @@ public:
         return ss.str();
     }
 
+    /**
+     * \brief Returns binary representation of the table.
+     * Binary representation contains table data together with precomputed
+     * interpolation data, see TableBinaryHeader for format description.
+     * \return binary table data
+     */
+    std::vector<char> ToBinary() const
+    {
+        const std::uint64_t lengths[] = {
+            _rows * sizeof(ROW_TYPE),
+            _cols * sizeof(COL_TYPE),
+            _size * sizeof(VAL_TYPE),
+            _size * sizeof(Cell)
+        };
+
+        const void* sections[] = { _row_values, _col_values, _table_data, _inter_data };
+
+        TableBinaryHeader header;
+        InitTableBinaryHeader(&header, lengths, 4);
+
+        header.dimensions  = 2;
+        header.key_size[0] = sizeof(ROW_TYPE);
+        header.key_size[1] = sizeof(COL_TYPE);
+        header.record_size = sizeof(VAL_TYPE);
+        header.count[0]    = _size > 0 ? _rows : 0;
+        header.count[1]    = _size > 0 ? _cols : 0;
+
+        return WriteTableBinary(header, sections);
+    }
+
+    /**
+     * \brief Sets table data from binary data.
+     * Table data is copied with a single memcpy per data section, no
+     * interpolation data is recalculated.
+     * \param data binary table data (see ToBinary())
+     * \param size binary table data size expressed in bytes
+     * \return Result::Success on success or Result::Failure on failure
+     */
+    Result SetFromBinary(const void* data, std::size_t size)
+    {
+        return LoadBinary(data, size, false);
+    }
+
+    /**
+     * \brief Wraps binary data without copying it.
+     * Table refers to the given data (e.g. memory mapped file region), which
+     * must remain valid and unchanged as long as the table uses it. Data has
+     * to be aligned to the kTableBinaryAlignment. Table makes its own copy
+     * of the data before any modification.
+     * \param data binary table data (see ToBinary())
+     * \param size binary table data size expressed in bytes
+     * \return Result::Success on success or Result::Failure on failure
+     */
+    Result WrapBinary(const void* data, std::size_t size)
+    {
+        return LoadBinary(data, size, true);
+    }
+
+    /** \return true if table wraps external data */
+    inline bool IsWrapped() const { return _storage && _storage->wrapped; }
+
+    /** \return true if table data is shared with other tables */
+    inline bool IsShared() const { return _storage && _storage.use_count() > 1; }
+
     inline unsigned int rows() const { return _rows; }
     inline unsigned int cols() const { return _cols; }
 
-    /** \brief Assignment operator. */
+    /**
+     * \brief Assignment operator.
+     * Table data is not copied but shared, see MakeArraysUnique().
+     */
     Table2<ROW_TYPE,COL_TYPE,VAL_TYPE>& operator=(const Table2<ROW_TYPE,COL_TYPE,VAL_TYPE>& table)
     {
         if (this != &table)
         {
-            DeleteArrays();
-
             _rows = table._rows;
             _cols = table._cols;
             _size = table._size;
 
-            if (_size > 0)
-            {
-                CreateArrays();
+            _row_values = table._row_values;
+            _col_values = table._col_values;
+            _table_data = table._table_data;
 
-                for (unsigned int i = 0; i < _rows; ++i) _row_values[i] = table._row_values[i];
-                for (unsigned int i = 0; i < _cols; ++i) _col_values[i] = table._col_values[i];
+            _inter_data = table._inter_data;
 
-                for (unsigned int i = 0; i < _size; ++i)
-                {
-                    _table_data[i] = table._table_data[i];
-                    _inter_data[i] = table._inter_data[i];
-                }
-            }
+            _storage = table._storage;
         }
 
         return *this;
@@ -484,36 +613,275 @@ public:
 
         _inter_data = std::exchange(table._inter_data, nullptr);
 
+        _storage = std::move(table._storage);
+
         return *this;
     }
 
 private:
 
+    using Scalar = typename TableScalar<VAL_TYPE>::type;   ///< interpolation data type, see TableScalar
+
+    /** \brief Table cell bilinear interpolation data. */
+    struct CellData
+    {
+        VAL_TYPE value;             ///< value at the cell origin
+        Scalar row_slope;           ///< value derivative with respect to row key
+        Scalar col_slope;           ///< value derivative with respect to column key
+        Scalar twist;               ///< value mixed derivative
+    };
+
+    /**
+     * \brief Table cell.
+     * Cell holds coefficients of the bilinear interpolation polynomial
+     * z = value + row_slope*dr + col_slope*dc + twist*dr*dc, where dr and dc
+     * are distances from the cell origin, so a lookup needs only one cell.
+     * Cell is aligned to the power of 2 not less than its size, so it never
+     * crosses cache line boundary.
+     */
+    struct alignas(sizeof(CellData) <= 16 ? 16 :
+                   sizeof(CellData) <= 32 ? 32 : 64) Cell : CellData {};
+
+    /**
+     * \brief Table data storage.
+     * Storage is shared between copies of the table and is never modified
+     * while shared, see MakeArraysUnique().
+     */
+    struct Storage
+    {
+        ROW_TYPE* row_values = nullptr;   ///< rows keys values
+        COL_TYPE* col_values = nullptr;   ///< columns keys values
+        VAL_TYPE* table_data = nullptr;   ///< table data
+        Cell*     inter_data = nullptr;   ///< interpolation data matrix
+
+        bool wrapped = false;             ///< specifies if arrays point to wrapped external memory
+
+        Storage() = default;
+        Storage(const Storage&) = delete;
+        Storage& operator=(const Storage&) = delete;
+
+        ~Storage()
+        {
+            if (!wrapped)
+            {
+                DeletePtrArray(row_values);
+                DeletePtrArray(col_values);
+                DeletePtrArray(table_data);
+                DeletePtrArray(inter_data);
+            }
+        }
+    };
+
     unsigned int _rows = 0;               ///< number of rows
     unsigned int _cols = 0;               ///< number of columns
     unsigned int _size = 0;               ///< number of table elements
 
-    ROW_TYPE* _row_values = nullptr;      ///< rows keys values
-    COL_TYPE* _col_values = nullptr;      ///< columns keys values
-    VAL_TYPE* _table_data = nullptr;      ///< table data
-    double* _inter_data = nullptr;        ///< interpolation data matrix
+    ROW_TYPE* _row_values = nullptr;      ///< rows keys values (storage array)
+    COL_TYPE* _col_values = nullptr;      ///< columns keys values (storage array)
+    VAL_TYPE* _table_data = nullptr;      ///< table data (storage array)
+    Cell* _inter_data = nullptr;          ///< interpolation data matrix (storage array)
+
+    std::shared_ptr<Storage> _storage;    ///< table data storage
+
+    mutable Table2Cursor _prev;           ///< previously found cell
+
+    /**
+     * \brief Calculates table value for the given keys.
+     * Keys out of the table range are clamped to the table range.
+     * \param row_value row key value
+     * \param col_value column key value
+     * \param prev previously found cell, updated on return
+     * \return interpolated value on success or NaN on failure
+     */
+    VAL_TYPE CalculateValue(ROW_TYPE row_value, COL_TYPE col_value, Table2Cursor* prev) const
+    {
+        if (_size > 0)
+        {
+            if      (row_value < _row_values[0])         row_value = _row_values[0];
+            else if (row_value > _row_values[_rows - 1]) row_value = _row_values[_rows - 1];
+
+            if      (col_value < _col_values[0])         col_value = _col_values[0];
+            else if (col_value > _col_values[_cols - 1]) col_value = _col_values[_cols - 1];
+
+            prev->row = FindTableInterval(_row_values, _rows, row_value, prev->row);
+            prev->col = FindTableInterval(_col_values, _cols, col_value, prev->col);
+
+            const Cell& cell = _inter_data[prev->row * _cols + prev->col];
+
+            const double dr = static_cast<double>(row_value - _row_values[prev->row]);
+            const double dc = static_cast<double>(col_value - _col_values[prev->col]);
+
+            return static_cast<VAL_TYPE>(static_cast<double>(cell.value)
+                                       + dr * (cell.row_slope + dc * cell.twist) + dc * cell.col_slope);
+        }
+
+        return VAL_TYPE{ std::numeric_limits<double>::quiet_NaN() };
+    }
 
     /** Creates data tables. */
     void CreateArrays()
     {
-        _row_values = new ROW_TYPE [_rows];
-        _col_values = new COL_TYPE [_cols];
-        _table_data = new VAL_TYPE [_size];
-        _inter_data = new double [_size];
+        _storage = std::make_shared<Storage>();
+
+        _storage->row_values = new ROW_TYPE [_rows];
+        _storage->col_values = new COL_TYPE [_cols];
+        _storage->table_data = new VAL_TYPE [_size];
+        _storage->inter_data = new Cell [_size];
+
+        UpdateArraysPointers();
+    }
+
+    /** Updates table arrays pointers due to storage. */
+    void UpdateArraysPointers()
+    {
+        _row_values = _storage->row_values;
+        _col_values = _storage->col_values;
+        _table_data = _storage->table_data;
+        _inter_data = _storage->inter_data;
+    }
+
+    /**
+     * \brief Deletes data tables and creates new ones of the given size.
+     * \param rows number of rows
+     * \param cols number of columns
+     */
+    void ResetArrays(unsigned int rows, unsigned int cols)
+    {
+        DeleteArrays();
+
+        _size = rows * cols;
+        _rows = _size > 0 ? rows : 0;
+        _cols = _size > 0 ? cols : 0;
+
+        if (_size > 0)
+        {
+            CreateArrays();
+        }
     }
 
     /** Deletes data tables. */
     void DeleteArrays()
     {
-        DeletePtrArray(_row_values);
-        DeletePtrArray(_col_values);
-        DeletePtrArray(_table_data);
-        DeletePtrArray(_inter_data);
+        _storage.reset();
+
+        _row_values = nullptr;
+        _col_values = nullptr;
+        _table_data = nullptr;
+        _inter_data = nullptr;
+    }
+
+    /**
+     * \brief Makes table data storage unique (copy-on-write).
+     * Copies data shared with other tables or wrapped external data into
+     * the table own storage. Has to be called before any modification of
+     * the table data.
+     */
+    void MakeArraysUnique()
+    {
+        if (_storage && (_storage->wrapped || _storage.use_count() > 1))
+        {
+            std::shared_ptr<Storage> storage = _storage;
+
+            CreateArrays();
+
+            for (unsigned int i = 0; i < _rows; ++i) _row_values[i] = storage->row_values[i];
+            for (unsigned int i = 0; i < _cols; ++i) _col_values[i] = storage->col_values[i];
+
+            for (unsigned int i = 0; i < _size; ++i)
+            {
+                _table_data[i] = storage->table_data[i];
+                _inter_data[i] = storage->inter_data[i];
+            }
+        }
+    }
+
+    /**
+     * \brief Loads table data from binary data.
+     * \param data binary table data
+     * \param size binary table data size expressed in bytes
+     * \param wrap specifies if table should wrap the given data instead of copying it
+     * \return Result::Success on success or Result::Failure on failure
+     */
+    Result LoadBinary(const void* data, std::size_t size, bool wrap)
+    {
+        static_assert(std::is_trivially_copyable<ROW_TYPE>::value, "Row type must be trivially copyable");
+        static_assert(std::is_trivially_copyable<COL_TYPE>::value, "Column type must be trivially copyable");
+        static_assert(std::is_trivially_copyable<VAL_TYPE>::value, "Value type must be trivially copyable");
+
+        TableBinaryHeader header;
+
+        if (ReadTableBinaryHeader(data, size, &header) != Result::Success)
+        {
+            return Result::Failure;
+        }
+
+        const std::uint64_t rows = header.count[0];
+        const std::uint64_t cols = header.count[1];
+
+        if (header.dimensions != 2
+         || header.key_size[0] != sizeof(ROW_TYPE)
+         || header.key_size[1] != sizeof(COL_TYPE)
+         || header.record_size != sizeof(VAL_TYPE)
+         || header.length[0] != rows * sizeof(ROW_TYPE)
+         || header.length[1] != cols * sizeof(COL_TYPE)
+         || header.length[2] != rows * cols * sizeof(VAL_TYPE)
+         || header.length[3] != rows * cols * sizeof(Cell)
+         || (rows == 0) != (cols == 0))
+        {
+            return Result::Failure;
+        }
+
+        const char* bytes = static_cast<const char*>(data);
+
+        if (wrap)
+        {
+            std::uintptr_t address = reinterpret_cast<std::uintptr_t>(bytes);
+            if (address % alignof(ROW_TYPE) != 0
+             || address % alignof(COL_TYPE) != 0
+             || address % alignof(VAL_TYPE) != 0
+             || address % alignof(Cell)     != 0)
+            {
+                return Result::Failure;
+            }
+        }
+
+        DeleteArrays();
+
+        _rows = static_cast<unsigned int>(rows);
+        _cols = static_cast<unsigned int>(cols);
+        _size = _rows * _cols;
+
+        if (_size > 0)
+        {
+            if (wrap)
+            {
+                // wrapped data is never modified, see MakeArraysUnique()
+                _storage = std::make_shared<Storage>();
+                _storage->wrapped = true;
+
+                _storage->row_values = reinterpret_cast<ROW_TYPE*>(const_cast<char*>(bytes + header.offset[0]));
+                _storage->col_values = reinterpret_cast<COL_TYPE*>(const_cast<char*>(bytes + header.offset[1]));
+                _storage->table_data = reinterpret_cast<VAL_TYPE*>(const_cast<char*>(bytes + header.offset[2]));
+                _storage->inter_data = reinterpret_cast<Cell*>(const_cast<char*>(bytes + header.offset[3]));
+
+                UpdateArraysPointers();
+            }
+            else
+            {
+                CreateArrays();
+
+                std::memcpy(static_cast<void*>(_row_values), bytes + header.offset[0],
+                            static_cast<std::size_t>(header.length[0]));
+                std::memcpy(static_cast<void*>(_col_values), bytes + header.offset[1],
+                            static_cast<std::size_t>(header.length[1]));
+                std::memcpy(static_cast<void*>(_table_data), bytes + header.offset[2],
+                            static_cast<std::size_t>(header.length[2]));
+                std::memcpy(static_cast<void*>(_inter_data), bytes + header.offset[3],
+                            static_cast<std::size_t>(header.length[3]));
+            }
+        }
+
+        return Result::Success;
     }
 
     /** \brief Updates interpolation data due to table data. */
@@ -521,16 +889,245 @@ private:
     {
         for (unsigned int r = 0; r < _rows; ++r)
         {
-            for (unsigned int c = 0; c < _cols - 1; ++c)
+            for (unsigned int c = 0; c < _cols; ++c)
             {
-                _inter_data[r * _cols + c] =
-                    static_cast<double>(_table_data[r * _cols + c + 1] - _table_data[r * _cols + c])
-                  / static_cast<double>(_col_values[c + 1] - _col_values[c]);
+                const unsigned int i = r * _cols + c;
+
+                Cell& cell = _inter_data[i];
+
+                cell.value     = _table_data[i];
+                cell.row_slope = 0.0;
+                cell.col_slope = 0.0;
+                cell.twist     = 0.0;
+
+                // cells of the last row and the last column are used only
+                // for the keys equal to the last keys, slopes remain 0
+                double row_delta = 0.0;
+                double col_delta = 0.0;
+
+                if (r + 1 < _rows) row_delta = static_cast<double>(_row_values[r + 1] - _row_values[r]);
+                if (c + 1 < _cols) col_delta = static_cast<double>(_col_values[c + 1] - _col_values[c]);
+
+                const bool has_row = fabs(row_delta) > 1.0e-16;
+                const bool has_col = fabs(col_delta) > 1.0e-16;
+
+                if (has_row)
+                {
+                    cell.row_slope = static_cast<double>(_table_data[i + _cols] - _table_data[i]) / row_delta;
+                }
+
+                if (has_col)
+                {
+                    cell.col_slope = static_cast<double>(_table_data[i + 1] - _table_data[i]) / col_delta;
+                }
+
+                if (has_row && has_col)
+                {
+                    cell.twist = static_cast<double>(_table_data[i + _cols + 1] - _table_data[i + _cols]
+                                                   - _table_data[i + 1] + _table_data[i])
+                               / (row_delta * col_delta);
+                }
             }
         }
     }
 };
 
+/**
+ * \brief 2D table slice view class.
+ *
+ * Lightweight view of the 2D table at the given column key value. Slice
+ * references rows keys and interpolation data of the table, the value is
+ * interpolated between two neighbouring columns on demand, so creating
+ * slice requires neither copying data nor memory allocation, and lookup
+ * costs the same as the 2D table lookup. Slice values are equal to the
+ * values of the table returned by Table2::GetTable().
+ *
+ * Slice keeps the table data it refers to alive. Modifications of the table
+ * made after slice creation do not affect the slice.
+ */
+template <typename ROW_TYPE, typename COL_TYPE, typename VAL_TYPE>
+class Table2Slice
+{
+public:
+
+    /** \brief Constructor. Creates empty slice. */
+    Table2Slice() = default;
+
+    /**
+     * \brief Constructor.
+     * \param table 2D table
+     * \param col_value column key value
+     */
+    Table2Slice(const Table2<ROW_TYPE,COL_TYPE,VAL_TYPE>& table, COL_TYPE col_value)
+        : _col_value(col_value)
+    {
+        if (table._size > 0)
+        {
+            _storage    = table._storage;
+            _row_values = table._row_values;
+            _rows       = table._rows;
+            _cols       = table._cols;
+
+            if      (col_value < table._col_values[0])         col_value = table._col_values[0];
+            else if (col_value > table._col_values[_cols - 1]) col_value = table._col_values[_cols - 1];
+
+            const unsigned int col = FindTableInterval(table._col_values, _cols, col_value, 0);
+
+            _cells = table._inter_data + col;
+            _dc    = static_cast<double>(col_value - table._col_values[col]);
+        }
+    }
+
+    /**
+     * \brief Returns slice value for the given row key.
+     * Recently found interval is stored inside the slice object to speed up
+     * subsequent queries, therefore this function should not be called on
+     * a slice shared between threads. Use GetValue(ROW_TYPE,TableCursor*)
+     * or GetValueStateless(ROW_TYPE) instead.
+     * \param row_value row key value
+     * \return interpolated value on success or NaN on failure
+     */
+    VAL_TYPE GetValue(ROW_TYPE row_value) const
+    {
+        return CalculateValue(row_value, &_prev);
+    }
+
+    /**
+     * \brief Returns slice value for the given row key.
+     * \param row_value row key value
+     * \param cursor lookup cursor
+     * \return interpolated value on success or NaN on failure
+     */
+    VAL_TYPE GetValue(ROW_TYPE row_value, TableCursor* cursor) const
+    {
+        return CalculateValue(row_value, &cursor->index);
+    }
+
+    /**
+     * \brief Returns slice value for the given row key.
+     * Neither the slice nor any other state is modified.
+     * \param row_value row key value
+     * \return interpolated value on success or NaN on failure
+     */
+    VAL_TYPE GetValueStateless(ROW_TYPE row_value) const
+    {
+        unsigned int prev = 0;
+        return CalculateValue(row_value, &prev);
+    }
+
+    /**
+     * \brief Returns row key for the given row index.
+     * \param row_index row index
+     * \return row key value on success or NaN on failure
+     */
+    ROW_TYPE GetKeyByIndex(unsigned int row_index) const
+    {
+        if (row_index < _rows)
+        {
+            return _row_values[row_index];
+        }
+
+        return ROW_TYPE{ std::numeric_limits<double>::quiet_NaN() };
+    }
+
+    /**
+     * \brief Returns slice value for the given row index.
+     * \param row_index row index
+     * \return value on success or NaN on failure
+     */
+    VAL_TYPE GetValueByIndex(unsigned int row_index) const
+    {
+        if (row_index < _rows)
+        {
+            const Cell& cell = _cells[row_index * _cols];
+            return static_cast<VAL_TYPE>(static_cast<double>(cell.value) + _dc * cell.col_slope);
+        }
+
+        return VAL_TYPE{ std::numeric_limits<double>::quiet_NaN() };
+    }
+
+    /**
+     * \brief Creates 1-dimensional table of the slice nodes.
+     * \return 1-dimensional table
+     */
+    Table<ROW_TYPE,VAL_TYPE> ToTable() const
+    {
+        std::vector<ROW_TYPE> key_values(_row_values, _row_values + _rows);
+        std::vector<VAL_TYPE> table_data;
+        table_data.reserve(_rows);
+
+        for (unsigned int i = 0; i < _rows; ++i)
+        {
+            table_data.push_back(GetValueByIndex(i));
+        }
+
+        return Table<ROW_TYPE,VAL_TYPE>(key_values, table_data);
+    }
+
+    /** \return column key value of the slice */
+    inline COL_TYPE GetColValue() const { return _col_value; }
+
+    /** \return number of slice nodes */
+    inline unsigned int size() const { return _rows; }
+
+private:
+
+    using Cell = typename Table2<ROW_TYPE,COL_TYPE,VAL_TYPE>::Cell;
+
+    std::shared_ptr<const void> _storage;     ///< table data storage
+
+    const ROW_TYPE* _row_values = nullptr;    ///< rows keys values
+    const Cell* _cells = nullptr;             ///< cells of the slice column (strided by number of columns)
+
+    unsigned int _rows = 0;                   ///< number of rows
+    unsigned int _cols = 0;                   ///< number of table columns (cells stride)
+
+    COL_TYPE _col_value = COL_TYPE{0};        ///< column key value
+    double _dc = 0.0;                         ///< distance from the slice column cell origin
+
+    mutable unsigned int _prev = 0;           ///< previously found interval index
+
+    /**
+     * \brief Calculates slice value for the given row key.
+     * Key out of the table range is clamped to the table range.
+     * \param row_value row key value
+     * \param prev previously found interval index, updated on return
+     * \return interpolated value on success or NaN on failure
+     */
+    VAL_TYPE CalculateValue(ROW_TYPE row_value, unsigned int* prev) const
+    {
+        if (_rows > 0)
+        {
+            if      (row_value < _row_values[0])         row_value = _row_values[0];
+            else if (row_value > _row_values[_rows - 1]) row_value = _row_values[_rows - 1];
+
+            *prev = FindTableInterval(_row_values, _rows, row_value, *prev);
+
+            const Cell& cell = _cells[*prev * _cols];
+
+            const double dr = static_cast<double>(row_value - _row_values[*prev]);
+
+            return static_cast<VAL_TYPE>(static_cast<double>(cell.value)
+                                       + dr * (cell.row_slope + _dc * cell.twist) + _dc * cell.col_slope);
+        }
+
+        return VAL_TYPE{ std::numeric_limits<double>::quiet_NaN() };
+    }
+};
+
+/**
+ * \brief Converts 2D table from text format to binary format.
+ * \param str table in text format (see Table2::SetFromString())
+ * \return binary table data (see Table2::ToBinary())
+ */
+template <typename ROW_TYPE, typename COL_TYPE, typename VAL_TYPE>
+std::vector<char> ConvertTable2ToBinary(const char* str)
+{
+    Table2<ROW_TYPE,COL_TYPE,VAL_TYPE> table;
+    table.SetFromString(str);
+    return table.ToBinary();
+}
+
 } // namespace mc
 
 #endif // MCUTILS_MATH_TABLE2_H_
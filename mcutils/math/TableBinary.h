@@ -0,0 +1,186 @@
+/****************************************************************************//*
+ * Copyright (C) 2026 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_TABLEBINARY_H_
+#define MCUTILS_MATH_TABLEBINARY_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <mcutils/Result.h>
+
+namespace mc {
+
+/**
+ * \brief Binary tables format.
+ *
+ * Binary tables consist of a header followed by data sections. Each section
+ * starts at an offset which is a multiple of kTableBinaryAlignment, and holds
+ * table arrays in exactly the same layout as they are stored in memory, so
+ * tables can be loaded with a single memcpy per section or can wrap a memory
+ * mapped file region without copying data at all.
+ *
+ * Data is stored in the native byte order of the writer. The endianness tag
+ * allows readers to detect files written on a machine of a different
+ * endianness, such files are rejected.
+ */
+struct TableBinaryHeader
+{
+    static constexpr unsigned int kMaxSections = 4;    ///< maximum number of data sections
+
+    char magic[4];                          ///< magic number
+    std::uint32_t endianness;               ///< endianness tag
+    std::uint32_t version;                  ///< format version
+    std::uint32_t dimensions;               ///< number of table dimensions
+    std::uint32_t key_size[2];              ///< key types sizes expressed in bytes
+    std::uint32_t record_size;              ///< data record size expressed in bytes
+    std::uint32_t count[2];                 ///< number of keys in each dimension
+    std::uint32_t interpolation;            ///< interpolation method
+    std::uint32_t flags;                    ///< table flags
+    std::uint32_t reserved;                 ///< reserved
+    double step_inv;                        ///< inverse of keys step (uniform tables only)
+    std::uint64_t size;                     ///< total size expressed in bytes
+    std::uint64_t offset[kMaxSections];     ///< data sections offsets (0 if not present)
+    std::uint64_t length[kMaxSections];     ///< data sections lengths expressed in bytes
+};
+
+constexpr char          kTableBinaryMagic[4]    = { 'M', 'C', 'T', 'B' };   ///< binary tables magic number
+constexpr std::uint32_t kTableBinaryEndianness  = 0x01020304;               ///< binary tables endianness tag
+constexpr std::uint32_t kTableBinaryVersion     = 1;                        ///< binary tables format version
+constexpr std::size_t   kTableBinaryAlignment   = 64;                       ///< binary tables sections alignment
+
+constexpr std::uint32_t kTableBinaryFlagUniform = 0x1;                      ///< table keys are equally spaced
+
+/**
+ * \brief Returns the given offset rounded up to the binary tables alignment.
+ * \param offset offset expressed in bytes
+ * \return aligned offset
+ */
+inline std::size_t AlignTableBinaryOffset(std::size_t offset)
+{
+    return (offset + kTableBinaryAlignment - 1) / kTableBinaryAlignment * kTableBinaryAlignment;
+}
+
+/**
+ * \brief Initializes binary table header and calculates sections offsets.
+ * \param header header to be initialized
+ * \param lengths data sections lengths expressed in bytes
+ * \param sections number of data sections
+ */
+inline void InitTableBinaryHeader(TableBinaryHeader* header,
+                                  const std::uint64_t* lengths,
+                                  unsigned int sections)
+{
+    *header = TableBinaryHeader();
+
+    std::memcpy(header->magic, kTableBinaryMagic, sizeof(kTableBinaryMagic));
+    header->endianness = kTableBinaryEndianness;
+    header->version    = kTableBinaryVersion;
+
+    std::size_t offset = AlignTableBinaryOffset(sizeof(TableBinaryHeader));
+
+    for (unsigned int i = 0; i < sections && i < TableBinaryHeader::kMaxSections; ++i)
+    {
+        if (lengths[i] > 0)
+        {
+            header->offset[i] = offset;
+            header->length[i] = lengths[i];
+            offset = AlignTableBinaryOffset(offset + static_cast<std::size_t>(lengths[i]));
+        }
+    }
+
+    header->size = offset;
+}
+
+/**
+ * \brief Writes binary table header and data sections to a buffer.
+ * \param header binary table header
+ * \param sections data sections pointers
+ * \return binary table buffer
+ */
+inline std::vector<char> WriteTableBinary(const TableBinaryHeader& header,
+                                          const void* const* sections)
+{
+    std::vector<char> buffer(static_cast<std::size_t>(header.size), 0);
+
+    std::memcpy(buffer.data(), &header, sizeof(TableBinaryHeader));
+
+    for (unsigned int i = 0; i < TableBinaryHeader::kMaxSections; ++i)
+    {
+        if (header.length[i] > 0)
+        {
+            std::memcpy(buffer.data() + header.offset[i], sections[i],
+                        static_cast<std::size_t>(header.length[i]));
+        }
+    }
+
+    return buffer;
+}
+
+/**
+ * \brief Reads and validates binary table header.
+ * Checks magic number, endianness tag, format version and if all data
+ * sections are within the given buffer and are properly aligned.
+ * \param data binary table data
+ * \param size binary table data size expressed in bytes
+ * \param header output header
+ * \return Result::Success on success or Result::Failure on failure
+ */
+inline Result ReadTableBinaryHeader(const void* data, std::size_t size,
+                                    TableBinaryHeader* header)
+{
+    if (data == nullptr || size < sizeof(TableBinaryHeader))
+    {
+        return Result::Failure;
+    }
+
+    std::memcpy(header, data, sizeof(TableBinaryHeader));
+
+    if (std::memcmp(header->magic, kTableBinaryMagic, sizeof(kTableBinaryMagic)) != 0
+     || header->endianness != kTableBinaryEndianness
+     || header->version    != kTableBinaryVersion
+     || header->size > size)
+    {
+        return Result::Failure;
+    }
+
+    for (unsigned int i = 0; i < TableBinaryHeader::kMaxSections; ++i)
+    {
+        if (header->length[i] > 0)
+        {
+            if (header->offset[i] % kTableBinaryAlignment != 0
+             || header->offset[i] < sizeof(TableBinaryHeader)
+             || header->offset[i] > header->size
+             || header->length[i] > header->size - header->offset[i])
+            {
+                return Result::Failure;
+            }
+        }
+    }
+
+    return Result::Success;
+}
+
+} // namespace mc
+
+#endif // MCUTILS_MATH_TABLEBINARY_H_
@@ -0,0 +1,463 @@
+/****************************************************************************//*
+ * Copyright (C) 2026 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_TABLEEXPR_H_
+#define MCUTILS_MATH_TABLEEXPR_H_
+
+#include <limits>
+#include <type_traits>
+
+#include <mcutils/math/Table.h>
+
+namespace mc {
+
+/**
+ * \brief Table expression base class template.
+ *
+ * Table expressions are built of TableTerm objects combined with addition,
+ * subtraction and multiplication by number, e.g. (TableTerm(cl_0)
+ * + TableTerm(cl_alpha) * k + TableTerm(cl_flap)). No intermediate tables
+ * are created. Expression can be evaluated either pointwise with GetValue()
+ * or materialized once with Evaluate() into a table defined at the merged
+ * set of keys of all its terms. Merging is done in a single linear sweep.
+ *
+ * Expressions refer to the tables of their terms, which therefore have to
+ * outlive the expression.
+ *
+ * \tparam DERIVED derived expression type
+ */
+template <typename DERIVED>
+class TableExpr
+{
+public:
+
+    /** \return derived expression */
+    inline const DERIVED& derived() const
+    {
+        return static_cast<const DERIVED&>(*this);
+    }
+
+    /**
+     * \brief Evaluates expression at the merged set of keys of all its terms.
+     * For linearly interpolated terms resulting table is exactly equal to
+     * the pointwise evaluated expression. Resulting table uses linear
+     * interpolation.
+     * \return resulting table
+     */
+    auto Evaluate() const
+    {
+        using KeyType = typename DERIVED::KeyType;
+        using ValType = typename DERIVED::ValType;
+
+        unsigned int count = 0;
+
+        for (auto sweep = derived().GetSweep(); sweep.HasKey(); ++count)
+        {
+            sweep.SkipKey(sweep.GetKey());
+        }
+
+        Table<KeyType,ValType> result;
+        result.ResetArrays(count);
+
+        auto sweep = derived().GetSweep();
+
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            const KeyType key = sweep.GetKey();
+
+            result._key_values[i]    = key;
+            result._records[i].value = sweep.GetValue(key);
+
+            sweep.SkipKey(key);
+        }
+
+        result.UpdateInterpolationData();
+
+        return result;
+    }
+
+    /**
+     * \brief Converts expression to table, see Evaluate().
+     */
+    template <typename KEY_TYPE, typename VAL_TYPE>
+    operator Table<KEY_TYPE,VAL_TYPE>() const
+    {
+        static_assert(std::is_same<KEY_TYPE, typename DERIVED::KeyType>::value, "Key types must match");
+        static_assert(std::is_same<VAL_TYPE, typename DERIVED::ValType>::value, "Value types must match");
+
+        return Evaluate();
+    }
+
+protected:
+
+    TableExpr() = default;
+};
+
+/**
+ * \brief Table expression term.
+ * Refers to the table, which therefore has to outlive the expression.
+ */
+template <typename KEY_TYPE, typename VAL_TYPE>
+class TableTerm : public TableExpr<TableTerm<KEY_TYPE,VAL_TYPE>>
+{
+public:
+
+    using KeyType = KEY_TYPE;
+    using ValType = VAL_TYPE;
+
+    /**
+     * \brief Keys sweeping state.
+     * Sweeping goes through the merged set of keys of all the expression
+     * terms in ascending order. At each step all the term keys less than
+     * the current key have been skipped, so the interpolation interval is
+     * known without searching.
+     */
+    class Sweep
+    {
+    public:
+
+        /**
+         * \brief Constructor.
+         * \param table table
+         */
+        explicit Sweep(const Table<KEY_TYPE,VAL_TYPE>* table)
+            : _table(table)
+            , _key_values(table->_key_values)
+            , _size(table->_size)
+        {}
+
+        /** \return true if there are keys left */
+        inline bool HasKey() const
+        {
+            return _next < _size;
+        }
+
+        /** \return current key, valid only if there are keys left */
+        inline KEY_TYPE GetKey() const
+        {
+            return _key_values[_next];
+        }
+
+        /**
+         * \brief Skips keys less or equal to the given key.
+         * \param key_value key value
+         */
+        inline void SkipKey(KEY_TYPE key_value)
+        {
+            while (_next < _size && !(key_value < _key_values[_next])) ++_next;
+        }
+
+        /**
+         * \brief Returns table value for the given key.
+         * \param key_value key value, current key of the expression sweep
+         * \return interpolated value on success or NaN on failure
+         */
+        inline VAL_TYPE GetValue(KEY_TYPE key_value) const
+        {
+            if (_next == 0)
+            {
+                return _size > 0 ? _table->_records[0].value
+                                 : VAL_TYPE{ std::numeric_limits<double>::quiet_NaN() };
+            }
+
+            if (_next == _size)
+            {
+                return _table->_records[_size - 1].value;
+            }
+
+            if (!(key_value < _key_values[_next]))
+            {
+                return _table->_records[_next].value;
+            }
+
+            return _table->CalculateInterpolatedValue(_next - 1, key_value);
+        }
+
+    private:
+
+        const Table<KEY_TYPE,VAL_TYPE>* _table = nullptr;   ///< table
+
+        const KEY_TYPE* _key_values = nullptr;              ///< table key values
+        unsigned int _size = 0;                             ///< number of table keys
+        unsigned int _next = 0;                             ///< next key index
+    };
+
+    /**
+     * \brief Constructor.
+     * \param table table
+     */
+    explicit TableTerm(const Table<KEY_TYPE,VAL_TYPE>& table)
+        : _table(&table)
+    {}
+
+    /**
+     * \brief Returns expression value for the given key.
+     * \param key_value key value
+     * \return expression value on success or NaN on failure
+     */
+    inline VAL_TYPE GetValue(KEY_TYPE key_value) const
+    {
+        return _table->GetValueStateless(key_value);
+    }
+
+    /** \return keys sweeping state */
+    inline Sweep GetSweep() const
+    {
+        return Sweep(_table);
+    }
+
+private:
+
+    const Table<KEY_TYPE,VAL_TYPE>* _table = nullptr;   ///< table
+};
+
+/**
+ * \brief Table expression multiplied by number.
+ */
+template <typename EXPR>
+class TableScaled : public TableExpr<TableScaled<EXPR>>
+{
+public:
+
+    using KeyType = typename EXPR::KeyType;
+    using ValType = typename EXPR::ValType;
+
+    /** \brief Keys sweeping state. */
+    class Sweep
+    {
+    public:
+
+        /**
+         * \brief Constructor.
+         * \param sweep expression sweeping state
+         * \param factor factor
+         */
+        Sweep(typename EXPR::Sweep sweep, double factor)
+            : _sweep(sweep)
+            , _factor(factor)
+        {}
+
+        /** \return true if there are keys left */
+        inline bool HasKey() const { return _sweep.HasKey(); }
+
+        /** \return current key */
+        inline KeyType GetKey() const { return _sweep.GetKey(); }
+
+        /** \brief Skips keys less or equal to the given key. */
+        inline void SkipKey(KeyType key_value) { _sweep.SkipKey(key_value); }
+
+        /** \brief Returns expression value for the given key. */
+        inline ValType GetValue(KeyType key_value)
+        {
+            return _sweep.GetValue(key_value) * _factor;
+        }
+
+    private:
+
+        typename EXPR::Sweep _sweep;    ///< expression sweeping state
+        double _factor;                 ///< factor
+    };
+
+    /**
+     * \brief Constructor.
+     * \param expr expression
+     * \param factor factor
+     */
+    TableScaled(const EXPR& expr, double factor)
+        : _expr(expr)
+        , _factor(factor)
+    {}
+
+    /**
+     * \brief Returns expression value for the given key.
+     * \param key_value key value
+     * \return expression value on success or NaN on failure
+     */
+    inline ValType GetValue(KeyType key_value) const
+    {
+        return _expr.GetValue(key_value) * _factor;
+    }
+
+    /** \return keys sweeping state */
+    inline Sweep GetSweep() const
+    {
+        return Sweep(_expr.GetSweep(), _factor);
+    }
+
+private:
+
+    EXPR _expr;         ///< expression
+    double _factor;     ///< factor
+};
+
+/**
+ * \brief Sum of table expressions.
+ */
+template <typename LHS, typename RHS>
+class TableSum : public TableExpr<TableSum<LHS,RHS>>
+{
+public:
+
+    static_assert(std::is_same<typename LHS::KeyType, typename RHS::KeyType>::value, "Key types must match");
+    static_assert(std::is_same<typename LHS::ValType, typename RHS::ValType>::value, "Value types must match");
+
+    using KeyType = typename LHS::KeyType;
+    using ValType = typename LHS::ValType;
+
+    /** \brief Keys sweeping state, merges keys of both operands. */
+    class Sweep
+    {
+    public:
+
+        /**
+         * \brief Constructor.
+         * \param lhs left hand side operand sweeping state
+         * \param rhs right hand side operand sweeping state
+         */
+        Sweep(typename LHS::Sweep lhs, typename RHS::Sweep rhs)
+            : _lhs(lhs)
+            , _rhs(rhs)
+        {
+            UpdateKey();
+        }
+
+        /** \return true if there are keys left */
+        inline bool HasKey() const
+        {
+            return _has_key;
+        }
+
+        /** \return current key, the lower of operands current keys */
+        inline KeyType GetKey() const
+        {
+            return _key;
+        }
+
+        /** \brief Skips keys less or equal to the given key. */
+        inline void SkipKey(KeyType key_value)
+        {
+            _lhs.SkipKey(key_value);
+            _rhs.SkipKey(key_value);
+            UpdateKey();
+        }
+
+        /** \brief Returns expression value for the given key. */
+        inline ValType GetValue(KeyType key_value)
+        {
+            return _lhs.GetValue(key_value) + _rhs.GetValue(key_value);
+        }
+
+    private:
+
+        typename LHS::Sweep _lhs;   ///< left hand side operand sweeping state
+        typename RHS::Sweep _rhs;   ///< right hand side operand sweeping state
+
+        KeyType _key {};            ///< current key
+        bool _has_key = false;      ///< specifies if there are keys left
+
+        /** \brief Updates current key due to operands current keys. */
+        inline void UpdateKey()
+        {
+            const bool lhs_has_key = _lhs.HasKey();
+            const bool rhs_has_key = _rhs.HasKey();
+
+            _has_key = lhs_has_key || rhs_has_key;
+
+            if (lhs_has_key && rhs_has_key)
+            {
+                const KeyType lhs_key = _lhs.GetKey();
+                const KeyType rhs_key = _rhs.GetKey();
+                _key = rhs_key < lhs_key ? rhs_key : lhs_key;
+            }
+            else if (lhs_has_key)
+            {
+                _key = _lhs.GetKey();
+            }
+            else if (rhs_has_key)
+            {
+                _key = _rhs.GetKey();
+            }
+        }
+    };
+
+    /**
+     * \brief Constructor.
+     * \param lhs left hand side operand
+     * \param rhs right hand side operand
+     */
+    TableSum(const LHS& lhs, const RHS& rhs)
+        : _lhs(lhs)
+        , _rhs(rhs)
+    {}
+
+    /**
+     * \brief Returns expression value for the given key.
+     * \param key_value key value
+     * \return expression value on success or NaN on failure
+     */
+    inline ValType GetValue(KeyType key_value) const
+    {
+        return _lhs.GetValue(key_value) + _rhs.GetValue(key_value);
+    }
+
+    /** \return keys sweeping state */
+    inline Sweep GetSweep() const
+    {
+        return Sweep(_lhs.GetSweep(), _rhs.GetSweep());
+    }
+
+private:
+
+    LHS _lhs;   ///< left hand side operand
+    RHS _rhs;   ///< right hand side operand
+};
+
+/** \brief Addition operator. */
+template <typename LHS, typename RHS>
+inline TableSum<LHS,RHS> operator+(const TableExpr<LHS>& lhs, const TableExpr<RHS>& rhs)
+{
+    return TableSum<LHS,RHS>(lhs.derived(), rhs.derived());
+}
+
+/** \brief Subtraction operator. */
+template <typename LHS, typename RHS>
+inline TableSum<LHS,TableScaled<RHS>> operator-(const TableExpr<LHS>& lhs, const TableExpr<RHS>& rhs)
+{
+    return TableSum<LHS,TableScaled<RHS>>(lhs.derived(), TableScaled<RHS>(rhs.derived(), -1.0));
+}
+
+/** \brief Multiplication operator (by number). */
+template <typename EXPR>
+inline TableScaled<EXPR> operator*(const TableExpr<EXPR>& expr, double val)
+{
+    return TableScaled<EXPR>(expr.derived(), val);
+}
+
+/** \brief Multiplication operator (by number). */
+template <typename EXPR>
+inline TableScaled<EXPR> operator*(double val, const TableExpr<EXPR>& expr)
+{
+    return TableScaled<EXPR>(expr.derived(), val);
+}
+
+} // namespace mc
+
+#endif // MCUTILS_MATH_TABLEEXPR_H_
@@ -0,0 +1,678 @@
+/****************************************************************************//*
+ * Copyright (C) 2026 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_TABLEN_H_
+#define MCUTILS_MATH_TABLEN_H_
+
+#include <array>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include <mcutils/math/Table.h>
+#include <mcutils/math/Table2.h>
+
+#include <mcutils/misc/Check.h>
+#include <mcutils/misc/PtrUtils.h>
+
+namespace mc {
+
+/**
+ * \brief N-dimensional table lookup cursor.
+ * Caller owned search hint used by TableN lookups. Each thread should use its
+ * own cursor, so one immutable table may be shared between threads.
+ */
+template <unsigned int N>
+struct TableNCursor
+{
+    std::array<unsigned int, N> index {};   ///< recently found intervals indices
+};
+
+/**
+ * \brief N-dimensional table and multilinear interpolation class template.
+ *
+ * Generalization of Table and Table2 for datasets of higher dimensions, e.g.
+ * lift coefficient as a function of angle of attack, Mach number, altitude
+ * and flaps deflection. All the data is stored contiguously in row-major
+ * order (the last axis varies fastest). Each lookup does one search per axis
+ * starting from the recently found interval, equally spaced axes are
+ * indexed directly. Value is interpolated between 2^N cell corners.
+ *
+ * Table data is shared between copies of the table, see MakeArraysUnique().
+ *
+ * \tparam N number of dimensions
+ * \tparam VAL_TYPE value type
+ */
+template <unsigned int N, typename VAL_TYPE>
+class TableN
+{
+public:
+
+    static_assert(N > 0 && N <= 8, "Number of dimensions must be within 1 to 8");
+
+    using Keys = std::array<double, N>;                 ///< keys of all axes
+    using Indices = std::array<unsigned int, N>;        ///< indices of all axes
+
+    /**
+     * \brief Constructor.
+     * This constructor creates table with only one node initialized with
+     * a given value at all keys equal to 0.
+     * \param val value
+     */
+    explicit TableN(VAL_TYPE val = VAL_TYPE{0})
+    {
+        std::array<std::vector<double>, N> key_values;
+        for (unsigned int a = 0; a < N; ++a)
+        {
+            key_values[a].push_back(0.0);
+        }
+
+        SetData(key_values, std::vector<VAL_TYPE>(1, val));
+    }
+
+    /**
+     * \brief Constructor.
+     * This constructor is used to initialize table with data.
+     * \param key_values keys of each axis
+     * \param table_data table data in row-major order (the last axis varies fastest)
+     */
+    TableN(const std::array<std::vector<double>, N>& key_values,
+           const std::vector<VAL_TYPE>& table_data)
+    {
+        SetData(key_values, table_data);
+    }
+
+    /**
+     * \brief Constructor.
+     * Creates 1-dimensional table of nodes of the given table.
+     * \param table 1-dimensional table
+     */
+    template <typename KEY_TYPE, unsigned int M = N, typename = std::enable_if_t<M == 1>>
+    explicit TableN(const Table<KEY_TYPE,VAL_TYPE>& table)
+    {
+        std::array<std::vector<double>, N> key_values;
+        std::vector<VAL_TYPE> table_data;
+
+        for (unsigned int i = 0; i < table.size(); ++i)
+        {
+            key_values[0].push_back(static_cast<double>(table.GetKeyByIndex(i)));
+            table_data.push_back(table.GetValueByIndex(i));
+        }
+
+        SetData(key_values, table_data);
+    }
+
+    /**
+     * \brief Constructor.
+     * Creates 2-dimensional table of nodes of the given table.
+     * \param table 2-dimensional table
+     */
+    template <typename ROW_TYPE, typename COL_TYPE, unsigned int M = N, typename = std::enable_if_t<M == 2>>
+    explicit TableN(const Table2<ROW_TYPE,COL_TYPE,VAL_TYPE>& table)
+    {
+        std::array<std::vector<double>, N> key_values;
+        std::vector<VAL_TYPE> table_data;
+
+        for (unsigned int r = 0; r < table.rows(); ++r)
+        {
+            key_values[0].push_back(static_cast<double>(table.GetRowKeyByIndex(r)));
+        }
+
+        for (unsigned int c = 0; c < table.cols(); ++c)
+        {
+            key_values[1].push_back(static_cast<double>(table.GetColKeyByIndex(c)));
+        }
+
+        for (unsigned int r = 0; r < table.rows(); ++r)
+        {
+            for (unsigned int c = 0; c < table.cols(); ++c)
+            {
+                table_data.push_back(table.GetValueByIndex(r, c));
+            }
+        }
+
+        SetData(key_values, table_data);
+    }
+
+    /**
+     * \brief Copy constructor.
+     * Table data is not copied but shared, see MakeArraysUnique().
+     * There is no move constructor, moving shares data as well.
+     */
+    TableN(const TableN<N,VAL_TYPE>&) = default;
+
+    /**
+     * \brief Returns table value for the given keys.
+     * Returns table value for the given keys values using multilinear
+     * interpolation algorithm. Recently found cell is stored inside the table
+     * object to speed up subsequent queries, therefore this function should
+     * not be called on a table shared between threads. Use
+     * GetValue(const Keys&,TableNCursor<N>*) or GetValueStateless() instead.
+     * \param key_values keys values
+     * \return interpolated value on success or NaN on failure
+     */
+    VAL_TYPE GetValue(const Keys& key_values) const
+    {
+        return CalculateValue(key_values, &_prev);
+    }
+
+    /**
+     * \brief Returns table value for the given keys.
+     * \param key_values keys values, one per axis
+     * \return interpolated value on success or NaN on failure
+     */
+    template <typename... KEY_TYPES, typename = std::enable_if_t<sizeof...(KEY_TYPES) == N>>
+    VAL_TYPE GetValue(KEY_TYPES... key_values) const
+    {
+        return CalculateValue(Keys{ static_cast<double>(key_values)... }, &_prev);
+    }
+
+    /**
+     * \brief Returns table value for the given keys.
+     * Returns table value for the given keys values using multilinear
+     * interpolation algorithm. Recently found cell is stored in the given
+     * caller owned cursor, so the table itself is not modified.
+     * \param key_values keys values
+     * \param cursor lookup cursor
+     * \return interpolated value on success or NaN on failure
+     */
+    VAL_TYPE GetValue(const Keys& key_values, TableNCursor<N>* cursor) const
+    {
+        return CalculateValue(key_values, cursor);
+    }
+
+    /**
+     * \brief Returns table value for the given keys.
+     * Returns table value for the given keys values using multilinear
+     * interpolation algorithm. Neither the table nor any other state is
+     * modified.
+     * \param key_values keys values
+     * \return interpolated value on success or NaN on failure
+     */
+    VAL_TYPE GetValueStateless(const Keys& key_values) const
+    {
+        TableNCursor<N> cursor;
+        return CalculateValue(key_values, &cursor);
+    }
+
+    /**
+     * \brief Returns table values for the given keys.
+     * Keys are processed in order, each search starts from the interval
+     * found for the previous keys, so slowly varying keys are evaluated
+     * without searching. The table itself is not modified.
+     * \param key_values keys values array
+     * \param values output array of interpolated values (NaN on failure)
+     * \param count number of keys
+     */
+    void GetValues(const Keys* key_values, VAL_TYPE* values, unsigned int count) const
+    {
+        TableNCursor<N> cursor;
+
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            values[i] = CalculateValue(key_values[i], &cursor);
+        }
+    }
+
+    /**
+     * \brief Returns table values for the given keys.
+     * \param key_values keys values vector
+     * \return vector of interpolated values (NaN on failure)
+     */
+    std::vector<VAL_TYPE> GetValues(const std::vector<Keys>& key_values) const
+    {
+        std::vector<VAL_TYPE> values(key_values.size());
+        GetValues(key_values.data(), values.data(), static_cast<unsigned int>(key_values.size()));
+        return values;
+    }
+
+    /**
+     * \brief Returns key for the given axis and key index.
+     * \param axis axis index
+     * \param index key index
+     * \return key value on success or NaN on failure
+     */
+    double GetKeyByIndex(unsigned int axis, unsigned int index) const
+    {
+        if (_size > 0 && axis < N && index < _sizes[axis])
+        {
+            return _key_values[_offsets[axis] + index];
+        }
+
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    /**
+     * \brief Returns table value for the given keys indices.
+     * \param indices keys indices
+     * \return value on success or NaN on failure
+     */
+    VAL_TYPE GetValueByIndex(const Indices& indices) const
+    {
+        if (_size > 0)
+        {
+            unsigned int offset = 0;
+
+            for (unsigned int a = 0; a < N; ++a)
+            {
+                if (indices[a] >= _sizes[a])
+                {
+                    return VAL_TYPE{ std::numeric_limits<double>::quiet_NaN() };
+                }
+
+                offset += indices[a] * _strides[a];
+            }
+
+            return _table_data[offset];
+        }
+
+        return VAL_TYPE{ std::numeric_limits<double>::quiet_NaN() };
+    }
+
+    /**
+     * \brief Checks if table is valid.
+     * \return returns true if size is greater than 0, all data is valid
+     * and keys of each axis are in ascending order
+     */
+    bool IsValid() const
+    {
+        bool result = _size > 0;
+
+        for (unsigned int a = 0; a < N && result; ++a)
+        {
+            const double* keys = _key_values + _offsets[a];
+
+            for (unsigned int i = 0; i < _sizes[a] && result; ++i)
+            {
+                result = mc::IsValid(keys[i]);
+
+                if (i > 0)
+                {
+                    result &= keys[i - 1] < keys[i];
+                }
+            }
+        }
+
+        for (unsigned int i = 0; i < _size && result; ++i)
+        {
+            result = mc::IsValid(_table_data[i]);
+        }
+
+        return result;
+    }
+
+    /**
+     * \brief Multiplies keys of the given axis by the given factor.
+     * \param axis axis index
+     * \param factor given factor
+     */
+    void MultiplyKeys(unsigned int axis, double factor)
+    {
+        if (_size > 0 && axis < N)
+        {
+            MakeArraysUnique();
+
+            for (unsigned int i = 0; i < _sizes[axis]; ++i)
+            {
+                _key_values[_offsets[axis] + i] *= factor;
+            }
+
+            UpdateInterpolationData();
+        }
+    }
+
+    /**
+     * \brief Multiplies values by the given factor.
+     * \param factor given factor
+     */
+    void MultiplyValues(double factor)
+    {
+        MakeArraysUnique();
+
+        for (unsigned int i = 0; i < _size; ++i)
+        {
+            _table_data[i] *= factor;
+        }
+    }
+
+    /**
+     * \brief Sets table data.
+     * Table becomes empty if the data size does not match the keys sizes.
+     * \param key_values keys of each axis
+     * \param table_data table data in row-major order (the last axis varies fastest)
+     */
+    void SetData(const std::array<std::vector<double>, N>& key_values,
+                 const std::vector<VAL_TYPE>& table_data)
+    {
+        std::size_t size = 1;
+        std::size_t keys = 0;
+
+        for (unsigned int a = 0; a < N; ++a)
+        {
+            size *= key_values[a].size();
+            keys += key_values[a].size();
+        }
+
+        DeleteArrays();
+
+        if (size > 0 && size == table_data.size())
+        {
+            _size = static_cast<unsigned int>(size);
+
+            unsigned int offset = 0;
+            unsigned int stride = 1;
+
+            for (unsigned int a = N; a-- > 0;)
+            {
+                _sizes[a]   = static_cast<unsigned int>(key_values[a].size());
+                _strides[a] = stride;
+                stride *= _sizes[a];
+            }
+
+            for (unsigned int a = 0; a < N; ++a)
+            {
+                _offsets[a] = offset;
+                offset += _sizes[a];
+            }
+
+            CreateArrays(static_cast<unsigned int>(keys));
+
+            for (unsigned int a = 0; a < N; ++a)
+            {
+                for (unsigned int i = 0; i < _sizes[a]; ++i)
+                {
+                    _key_values[_offsets[a] + i] = key_values[a][i];
+                }
+            }
+
+            for (unsigned int i = 0; i < _size; ++i)
+            {
+                _table_data[i] = table_data[i];
+            }
+
+            UpdateInterpolationData();
+        }
+    }
+
+    /** \return number of table elements */
+    inline unsigned int size() const { return _size; }
+
+    /**
+     * \param axis axis index
+     * \return number of keys of the given axis
+     */
+    inline unsigned int size(unsigned int axis) const { return axis < N ? _sizes[axis] : 0; }
+
+    /** \return true if table data is shared with other tables */
+    inline bool IsShared() const { return _storage && _storage.use_count() > 1; }
+
+    /**
+     * \brief Assignment operator.
+     * Table data is not copied but shared, see MakeArraysUnique().
+     */
+    TableN<N,VAL_TYPE>& operator=(const TableN<N,VAL_TYPE>&) = default;
+
+private:
+
+    /** \brief Table data storage. */
+    struct Storage
+    {
+        double*   key_values = nullptr;   ///< keys of all axes
+        double*   inv_deltas = nullptr;   ///< inverse lengths of keys intervals
+        VAL_TYPE* table_data = nullptr;   ///< table data
+
+        unsigned int keys = 0;            ///< number of keys of all axes
+        unsigned int size = 0;            ///< number of table elements
+
+        Storage() = default;
+        Storage(const Storage&) = delete;
+        Storage& operator=(const Storage&) = delete;
+
+        ~Storage()
+        {
+            DeletePtrArray(key_values);
+            DeletePtrArray(inv_deltas);
+            DeletePtrArray(table_data);
+        }
+    };
+
+    unsigned int _size = 0;                 ///< number of table elements
+
+    unsigned int _sizes   [N] = {};         ///< number of keys of each axis
+    unsigned int _strides [N] = {};         ///< data strides of each axis
+    unsigned int _offsets [N] = {};         ///< offsets of each axis keys in keys array
+    unsigned int _corners [N] = {};         ///< data offsets of cell corners along each axis
+
+    bool   _uniform  [N] = {};              ///< specifies if axis keys are equally spaced
+    double _step_inv [N] = {};              ///< inverse of axis keys step (uniform axes only)
+
+    double*   _key_values = nullptr;        ///< keys of all axes (storage array)
+    double*   _inv_deltas = nullptr;        ///< inverse lengths of keys intervals (storage array)
+    VAL_TYPE* _table_data = nullptr;        ///< table data (storage array)
+
+    std::shared_ptr<Storage> _storage;      ///< table data storage
+
+    mutable TableNCursor<N> _prev;          ///< previously found cell
+
+    /**
+     * \brief Calculates table value for the given keys.
+     * Keys out of the table range are clamped to the table range.
+     * \param key_values keys values
+     * \param prev previously found cell, updated on return
+     * \return interpolated value on success or NaN on failure
+     */
+    VAL_TYPE CalculateValue(const Keys& key_values, TableNCursor<N>* prev) const
+    {
+        if (_size > 0)
+        {
+            unsigned int offset = 0;
+            double factor[N];
+
+            for (unsigned int a = 0; a < N; ++a)
+            {
+                const double* keys = _key_values + _offsets[a];
+                const unsigned int last = _sizes[a] - 1;
+
+                double key = key_values[a];
+                if      (key < keys[0])    key = keys[0];
+                else if (key > keys[last]) key = keys[last];
+
+                unsigned int index = 0;
+
+                if (_uniform[a])
+                {
+                    const double pos = (key - keys[0]) * _step_inv[a];
+                    // NaN fails comparison
+                    index = (pos < static_cast<double>(last)) ? static_cast<unsigned int>(pos) : last - 1;
+                }
+                else
+                {
+                    index = FindTableInterval(keys, _sizes[a], key, prev->index[a]);
+                }
+
+                prev->index[a] = index;
+
+                factor[a] = (key - keys[index]) * _inv_deltas[_offsets[a] + index];
+                offset += index * _strides[a];
+            }
+
+            return static_cast<VAL_TYPE>(Interpolate<N>(_table_data + offset, factor));
+        }
+
+        return VAL_TYPE{ std::numeric_limits<double>::quiet_NaN() };
+    }
+
+    /**
+     * \brief Interpolates cell value along the first A axes.
+     * Recursion is resolved at compile time, so all the 2^A cell corners
+     * are gathered without loops. Value is computed in double precision
+     * regardless of the value type.
+     * \tparam A number of axes
+     * \param data pointer to the cell corner of the lowest keys
+     * \param factor interpolation factors of each axis
+     * \return interpolated value
+     */
+    template <unsigned int A>
+    inline double Interpolate(const VAL_TYPE* data, const double* factor) const
+    {
+        if constexpr (A == 0)
+        {
+            return static_cast<double>(*data);
+        }
+        else
+        {
+            const double v0 = Interpolate<A - 1>(data, factor);
+            const double v1 = Interpolate<A - 1>(data + _corners[A - 1], factor);
+            return v0 + (v1 - v0) * factor[A - 1];
+        }
+    }
+
+    /**
+     * \brief Creates data tables.
+     * \param keys number of keys of all axes
+     */
+    void CreateArrays(unsigned int keys)
+    {
+        _storage = std::make_shared<Storage>();
+
+        _storage->keys = keys;
+        _storage->size = _size;
+
+        _storage->key_values = new double [keys];
+        _storage->inv_deltas = new double [keys];
+        _storage->table_data = new VAL_TYPE [_size];
+
+        _key_values = _storage->key_values;
+        _inv_deltas = _storage->inv_deltas;
+        _table_data = _storage->table_data;
+    }
+
+    /** Deletes data tables. */
+    void DeleteArrays()
+    {
+        _storage.reset();
+
+        _key_values = nullptr;
+        _inv_deltas = nullptr;
+        _table_data = nullptr;
+
+        _size = 0;
+
+        for (unsigned int a = 0; a < N; ++a)
+        {
+            _sizes   [a] = 0;
+            _strides [a] = 0;
+            _offsets [a] = 0;
+            _corners [a] = 0;
+            _uniform [a] = false;
+            _step_inv[a] = 0.0;
+        }
+    }
+
+    /**
+     * \brief Makes table data storage unique (copy-on-write).
+     * Copies data shared with other tables into the table own storage.
+     * Has to be called before any modification of the table data.
+     */
+    void MakeArraysUnique()
+    {
+        if (_storage && _storage.use_count() > 1)
+        {
+            std::shared_ptr<Storage> storage = _storage;
+
+            CreateArrays(storage->keys);
+
+            for (unsigned int i = 0; i < storage->keys; ++i)
+            {
+                _key_values[i] = storage->key_values[i];
+                _inv_deltas[i] = storage->inv_deltas[i];
+            }
+
+            for (unsigned int i = 0; i < _size; ++i)
+            {
+                _table_data[i] = storage->table_data[i];
+            }
+        }
+    }
+
+    /** \brief Updates interpolation data due to table keys. */
+    void UpdateInterpolationData()
+    {
+        for (unsigned int a = 0; a < N; ++a)
+        {
+            const double* keys = _key_values + _offsets[a];
+            double* inv_deltas = _inv_deltas + _offsets[a];
+
+            const unsigned int last = _sizes[a] - 1;
+
+            // single key axes have no cells, interpolation factor is 0
+            for (unsigned int i = 0; i < last; ++i)
+            {
+                const double delta = keys[i + 1] - keys[i];
+                inv_deltas[i] = fabs(delta) > 1.0e-16 ? 1.0 / delta : 0.0;
+            }
+
+            inv_deltas[last] = 0.0;
+
+            _corners[a] = last > 0 ? _strides[a] : 0;
+
+            UpdateUniformData(a);
+        }
+    }
+
+    /**
+     * \brief Updates uniform axis data due to axis keys.
+     * \param axis axis index
+     */
+    void UpdateUniformData(unsigned int axis)
+    {
+        _uniform  [axis] = false;
+        _step_inv [axis] = 0.0;
+
+        const double* keys = _key_values + _offsets[axis];
+        const unsigned int last = _sizes[axis] - 1;
+
+        if (last > 1)
+        {
+            const double step = (keys[last] - keys[0]) / last;
+            const double tol  = 1.0e-9 * fabs(step);
+
+            bool uniform = step > 0.0;
+
+            for (unsigned int i = 0; i < last && uniform; ++i)
+            {
+                uniform = fabs(keys[i + 1] - keys[i] - step) <= tol;
+            }
+
+            if (uniform)
+            {
+                _uniform  [axis] = true;
+                _step_inv [axis] = 1.0 / step;
+            }
+        }
+    }
+};
+
+} // namespace mc
+
+#endif // MCUTILS_MATH_TABLEN_H_
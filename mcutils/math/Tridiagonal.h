@@ -0,0 +1,112 @@
+/****************************************************************************//*
+ * Copyright (C) 2026 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_TRIDIAGONAL_H_
+#define MCUTILS_MATH_TRIDIAGONAL_H_
+
+#include <cmath>
+
+#include <mcutils/Result.h>
+
+#include <mcutils/math/BandMatrix.h>
+#include <mcutils/math/Vector.h>
+
+namespace mc {
+
+/**
+ * \brief Tridiagonal matrix type.
+ * \tparam TYPE matrix element type
+ * \tparam SIZE matrix size
+ */
+template <typename TYPE, unsigned int SIZE>
+using TridiagonalMatrix = BandMatrix<TYPE, SIZE, 1, 1>;
+
+/**
+ * \brief Solves tridiagonal system of linear equations using Thomas algorithm.
+ *
+ * Takes O(n) time. There is no pivoting, so the method is stable for
+ * diagonally dominant or symmetric positive-definite matrices, which is
+ * the case of chains of masses or thermal and fluid nodes. Use BandLU for
+ * other matrices.
+ *
+ * \param mtr left hand side tridiagonal matrix
+ * \param rhs right hand side vector
+ * \param x result vector, may be the right hand side vector
+ * \param eps minimum value treated as not-zero
+ * \return mc::Result::Success on success and mc::Result::Failure on failure
+ *
+ * ### Refernces:
+ * - Press W., et al.: Numerical Recipes: The Art of Scientific Computing, 2007, p.56
+ * - [Tridiagonal matrix algorithm - Wikipedia](https://en.wikipedia.org/wiki/Tridiagonal_matrix_algorithm)
+ */
+template <typename TYPE, unsigned int SIZE>
+Result SolveTridiagonal(const TridiagonalMatrix<TYPE, SIZE>& mtr, const VectorN<TYPE, SIZE>& rhs,
+                        VectorN<TYPE, SIZE>* x, double eps = 1.0e-9)
+{
+    // each row stores subdiagonal, diagonal and superdiagonal element
+    const TYPE* abc = mtr.data();
+
+    // modified superdiagonal
+    VectorN<TYPE, SIZE> c_mod;
+
+    // forward sweep, modified right hand side is stored in the result vector
+    double b_0 = abc[1];
+    if (fabs(b_0) < fabs(eps))
+    {
+        return Result::Failure;
+    }
+
+    double b_inv = 1.0 / b_0;
+    if (SIZE > 1)
+    {
+        c_mod(0) = abc[2] * b_inv;
+    }
+    (*x)(0) = rhs(0) * b_inv;
+
+    for (unsigned int i = 1; i < SIZE; ++i)
+    {
+        double a_i = abc[3*i];
+        double b_i = abc[3*i + 1] - a_i * c_mod(i-1);
+        if (fabs(b_i) < fabs(eps))
+        {
+            return Result::Failure;
+        }
+
+        b_inv = 1.0 / b_i;
+        if (i < SIZE - 1)
+        {
+            c_mod(i) = abc[3*i + 2] * b_inv;
+        }
+        (*x)(i) = (rhs(i) - a_i * (*x)(i-1)) * b_inv;
+    }
+
+    // back substitution
+    for (unsigned int i = SIZE - 1; i-- > 0;)
+    {
+        (*x)(i) -= c_mod(i) * (*x)(i+1);
+    }
+
+    return Result::Success;
+}
+
+} // namespace mc
+
+#endif // MCUTILS_MATH_TRIDIAGONAL_H_
@@ -38,19 +38,19 @@ class UVector3 : public Vector3<TYPE>
 {
 public:
 
-    inline static const UVector3<TYPE> i() { return UVector3<TYPE>(TYPE{1}, TYPE{0}, TYPE{0}); }
-    inline static const UVector3<TYPE> j() { return UVector3<TYPE>(TYPE{0}, TYPE{1}, TYPE{0}); }
-    inline static const UVector3<TYPE> k() { return UVector3<TYPE>(TYPE{0}, TYPE{0}, TYPE{1}); }
+    static constexpr UVector3<TYPE> i() { return UVector3<TYPE>(TYPE{1}, TYPE{0}, TYPE{0}); }
+    static constexpr UVector3<TYPE> j() { return UVector3<TYPE>(TYPE{0}, TYPE{1}, TYPE{0}); }
+    static constexpr UVector3<TYPE> k() { return UVector3<TYPE>(TYPE{0}, TYPE{0}, TYPE{1}); }
 
     /** \brief Constructor. */
-    UVector3(TYPE x = TYPE{0}, TYPE y = TYPE{0}, TYPE z = TYPE{0})
+    constexpr UVector3(TYPE x = TYPE{0}, TYPE y = TYPE{0}, TYPE z = TYPE{0})
     {
         this->Set(x, y, z);
     }
 
     /** \brief Casting constructor. */
     template <class RHS_TYPE>
-    UVector3(const UVector3<RHS_TYPE> &vect)
+    constexpr UVector3(const UVector3<RHS_TYPE> &vect)
     {
         this->x() = vect.x();
         this->y() = vect.y();
@@ -106,13 +106,13 @@ public:
     }
 
     /** \brief Normalize vector. */
-    operator Vector3<double>() const
+    constexpr operator Vector3<double>() const
     {
         return Vector3<double>(this->x()(), this->y()(), this->z()());
     }
 
     /** \brief Addition operator. */
-    UVector3<TYPE> operator+(const UVector3<TYPE>& vect) const
+    constexpr UVector3<TYPE> operator+(const UVector3<TYPE>& vect) const
     {
         UVector3<TYPE> result(*this);
         result.Add(vect);
@@ -120,7 +120,7 @@ public:
     }
 
     /** \brief Negation operator. */
-    UVector3<TYPE> operator-() const
+    constexpr UVector3<TYPE> operator-() const
     {
         UVector3<TYPE> result(*this);
         result.Negate();
@@ -128,7 +128,7 @@ public:
     }
 
     /** \brief Subtraction operator. */
-    UVector3<TYPE> operator-(const UVector3<TYPE>& vect) const
+    constexpr UVector3<TYPE> operator-(const UVector3<TYPE>& vect) const
     {
         UVector3<TYPE> result(*this);
         result.Substract(vect);
@@ -136,7 +136,7 @@ public:
     }
 
     /** \brief Multiplication operator (by number). */
-    UVector3<TYPE> operator*(double value) const
+    constexpr UVector3<TYPE> operator*(double value) const
     {
         UVector3<TYPE> result(*this);
         result.MultiplyByValue(value);
@@ -145,7 +145,7 @@ public:
 
     /** \brief Multiplication operator (by scalar). */
     template <class RHS_TYPE>
-    auto operator*(const RHS_TYPE& value) const
+    constexpr auto operator*(const RHS_TYPE& value) const
     {
         using UnitsLhs = typename units::traits::unit_t_traits<TYPE>::unit_type;
         using UnitsRhs = typename units::traits::unit_t_traits<RHS_TYPE>::unit_type;
@@ -161,13 +161,13 @@ public:
 
     /** \brief Dot product operator. */
     template <class RHS_TYPE>
-    auto operator*(const UVector3<RHS_TYPE>& vect)
+    constexpr auto operator*(const UVector3<RHS_TYPE>& vect)
     {
         return this->x()*vect.x() + this->y()*vect.y() + this->z()*vect.z();
     }
 
     /** \brief Division operator (by number). */
-    UVector3<TYPE> operator/(double value) const
+    constexpr UVector3<TYPE> operator/(double value) const
     {
         UVector3<TYPE> result(*this);
         result.DivideByValue(value);
@@ -176,7 +176,7 @@ public:
 
     /** \brief Division operator (by scalar). */
     template <class RHS_TYPE>
-    auto operator/(RHS_TYPE value) const
+    constexpr auto operator/(RHS_TYPE value) const
     {
         using UnitsLhs = typename units::traits::unit_t_traits<TYPE>::unit_type;
         using UnitsRhs = typename units::traits::unit_t_traits<RHS_TYPE>::unit_type;
@@ -191,28 +191,28 @@ public:
     }
 
     /** \brief Unary addition operator. */
-    UVector3<TYPE>& operator+=(const UVector3<TYPE>& vect)
+    constexpr UVector3<TYPE>& operator+=(const UVector3<TYPE>& vect)
     {
         this->Add(vect);
         return *this;
     }
 
     /** \brief Unary subtraction operator. */
-    UVector3<TYPE>& operator-=(const UVector3<TYPE>& vect)
+    constexpr UVector3<TYPE>& operator-=(const UVector3<TYPE>& vect)
     {
         this->Substract(vect);
         return *this;
     }
 
     /** \brief Unary multiplication operator (by number). */
-    UVector3<TYPE>& operator*=(double value)
+    constexpr UVector3<TYPE>& operator*=(double value)
     {
         this->MultiplyByValue(value);
         return *this;
     }
 
     /** \brief Unary division operator (by number). */
-    UVector3<TYPE>& operator/=(double value)
+    constexpr UVector3<TYPE>& operator/=(double value)
     {
         this->DivideByValue(value);
         return *this;
@@ -220,7 +220,7 @@ public:
 
     /** @brief Assignment operator. */
     template <class RHS_TYPE>
-    const UVector3<TYPE>& operator= (const UVector3<RHS_TYPE> &vect)
+    constexpr const UVector3<TYPE>& operator= (const UVector3<RHS_TYPE> &vect)
     {
         this->x() = vect.x();
         this->y() = vect.y();
@@ -231,7 +231,7 @@ public:
 
 /** \brief Multiplication operator (by number). */
 template <typename TYPE>
-inline UVector3<TYPE> operator*(double value, const UVector3<TYPE>& vect)
+constexpr UVector3<TYPE> operator*(double value, const UVector3<TYPE>& vect)
 {
     return vect * value;
 }
@@ -239,7 +239,7 @@ inline UVector3<TYPE> operator*(double value, const UVector3<TYPE>& vect)
 /** \brief Multiplication operator (by scalar). */
 // enable if LHS_TYPE is a unit type
 template <class LHS_TYPE, class RHS_TYPE, typename std::enable_if<units::traits::is_unit_t<LHS_TYPE>::value, int>::type = 0>
-inline auto operator*(const LHS_TYPE& value, const UVector3<RHS_TYPE>& vect)
+constexpr auto operator*(const LHS_TYPE& value, const UVector3<RHS_TYPE>& vect)
 {
     return vect * value;
 }
@@ -249,7 +249,7 @@ inline auto operator*(const LHS_TYPE& value, const UVector3<RHS_TYPE>& vect)
  * \tparam RHS_TYPE right hand side vector type
  */
 template <class RHS_TYPE>
-auto operator%(const UVector3<units::angular_velocity::radians_per_second_t>& lhs, const UVector3<RHS_TYPE>& rhs)
+constexpr auto operator%(const UVector3<units::angular_velocity::radians_per_second_t>& lhs, const UVector3<RHS_TYPE>& rhs)
 {
     using UnitsSec = typename units::traits::unit_t_traits<units::time::second_t>::unit_type;
     using UnitsRhs = typename units::traits::unit_t_traits<RHS_TYPE>::unit_type;
@@ -270,7 +270,7 @@ auto operator%(const UVector3<units::angular_velocity::radians_per_second_t>& lh
  * \tparam RHS_TYPE right hand side vector type
  */
 template <class RHS_TYPE>
-auto operator%(const UVector3<units::angular_velocity::degrees_per_second_t>& lhs, const UVector3<RHS_TYPE>& rhs)
+constexpr auto operator%(const UVector3<units::angular_velocity::degrees_per_second_t>& lhs, const UVector3<RHS_TYPE>& rhs)
 {
     UVector3<units::angular_velocity::radians_per_second_t> temp(lhs);
     return temp % rhs;
@@ -281,7 +281,7 @@ auto operator%(const UVector3<units::angular_velocity::degrees_per_second_t>& lh
  * \tparam RHS_TYPE right hand side vector type
  */
 template <class RHS_TYPE>
-auto operator%(const UVector3<units::angular_velocity::revolutions_per_minute_t>& lhs, const UVector3<RHS_TYPE>& rhs)
+constexpr auto operator%(const UVector3<units::angular_velocity::revolutions_per_minute_t>& lhs, const UVector3<RHS_TYPE>& rhs)
 {
     UVector3<units::angular_velocity::radians_per_second_t> temp(lhs);
     return temp % rhs;
@@ -292,7 +292,7 @@ auto operator%(const UVector3<units::angular_velocity::revolutions_per_minute_t>
  * \tparam RHS_TYPE right hand side vector type
  */
 template <class RHS_TYPE>
-auto operator%(const UVector3<units::angular_velocity::milliarcseconds_per_year_t>& lhs, const UVector3<RHS_TYPE>& rhs)
+constexpr auto operator%(const UVector3<units::angular_velocity::milliarcseconds_per_year_t>& lhs, const UVector3<RHS_TYPE>& rhs)
 {
     UVector3<units::angular_velocity::radians_per_second_t> temp(lhs);
     return temp % rhs;
@@ -300,7 +300,7 @@ auto operator%(const UVector3<units::angular_velocity::milliarcseconds_per_year_
 
 /** \brief Cross product operator template. */
 template <class LHS_TYPE, class RHS_TYPE>
-auto operator%(const UVector3<LHS_TYPE>& lhs, const UVector3<RHS_TYPE>& rhs)
+constexpr auto operator%(const UVector3<LHS_TYPE>& lhs, const UVector3<RHS_TYPE>& rhs)
 {
     using UnitsLhs = typename units::traits::unit_t_traits<LHS_TYPE>::unit_type;
     using UnitsRhs = typename units::traits::unit_t_traits<RHS_TYPE>::unit_type;
@@ -26,6 +26,7 @@
 
 #include <mcutils/math/VectorN.h>
 #include <mcutils/math/Vector3.h>
+#include <mcutils/math/VectorX.h>
 
 #include <mcutils/math/UVector3.h>
 
@@ -34,6 +35,7 @@ namespace mc {
 using Vector3d = Vector3<double>;
 using Vector4d = VectorN<double, 4>;
 using Vector6d = VectorN<double, 6>;
+using VectorXd = VectorX<double>;
 
 using Vector3_m  = UVector3<units::length::meter_t>;
 using Vector3_ft = UVector3<units::length::foot_t>;
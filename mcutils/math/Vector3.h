@@ -35,12 +35,12 @@ class Vector3 : public VectorN<TYPE, 3>
 {
 public:
 
-    inline static const Vector3<TYPE> i() { return Vector3<TYPE>(TYPE{1}, TYPE{0}, TYPE{0}); }
-    inline static const Vector3<TYPE> j() { return Vector3<TYPE>(TYPE{0}, TYPE{1}, TYPE{0}); }
-    inline static const Vector3<TYPE> k() { return Vector3<TYPE>(TYPE{0}, TYPE{0}, TYPE{1}); }
+    static constexpr Vector3<TYPE> i() { return Vector3<TYPE>(TYPE{1}, TYPE{0}, TYPE{0}); }
+    static constexpr Vector3<TYPE> j() { return Vector3<TYPE>(TYPE{0}, TYPE{1}, TYPE{0}); }
+    static constexpr Vector3<TYPE> k() { return Vector3<TYPE>(TYPE{0}, TYPE{0}, TYPE{1}); }
 
     /** \brief Constructor. */
-    explicit Vector3(TYPE x = TYPE{0}, TYPE y = TYPE{0}, TYPE z = TYPE{0})
+    constexpr explicit Vector3(TYPE x = TYPE{0}, TYPE y = TYPE{0}, TYPE z = TYPE{0})
     {
         Set(x, y, z);
     }
@@ -63,36 +63,36 @@ public:
     }
 
     /** \brief Sets vector values. */
-    void Set(TYPE x, TYPE y, TYPE z)
+    constexpr void Set(TYPE x, TYPE y, TYPE z)
     {
         this->_elements[0] = x;
         this->_elements[1] = y;
         this->_elements[2] = z;
     }
 
-    inline TYPE  x() const { return this->_elements[0]; }
-    inline TYPE  y() const { return this->_elements[1]; }
-    inline TYPE  z() const { return this->_elements[2]; }
-    inline TYPE& x()       { return this->_elements[0]; }
-    inline TYPE& y()       { return this->_elements[1]; }
-    inline TYPE& z()       { return this->_elements[2]; }
-
-    inline TYPE  p() const { return this->_elements[0]; }
-    inline TYPE  q() const { return this->_elements[1]; }
-    inline TYPE  r() const { return this->_elements[2]; }
-    inline TYPE& p()       { return this->_elements[0]; }
-    inline TYPE& q()       { return this->_elements[1]; }
-    inline TYPE& r()       { return this->_elements[2]; }
-
-    inline TYPE  u() const { return this->_elements[0]; }
-    inline TYPE  v() const { return this->_elements[1]; }
-    inline TYPE  w() const { return this->_elements[2]; }
-    inline TYPE& u()       { return this->_elements[0]; }
-    inline TYPE& v()       { return this->_elements[1]; }
-    inline TYPE& w()       { return this->_elements[2]; }
+    constexpr TYPE  x() const { return this->_elements[0]; }
+    constexpr TYPE  y() const { return this->_elements[1]; }
+    constexpr TYPE  z() const { return this->_elements[2]; }
+    constexpr TYPE& x()       { return this->_elements[0]; }
+    constexpr TYPE& y()       { return this->_elements[1]; }
+    constexpr TYPE& z()       { return this->_elements[2]; }
+
+    constexpr TYPE  p() const { return this->_elements[0]; }
+    constexpr TYPE  q() const { return this->_elements[1]; }
+    constexpr TYPE  r() const { return this->_elements[2]; }
+    constexpr TYPE& p()       { return this->_elements[0]; }
+    constexpr TYPE& q()       { return this->_elements[1]; }
+    constexpr TYPE& r()       { return this->_elements[2]; }
+
+    constexpr TYPE  u() const { return this->_elements[0]; }
+    constexpr TYPE  v() const { return this->_elements[1]; }
+    constexpr TYPE  w() const { return this->_elements[2]; }
+    constexpr TYPE& u()       { return this->_elements[0]; }
+    constexpr TYPE& v()       { return this->_elements[1]; }
+    constexpr TYPE& w()       { return this->_elements[2]; }
 
     /** \brief Addition operator. */
-    Vector3<TYPE> operator+(const Vector3<TYPE>& vect) const
+    constexpr Vector3<TYPE> operator+(const Vector3<TYPE>& vect) const
     {
         Vector3<TYPE> result(*this);
         result.Add(vect);
@@ -100,7 +100,7 @@ public:
     }
 
     /** \brief Negation operator. */
-    Vector3<TYPE> operator-() const
+    constexpr Vector3<TYPE> operator-() const
     {
         Vector3<TYPE> result(*this);
         result.Negate();
@@ -108,7 +108,7 @@ public:
     }
 
     /** \brief Subtraction operator. */
-    Vector3<TYPE> operator-(const Vector3<TYPE>& vect) const
+    constexpr Vector3<TYPE> operator-(const Vector3<TYPE>& vect) const
     {
         Vector3<TYPE> result(*this);
         result.Substract(vect);
@@ -116,7 +116,7 @@ public:
     }
 
     /** \brief Multiplication operator (by number). */
-    Vector3<TYPE> operator*(double value) const
+    constexpr Vector3<TYPE> operator*(double value) const
     {
         Vector3<TYPE> result(*this);
         result.MultiplyByValue(value);
@@ -124,7 +124,7 @@ public:
     }
 
     /** \brief Division operator (by number). */
-    Vector3<TYPE> operator/(double value) const
+    constexpr Vector3<TYPE> operator/(double value) const
     {
         Vector3<TYPE> result(*this);
         result.DivideByValue(value);
@@ -132,13 +132,13 @@ public:
     }
 
     /** \brief Dot product operator. */
-    TYPE operator*(const Vector3<TYPE>& vect) const
+    constexpr TYPE operator*(const Vector3<TYPE>& vect) const
     {
         return x()*vect.x() + y()*vect.y() + z()*vect.z();
     }
 
     /** \brief Cross product operator. */
-    Vector3<TYPE> operator%(const Vector3<TYPE>& vect) const
+    constexpr Vector3<TYPE> operator%(const Vector3<TYPE>& vect) const
     {
         Vector3<TYPE> result;
         result.x() = y() * vect.z() - z() * vect.y();
@@ -148,35 +148,35 @@ public:
     }
 
     /** \brief Unary addition operator. */
-    Vector3<TYPE>& operator+=(const Vector3<TYPE>& vect)
+    constexpr Vector3<TYPE>& operator+=(const Vector3<TYPE>& vect)
     {
         this->Add(vect);
         return *this;
     }
 
     /** \brief Unary subtraction operator. */
-    Vector3<TYPE>& operator-=(const Vector3<TYPE>& vect)
+    constexpr Vector3<TYPE>& operator-=(const Vector3<TYPE>& vect)
     {
         this->Substract(vect);
         return *this;
     }
 
     /** \brief Unary multiplication operator (by number). */
-    Vector3<TYPE>& operator*=(double value)
+    constexpr Vector3<TYPE>& operator*=(double value)
     {
         this->MultiplyByValue(value);
         return *this;
     }
 
     /** \brief Unary division operator (by number). */
-    Vector3<TYPE>& operator/=(double value)
+    constexpr Vector3<TYPE>& operator/=(double value)
     {
         this->DivideByValue(value);
         return *this;
     }
 
     /** \brief Unary cross product operator. */
-    Vector3<TYPE>& operator%=(const Vector3<TYPE>& vect)
+    constexpr Vector3<TYPE>& operator%=(const Vector3<TYPE>& vect)
     {
         *this = *this % vect;
         return *this;
@@ -185,7 +185,7 @@ public:
 
 /** \brief Multiplication operator (by number). */
 template <typename TYPE>
-inline Vector3<TYPE> operator*(double value, const Vector3<TYPE>& vect)
+constexpr Vector3<TYPE> operator*(double value, const Vector3<TYPE>& vect)
 {
     return vect * value;
 }
@@ -0,0 +1,358 @@
+/****************************************************************************//*
+ * Copyright (C) 2026 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_VECTOR3BATCH_H_
+#define MCUTILS_MATH_VECTOR3BATCH_H_
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+#include <vector>
+
+#include <mcutils/math/BatchKernels.h>
+#include <mcutils/math/Matrix3x3.h>
+#include <mcutils/math/Vector3.h>
+#include <mcutils/misc/Arena.h>
+#include <mcutils/misc/Check.h>
+
+namespace mc {
+
+/**
+ * \brief Batch of 3 elements vectors in structure-of-arrays layout.
+ *
+ * Stores x, y and z components of all vectors in separate contiguous
+ * arrays, so that operations applied to the whole batch (e.g. particles
+ * or swarm members) are vectorized by BatchKernels, instead of being
+ * computed one Vector3d at a time. Individual vectors are converted
+ * to and from Vector3d with Get() and Set().
+ *
+ * Storage is obtained from the given allocator, e.g. Arena, or from the
+ * heap if no allocator is given, and is padded with zeros to a multiple
+ * of BatchKernels::kLanes. Batch operations do not allocate.
+ */
+class Vector3Batch
+{
+public:
+
+    /**
+     * \brief Constructor, all vectors are set to zero.
+     * \param size number of vectors
+     * \param allocator allocator, if nullptr storage is allocated from the heap
+     */
+    explicit Vector3Batch(unsigned int size = 0, Allocator* allocator = nullptr)
+        : _allocator(allocator)
+        , _size(size)
+        , _padded(BatchKernels::GetPaddedSize(size))
+    {
+        _elements = AllocateArray<double>(_allocator, 3 * _padded);
+    }
+
+    /** \brief Copy constructor, uses allocator of the given batch. */
+    Vector3Batch(const Vector3Batch& batch)
+        : Vector3Batch(batch._size, batch._allocator)
+    {
+        std::copy(batch._elements, batch._elements + 3 * _padded, _elements);
+    }
+
+    /** \brief Move constructor. */
+    Vector3Batch(Vector3Batch&& batch)
+        : _allocator(batch._allocator)
+        , _size(std::exchange(batch._size, 0))
+        , _padded(std::exchange(batch._padded, 0))
+        , _elements(std::exchange(batch._elements, nullptr))
+    {}
+
+    /** \brief Destructor. */
+    ~Vector3Batch()
+    {
+        DeallocateArray(_allocator, _elements, 3 * _padded);
+    }
+
+    /** \return number of vectors */
+    inline unsigned int size() const { return _size; }
+
+    /** \return batch allocator */
+    inline Allocator* GetAllocator() const { return _allocator; }
+
+    /**
+     * \brief Resizes batch, all vectors are set to zero.
+     * Does not allocate if padded size does not change.
+     * \param size new number of vectors
+     */
+    void Resize(unsigned int size)
+    {
+        unsigned int padded = BatchKernels::GetPaddedSize(size);
+        if (padded != _padded)
+        {
+            DeallocateArray(_allocator, _elements, 3 * _padded);
+            _padded = padded;
+            _elements = AllocateArray<double>(_allocator, 3 * _padded);
+        }
+        else
+        {
+            Zeroize();
+        }
+        _size = size;
+    }
+
+    /** \return TRUE if all items are valid */
+    bool IsValid() const
+    {
+        return mc::IsValid(_elements, 3 * _padded);
+    }
+
+    /**
+     * \brief Returns single vector.
+     * \param index vector index
+     * \return vector
+     */
+    inline Vector3d Get(unsigned int index) const
+    {
+        assert(index < _size);
+        return Vector3d(x()[index], y()[index], z()[index]);
+    }
+
+    /**
+     * \brief Sets single vector.
+     * \param index vector index
+     * \param vect vector
+     */
+    inline void Set(unsigned int index, const Vector3d& vect)
+    {
+        assert(index < _size);
+        x()[index] = vect.x();
+        y()[index] = vect.y();
+        z()[index] = vect.z();
+    }
+
+    /**
+     * \brief Gets std::vector of vectors.
+     * \return vector of vectors
+     */
+    std::vector<Vector3d> GetVector() const
+    {
+        std::vector<Vector3d> vects(_size);
+        for (unsigned int i = 0; i < _size; ++i)
+        {
+            vects[i] = Get(i);
+        }
+        return vects;
+    }
+
+    /**
+     * \brief Sets batch from std::vector of vectors, batch is resized if needed.
+     * \param vects vector of vectors
+     */
+    void SetFromVector(const std::vector<Vector3d>& vects)
+    {
+        Resize(static_cast<unsigned int>(vects.size()));
+        for (unsigned int i = 0; i < _size; ++i)
+        {
+            Set(i, vects[i]);
+        }
+    }
+
+    /** \brief Sets all vectors to zero. */
+    void Zeroize()
+    {
+        std::fill(_elements, _elements + 3 * _padded, 0.0);
+    }
+
+    /** \brief Normalizes all vectors, zero vectors remain unchanged. */
+    void Normalize()
+    {
+        BatchKernels::Normalize3(_padded, x(), y(), z());
+    }
+
+    /**
+     * \brief Calculates dot products of the corresponding vectors.
+     * \param batch batch of the same size
+     * \param result result array of size() items
+     */
+    void Dot(const Vector3Batch& batch, double* result) const
+    {
+        assert(batch._size == _size);
+        BatchKernels::Dot3(_size, x(), y(), z(), batch.x(), batch.y(), batch.z(), result);
+    }
+
+    /**
+     * \brief Calculates cross products of the corresponding vectors.
+     * \param batch batch of the same size
+     * \param result result batch of the same size, must not be this batch nor the given batch
+     */
+    void Cross(const Vector3Batch& batch, Vector3Batch* result) const
+    {
+        assert(batch._size == _size && result->_size == _size);
+        assert(result != this && result != &batch);
+        BatchKernels::Cross3(_padded, x(), y(), z(), batch.x(), batch.y(), batch.z(),
+                             result->x(), result->y(), result->z());
+    }
+
+    /**
+     * \brief Multiplies all vectors by the same matrix, e.g. RMatrix.
+     * \param matrix matrix
+     * \param result result batch of the same size, may be this batch
+     */
+    void MultiplyByMatrix(const Matrix3x3<double>& matrix, Vector3Batch* result) const
+    {
+        assert(result->_size == _size);
+
+        const double m[] = { matrix.xx(), matrix.xy(), matrix.xz(),
+                             matrix.yx(), matrix.yy(), matrix.yz(),
+                             matrix.zx(), matrix.zy(), matrix.zz() };
+
+        if (result == this)
+        {
+            BatchKernels::MultiplyByMatrix3(_padded, m, result->x(), result->y(), result->z());
+        }
+        else
+        {
+            BatchKernels::MultiplyByMatrix3(_padded, m, x(), y(), z(),
+                                            result->x(), result->y(), result->z());
+        }
+    }
+
+    /**
+     * \brief Adds scaled vectors of the given batch, e.g. integrates positions.
+     * \param batch batch of the same size
+     * \param value scale factor
+     */
+    void AddScaled(const Vector3Batch& batch, double value)
+    {
+        assert(batch._size == _size);
+        if (&batch == this)
+        {
+            BatchKernels::Scale(3 * _padded, _elements, 1.0 + value);
+        }
+        else
+        {
+            BatchKernels::AddScaled(3 * _padded, _elements, batch._elements, value);
+        }
+    }
+
+    /** \return x components array */
+    inline const double* x() const { return _elements; }
+
+    /** \return y components array */
+    inline const double* y() const { return _elements + _padded; }
+
+    /** \return z components array */
+    inline const double* z() const { return _elements + 2 * _padded; }
+
+    /** \return x components array */
+    inline double* x() { return _elements; }
+
+    /** \return y components array */
+    inline double* y() { return _elements + _padded; }
+
+    /** \return z components array */
+    inline double* z() { return _elements + 2 * _padded; }
+
+    /**
+     * \brief Assignment operator.
+     * Does not allocate if padded sizes are equal, otherwise storage
+     * is reallocated with the allocator of this batch.
+     */
+    Vector3Batch& operator=(const Vector3Batch& batch)
+    {
+        if (this != &batch)
+        {
+            if (batch._padded != _padded)
+            {
+                DeallocateArray(_allocator, _elements, 3 * _padded);
+                _padded = batch._padded;
+                _elements = AllocateArray<double>(_allocator, 3 * _padded);
+            }
+            _size = batch._size;
+            std::copy(batch._elements, batch._elements + 3 * _padded, _elements);
+        }
+        return *this;
+    }
+
+    /** \brief Move assignment operator, takes allocator of the given batch. */
+    Vector3Batch& operator=(Vector3Batch&& batch)
+    {
+        if (this != &batch)
+        {
+            DeallocateArray(_allocator, _elements, 3 * _padded);
+            _allocator = batch._allocator;
+            _size      = std::exchange(batch._size, 0);
+            _padded    = std::exchange(batch._padded, 0);
+            _elements  = std::exchange(batch._elements, nullptr);
+        }
+        return *this;
+    }
+
+    /** \brief Unary addition operator. */
+    Vector3Batch& operator+=(const Vector3Batch& batch)
+    {
+        assert(batch._size == _size);
+        if (&batch == this)
+        {
+            BatchKernels::Scale(3 * _padded, _elements, 2.0);
+        }
+        else
+        {
+            BatchKernels::Add(3 * _padded, _elements, batch._elements);
+        }
+        return *this;
+    }
+
+    /** \brief Unary subtraction operator. */
+    Vector3Batch& operator-=(const Vector3Batch& batch)
+    {
+        assert(batch._size == _size);
+        if (&batch == this)
+        {
+            BatchKernels::Scale(3 * _padded, _elements, 0.0);
+        }
+        else
+        {
+            BatchKernels::Substract(3 * _padded, _elements, batch._elements);
+        }
+        return *this;
+    }
+
+    /** \brief Unary multiplication operator (by number). */
+    Vector3Batch& operator*=(double value)
+    {
+        BatchKernels::Scale(3 * _padded, _elements, value);
+        return *this;
+    }
+
+    /** \brief Unary division operator (by number). */
+    Vector3Batch& operator/=(double value)
+    {
+        BatchKernels::Scale(3 * _padded, _elements, 1.0 / value);
+        return *this;
+    }
+
+protected:
+
+    Allocator* _allocator = nullptr;    ///< allocator
+    unsigned int _size = 0;             ///< number of vectors
+    unsigned int _padded = 0;           ///< number of vectors padded to a multiple of BatchKernels::kLanes
+    double* _elements = nullptr;        ///< x, y and z components arrays, one after another
+};
+
+} // namespace mc
+
+#endif // MCUTILS_MATH_VECTOR3BATCH_H_
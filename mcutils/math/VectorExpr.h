@@ -0,0 +1,245 @@
+/****************************************************************************//*
+ * Copyright (C) 2026 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_VECTOREXPR_H_
+#define MCUTILS_MATH_VECTOREXPR_H_
+
+#include <type_traits>
+
+#include <mcutils/math/VectorN.h>
+
+namespace mc {
+
+/**
+ * \brief Vector expression base class template.
+ *
+ * Vector expressions are built of VectorTerm objects combined with addition,
+ * subtraction and multiplication by number, e.g. (VectorTerm(a) * 2.0
+ * + VectorTerm(b) - VectorTerm(c)). No intermediate vectors are created,
+ * the whole expression is evaluated in a single loop when it is assigned
+ * to a vector. Operators of VectorN and its derived classes are not affected
+ * and still return vectors.
+ *
+ * Expressions refer to the vectors of their terms, which therefore have to
+ * outlive the expression.
+ *
+ * \tparam DERIVED derived expression type
+ */
+template <typename DERIVED>
+class VectorExpr
+{
+public:
+
+    /** \return derived expression */
+    inline const DERIVED& derived() const
+    {
+        return static_cast<const DERIVED&>(*this);
+    }
+
+    /**
+     * \brief Evaluates expression into the given vector.
+     * \param result output vector
+     */
+    template <typename TYPE, unsigned int SIZE>
+    void AssignTo(VectorN<TYPE, SIZE>* result) const
+    {
+        static_assert(SIZE == DERIVED::kSize, "Vector sizes must match");
+
+        for (unsigned int i = 0; i < SIZE; ++i)
+        {
+            (*result)(i) = derived()(i);
+        }
+    }
+
+    /** \return vector of the expression items */
+    auto Evaluate() const
+    {
+        VectorN<typename DERIVED::ValType, DERIVED::kSize> result;
+        AssignTo(&result);
+        return result;
+    }
+
+    /**
+     * \brief Converts expression to vector, see AssignTo().
+     * \tparam VECTOR vector type, VectorN or one of its derived classes
+     */
+    template <typename VECTOR, typename EXPR = DERIVED,
+              typename std::enable_if<std::is_base_of<VectorN<typename EXPR::ValType, EXPR::kSize>, VECTOR>::value, int>::type = 0>
+    operator VECTOR() const
+    {
+        VECTOR result;
+        AssignTo(&result);
+        return result;
+    }
+
+protected:
+
+    VectorExpr() = default;
+};
+
+/**
+ * \brief Vector expression term.
+ * Refers to the vector, which therefore has to outlive the expression.
+ */
+template <typename TYPE, unsigned int SIZE>
+class VectorTerm : public VectorExpr<VectorTerm<TYPE, SIZE>>
+{
+public:
+
+    using ValType = TYPE;
+
+    static constexpr unsigned int kSize = SIZE; ///< vector size
+
+    /**
+     * \brief Constructor.
+     * \param vect vector
+     */
+    explicit VectorTerm(const VectorN<TYPE, SIZE>& vect)
+        : _vect(&vect)
+    {}
+
+    /** \brief Items accessor. */
+    inline TYPE operator()(unsigned int index) const
+    {
+        return (*_vect)(index);
+    }
+
+private:
+
+    const VectorN<TYPE, SIZE>* _vect = nullptr; ///< vector
+};
+
+/**
+ * \brief Vector expression multiplied by number.
+ */
+template <typename EXPR>
+class VectorScaled : public VectorExpr<VectorScaled<EXPR>>
+{
+public:
+
+    using ValType = typename EXPR::ValType;
+
+    static constexpr unsigned int kSize = EXPR::kSize; ///< vector size
+
+    /**
+     * \brief Constructor.
+     * \param expr expression
+     * \param factor factor
+     */
+    VectorScaled(const EXPR& expr, double factor)
+        : _expr(expr)
+        , _factor(factor)
+    {}
+
+    /** \brief Items accessor. */
+    inline ValType operator()(unsigned int index) const
+    {
+        return _expr(index) * _factor;
+    }
+
+private:
+
+    EXPR _expr;         ///< expression
+    double _factor;     ///< factor
+};
+
+/**
+ * \brief Sum of vector expressions.
+ */
+template <typename LHS, typename RHS>
+class VectorSum : public VectorExpr<VectorSum<LHS, RHS>>
+{
+public:
+
+    static_assert(LHS::kSize == RHS::kSize, "Vector sizes must match");
+    static_assert(std::is_same<typename LHS::ValType, typename RHS::ValType>::value, "Value types must match");
+
+    using ValType = typename LHS::ValType;
+
+    static constexpr unsigned int kSize = LHS::kSize; ///< vector size
+
+    /**
+     * \brief Constructor.
+     * \param lhs left hand side operand
+     * \param rhs right hand side operand
+     */
+    VectorSum(const LHS& lhs, const RHS& rhs)
+        : _lhs(lhs)
+        , _rhs(rhs)
+    {}
+
+    /** \brief Items accessor. */
+    inline ValType operator()(unsigned int index) const
+    {
+        return _lhs(index) + _rhs(index);
+    }
+
+private:
+
+    LHS _lhs;   ///< left hand side operand
+    RHS _rhs;   ///< right hand side operand
+};
+
+/** \brief Addition operator. */
+template <typename LHS, typename RHS>
+inline VectorSum<LHS, RHS> operator+(const VectorExpr<LHS>& lhs, const VectorExpr<RHS>& rhs)
+{
+    return VectorSum<LHS, RHS>(lhs.derived(), rhs.derived());
+}
+
+/** \brief Subtraction operator. */
+template <typename LHS, typename RHS>
+inline VectorSum<LHS, VectorScaled<RHS>> operator-(const VectorExpr<LHS>& lhs, const VectorExpr<RHS>& rhs)
+{
+    return VectorSum<LHS, VectorScaled<RHS>>(lhs.derived(), VectorScaled<RHS>(rhs.derived(), -1.0));
+}
+
+/** \brief Negation operator. */
+template <typename EXPR>
+inline VectorScaled<EXPR> operator-(const VectorExpr<EXPR>& expr)
+{
+    return VectorScaled<EXPR>(expr.derived(), -1.0);
+}
+
+/** \brief Multiplication operator (by number). */
+template <typename EXPR>
+inline VectorScaled<EXPR> operator*(const VectorExpr<EXPR>& expr, double val)
+{
+    return VectorScaled<EXPR>(expr.derived(), val);
+}
+
+/** \brief Multiplication operator (by number). */
+template <typename EXPR>
+inline VectorScaled<EXPR> operator*(double val, const VectorExpr<EXPR>& expr)
+{
+    return VectorScaled<EXPR>(expr.derived(), val);
+}
+
+/** \brief Division operator (by number). */
+template <typename EXPR>
+inline VectorScaled<EXPR> operator/(const VectorExpr<EXPR>& expr, double val)
+{
+    return VectorScaled<EXPR>(expr.derived(), 1.0 / val);
+}
+
+} // namespace mc
+
+#endif // MCUTILS_MATH_VECTOREXPR_H_
@@ -24,6 +24,7 @@
 
 #include <limits>
 #include <sstream>
+#include <string_view>
 #include <vector>
 
 #include <mcutils/misc/Check.h>
@@ -54,7 +55,7 @@ public:
     }
 
     /** \return vector length squared */
-    TYPE GetLength2() const
+    constexpr TYPE GetLength2() const
     {
         TYPE length2 = 0.0;
         for (unsigned int i = 0; i < kSize; ++i)
@@ -112,26 +113,21 @@ public:
      */
     void SetFromString(const char* str)
     {
-        std::vector<TYPE> elements(kSize);
-
-        for (unsigned int i = 0; i < kSize; ++i)
-        {
-            _elements[i] = std::numeric_limits<double>::quiet_NaN();
-        }
-
-        std::stringstream ss(String::StripSpaces(str));
+        std::string_view sv(str);
         bool valid = true;
         for (unsigned int i = 0; i < kSize && valid; ++i)
         {
             double temp = std::numeric_limits<double>::quiet_NaN();
-            ss >> temp;
-            valid &= mc::IsValid(temp);
-            elements[i] = TYPE{temp};
+            valid &= String::ParseNumber(&sv, &temp) && mc::IsValid(temp);
+            _elements[i] = TYPE{temp};
         }
 
-        if (valid)
+        if (!valid)
         {
-            SetFromVector(elements);
+            for (unsigned int i = 0; i < kSize; ++i)
+            {
+                _elements[i] = std::numeric_limits<double>::quiet_NaN();
+            }
         }
     }
 
@@ -157,7 +153,7 @@ public:
     }
 
     /** \brief Sets all vector items to zero. */
-    void Zeroize()
+    constexpr void Zeroize()
     {
         for (unsigned int i = 0; i < kSize; ++i)
         {
@@ -171,7 +167,7 @@ public:
      * If you want bound-checked item accessor use getItem(int) or
      * setItem(int,double) functions.
      */
-    inline TYPE operator()(unsigned int index) const
+    constexpr TYPE operator()(unsigned int index) const
     {
         return _elements[index];
     }
@@ -182,13 +178,13 @@ public:
      * If you want bound-checked item accessor use getItem(int) or
      * setItem(int,double) functions.
      */
-    inline TYPE& operator()(unsigned int index)
+    constexpr TYPE& operator()(unsigned int index)
     {
         return _elements[index];
     }
 
     /** \brief Addition operator. */
-    VectorN<TYPE, SIZE> operator+(const VectorN<TYPE, SIZE>& vect) const
+    constexpr VectorN<TYPE, SIZE> operator+(const VectorN<TYPE, SIZE>& vect) const
     {
         VectorN<TYPE, SIZE> result(*this);
         result.Add(vect);
@@ -196,7 +192,7 @@ public:
     }
 
     /** \brief Negation operator. */
-    VectorN<TYPE, SIZE> operator-() const
+    constexpr VectorN<TYPE, SIZE> operator-() const
     {
         VectorN<TYPE, SIZE> result(*this);
         result.Negate();
@@ -204,7 +200,7 @@ public:
     }
 
     /** \brief Subtraction operator. */
-    VectorN<TYPE, SIZE> operator-(const VectorN<TYPE, SIZE>& vect) const
+    constexpr VectorN<TYPE, SIZE> operator-(const VectorN<TYPE, SIZE>& vect) const
     {
         VectorN<TYPE, SIZE> result(*this);
         result.Substract(vect);
@@ -212,7 +208,7 @@ public:
     }
 
     /** \brief Multiplication operator (by number). */
-    VectorN<TYPE, SIZE> operator*(double value) const
+    constexpr VectorN<TYPE, SIZE> operator*(double value) const
     {
         VectorN<TYPE, SIZE> result(*this);
         result.MultiplyByValue(value);
@@ -220,7 +216,7 @@ public:
     }
 
     /** \brief Dot product operator. */
-    double operator*(const VectorN<TYPE, SIZE>& vect) const
+    constexpr double operator*(const VectorN<TYPE, SIZE>& vect) const
     {
         double result = 0.0;
         for (unsigned int i = 0; i < kSize; ++i)
@@ -231,7 +227,7 @@ public:
     }
 
     /** \brief Division operator (by number). */
-    VectorN<TYPE, SIZE> operator/(double val) const
+    constexpr VectorN<TYPE, SIZE> operator/(double val) const
     {
         VectorN<TYPE, SIZE> result(*this);
         result.DivideByValue(val);
@@ -239,35 +235,35 @@ public:
     }
 
     /** \brief Unary addition operator. */
-    VectorN<TYPE, SIZE>& operator+=(const VectorN<TYPE, SIZE>& vect)
+    constexpr VectorN<TYPE, SIZE>& operator+=(const VectorN<TYPE, SIZE>& vect)
     {
         Add(vect);
         return *this;
     }
 
     /** \brief Unary subtraction operator. */
-    VectorN<TYPE, SIZE>& operator-=(const VectorN<TYPE, SIZE>& vect)
+    constexpr VectorN<TYPE, SIZE>& operator-=(const VectorN<TYPE, SIZE>& vect)
     {
         Substract(vect);
         return *this;
     }
 
     /** \brief Unary multiplication operator (by number). */
-    VectorN<TYPE, SIZE>& operator*=(double value)
+    constexpr VectorN<TYPE, SIZE>& operator*=(double value)
     {
         MultiplyByValue(value);
         return *this;
     }
 
     /** \brief Unary division operator (by number). */
-    VectorN<TYPE, SIZE>& operator/=(double value)
+    constexpr VectorN<TYPE, SIZE>& operator/=(double value)
     {
         DivideByValue(value);
         return *this;
     }
 
     /** \brief Equality operator. */
-    bool operator==(const VectorN<TYPE, SIZE>& vect) const
+    constexpr bool operator==(const VectorN<TYPE, SIZE>& vect) const
     {
         bool result = true;
         for (unsigned int i = 0; i < kSize; ++i)
@@ -278,7 +274,7 @@ public:
     }
 
     /** \brief Inequality operator. */
-    bool operator!=(const VectorN<TYPE, SIZE>& vect) const
+    constexpr bool operator!=(const VectorN<TYPE, SIZE>& vect) const
     {
         return !(*this == vect);
     }
@@ -288,7 +284,7 @@ protected:
     TYPE _elements[kSize] = { TYPE{0} };    ///< vector items
 
     /** \brief Adds vector. */
-    void Add(const VectorN<TYPE, SIZE>& vect)
+    constexpr void Add(const VectorN<TYPE, SIZE>& vect)
     {
         for (unsigned int i = 0; i < kSize; ++i)
         {
@@ -297,7 +293,7 @@ protected:
     }
 
     /** \brief Negates (inverts) vector. */
-    void Negate()
+    constexpr void Negate()
     {
         for (unsigned int i = 0; i < kSize; ++i)
         {
@@ -306,7 +302,7 @@ protected:
     }
 
     /** \brief Substracts vector. */
-    void Substract(const VectorN<TYPE, SIZE>& vect)
+    constexpr void Substract(const VectorN<TYPE, SIZE>& vect)
     {
         for (unsigned int i = 0; i < kSize; ++i)
         {
@@ -315,7 +311,7 @@ protected:
     }
 
     /** \brief Multiplies by value. */
-    void MultiplyByValue(double value)
+    constexpr void MultiplyByValue(double value)
     {
         for (unsigned int i = 0; i < kSize; ++i)
         {
@@ -324,7 +320,7 @@ protected:
     }
 
     /** \brief Divides by value. */
-    void DivideByValue(double value)
+    constexpr void DivideByValue(double value)
     {
         double value_inv = 1.0 / value;
         for (unsigned int i = 0; i < kSize; ++i)
@@ -336,7 +332,7 @@ protected:
 
 /** \brief Multiplication operator (by number). */
 template <typename TYPE, unsigned int SIZE>
-inline VectorN<TYPE, SIZE> operator*(double value, const VectorN<TYPE, SIZE>& vect)
+constexpr VectorN<TYPE, SIZE> operator*(double value, const VectorN<TYPE, SIZE>& vect)
 {
     return vect * value;
 }
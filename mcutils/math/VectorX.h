@@ -0,0 +1,445 @@
+/****************************************************************************//*
+ * Copyright (C) 2026 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MATH_VECTORX_H_
+#define MCUTILS_MATH_VECTORX_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <mcutils/misc/Arena.h>
+#include <mcutils/misc/Check.h>
+#include <mcutils/misc/String.h>
+
+namespace mc {
+
+/**
+ * \brief Runtime-sized column vector class template.
+ *
+ * Counterpart of VectorN for systems which size is known only at runtime.
+ * Vector storage is obtained from the given allocator, e.g. Arena, or from
+ * the heap if no allocator is given. Results of the arithmetic operators
+ * are allocated with the allocator of the left hand side operand. Unary
+ * operators and assignment of vectors of the same size do not allocate.
+ *
+ * Operands of the arithmetic operators must be of the same size.
+ *
+ * \tparam TYPE vector item type
+ */
+template <typename TYPE>
+class VectorX
+{
+public:
+
+    /**
+     * \brief Constructor.
+     * \param size vector size
+     * \param allocator allocator, if nullptr storage is allocated from the heap
+     */
+    explicit VectorX(unsigned int size = 0, Allocator* allocator = nullptr)
+        : _allocator(allocator)
+        , _size(size)
+    {
+        _elements = AllocateArray<TYPE>(_allocator, _size);
+    }
+
+    /** \brief Copy constructor, uses allocator of the given vector. */
+    VectorX(const VectorX<TYPE>& vect)
+        : VectorX(vect._size, vect._allocator)
+    {
+        std::copy(vect._elements, vect._elements + _size, _elements);
+    }
+
+    /** \brief Move constructor. */
+    VectorX(VectorX<TYPE>&& vect)
+        : _allocator(vect._allocator)
+        , _size(std::exchange(vect._size, 0))
+        , _elements(std::exchange(vect._elements, nullptr))
+    {}
+
+    /** \brief Destructor. */
+    ~VectorX()
+    {
+        DeallocateArray(_allocator, _elements, _size);
+    }
+
+    /** \return vector size */
+    inline unsigned int size() const { return _size; }
+
+    /** \return vector allocator */
+    inline Allocator* GetAllocator() const { return _allocator; }
+
+    /**
+     * \brief Resizes vector, items are set to zero.
+     * Does not allocate if size does not change.
+     * \param size new vector size
+     */
+    void Resize(unsigned int size)
+    {
+        if (size != _size)
+        {
+            DeallocateArray(_allocator, _elements, _size);
+            _size = size;
+            _elements = AllocateArray<TYPE>(_allocator, _size);
+        }
+        else
+        {
+            Zeroize();
+        }
+    }
+
+    /** \return TRUE if all items are valid */
+    bool IsValid() const
+    {
+        return mc::IsValid(_elements, _size);
+    }
+
+    /** \return vector length squared */
+    TYPE GetLength2() const
+    {
+        TYPE length2 = TYPE{0};
+        for (unsigned int i = 0; i < _size; ++i)
+        {
+            length2 += _elements[i] * _elements[i];
+        }
+        return length2;
+    }
+
+    /** \return vector length */
+    TYPE GetLength() const
+    {
+        return sqrt(GetLength2());
+    }
+
+    /** \brief Normalizes vector. */
+    void Normalize()
+    {
+        double length = GetLength();
+        if (length > 0.0)
+        {
+            double length_inv = 1.0 / length;
+            for (unsigned int i = 0; i < _size; ++i)
+            {
+                _elements[i] *= length_inv;
+            }
+        }
+    }
+
+    /**
+     * \brief Gets std::vector of vector elements.
+     * \return vector of vector elements
+     */
+    std::vector<TYPE> GetVector() const
+    {
+        return std::vector<TYPE>(_elements, _elements + _size);
+    }
+
+    /**
+     * \brief Sets vector elements from std::vector.
+     * \param elements input std::vector of vector elements
+     */
+    void SetFromVector(const std::vector<TYPE>& elements)
+    {
+        assert(elements.size() == _size);
+        std::copy(elements.begin(), elements.end(), _elements);
+    }
+
+    /**
+     * \brief Sets vector items from string.
+     * Values in the given string should be separated with whitespaces.
+     * \param str given string
+     */
+    void SetFromString(const char* str)
+    {
+        std::string_view sv(str);
+        bool valid = true;
+        for (unsigned int i = 0; i < _size && valid; ++i)
+        {
+            double temp = std::numeric_limits<double>::quiet_NaN();
+            valid &= String::ParseNumber(&sv, &temp) && mc::IsValid(temp);
+            _elements[i] = TYPE{temp};
+        }
+
+        if (!valid)
+        {
+            for (unsigned int i = 0; i < _size; ++i)
+            {
+                _elements[i] = TYPE{std::numeric_limits<double>::quiet_NaN()};
+            }
+        }
+    }
+
+    /** \brief Swaps vector rows. */
+    void SwapRows(unsigned int row1, unsigned int row2)
+    {
+        if (row1 < _size && row2 < _size)
+        {
+            std::swap(_elements[row1], _elements[row2]);
+        }
+    }
+
+    /** \brief Returns string representation of the vector. */
+    std::string ToString() const
+    {
+        std::stringstream ss;
+        for (unsigned int i = 0; i < _size; ++i)
+        {
+            if (i != 0) ss << ",";
+            ss << _elements[i];
+        }
+        return ss.str();
+    }
+
+    /** \brief Sets all vector items to zero. */
+    void Zeroize()
+    {
+        for (unsigned int i = 0; i < _size; ++i)
+        {
+            _elements[i] = TYPE{0};
+        }
+    }
+
+    /** \return pointer to the vector items */
+    inline const TYPE* data() const { return _elements; }
+
+    /** \return pointer to the vector items */
+    inline TYPE* data() { return _elements; }
+
+    /**
+     * \brief Items accessor.
+     * Please notice that this operator is NOT bound-checked.
+     */
+    inline TYPE operator()(unsigned int index) const
+    {
+        return _elements[index];
+    }
+
+    /**
+     * \brief Items accessor.
+     * Please notice that this operator is NOT bound-checked.
+     */
+    inline TYPE& operator()(unsigned int index)
+    {
+        return _elements[index];
+    }
+
+    /** \brief Addition operator. */
+    VectorX<TYPE> operator+(const VectorX<TYPE>& vect) const
+    {
+        VectorX<TYPE> result(*this);
+        result.Add(vect);
+        return result;
+    }
+
+    /** \brief Negation operator. */
+    VectorX<TYPE> operator-() const
+    {
+        VectorX<TYPE> result(*this);
+        result.Negate();
+        return result;
+    }
+
+    /** \brief Subtraction operator. */
+    VectorX<TYPE> operator-(const VectorX<TYPE>& vect) const
+    {
+        VectorX<TYPE> result(*this);
+        result.Substract(vect);
+        return result;
+    }
+
+    /** \brief Multiplication operator (by number). */
+    VectorX<TYPE> operator*(double value) const
+    {
+        VectorX<TYPE> result(*this);
+        result.MultiplyByValue(value);
+        return result;
+    }
+
+    /** \brief Dot product operator. */
+    double operator*(const VectorX<TYPE>& vect) const
+    {
+        assert(vect._size == _size);
+        double result = 0.0;
+        for (unsigned int i = 0; i < _size; ++i)
+        {
+            result += _elements[i] * vect._elements[i];
+        }
+        return result;
+    }
+
+    /** \brief Division operator (by number). */
+    VectorX<TYPE> operator/(double value) const
+    {
+        VectorX<TYPE> result(*this);
+        result.DivideByValue(value);
+        return result;
+    }
+
+    /**
+     * \brief Assignment operator.
+     * Does not allocate if vectors are of the same size, otherwise storage
+     * is reallocated with the allocator of this vector.
+     */
+    VectorX<TYPE>& operator=(const VectorX<TYPE>& vect)
+    {
+        if (this != &vect)
+        {
+            if (vect._size != _size)
+            {
+                DeallocateArray(_allocator, _elements, _size);
+                _size = vect._size;
+                _elements = AllocateArray<TYPE>(_allocator, _size);
+            }
+            std::copy(vect._elements, vect._elements + _size, _elements);
+        }
+        return *this;
+    }
+
+    /** \brief Move assignment operator, takes allocator of the given vector. */
+    VectorX<TYPE>& operator=(VectorX<TYPE>&& vect)
+    {
+        if (this != &vect)
+        {
+            DeallocateArray(_allocator, _elements, _size);
+            _allocator = vect._allocator;
+            _size      = std::exchange(vect._size, 0);
+            _elements  = std::exchange(vect._elements, nullptr);
+        }
+        return *this;
+    }
+
+    /** \brief Unary addition operator. */
+    VectorX<TYPE>& operator+=(const VectorX<TYPE>& vect)
+    {
+        Add(vect);
+        return *this;
+    }
+
+    /** \brief Unary subtraction operator. */
+    VectorX<TYPE>& operator-=(const VectorX<TYPE>& vect)
+    {
+        Substract(vect);
+        return *this;
+    }
+
+    /** \brief Unary multiplication operator (by number). */
+    VectorX<TYPE>& operator*=(double value)
+    {
+        MultiplyByValue(value);
+        return *this;
+    }
+
+    /** \brief Unary division operator (by number). */
+    VectorX<TYPE>& operator/=(double value)
+    {
+        DivideByValue(value);
+        return *this;
+    }
+
+    /** \brief Equality operator. */
+    bool operator==(const VectorX<TYPE>& vect) const
+    {
+        bool result = _size == vect._size;
+        for (unsigned int i = 0; i < _size && result; ++i)
+        {
+            result = result && (_elements[i] == vect._elements[i]);
+        }
+        return result;
+    }
+
+    /** \brief Inequality operator. */
+    bool operator!=(const VectorX<TYPE>& vect) const
+    {
+        return !(*this == vect);
+    }
+
+protected:
+
+    Allocator* _allocator = nullptr;    ///< allocator
+    unsigned int _size = 0;             ///< vector size
+    TYPE* _elements = nullptr;          ///< vector items
+
+    /** \brief Adds vector. */
+    void Add(const VectorX<TYPE>& vect)
+    {
+        assert(vect._size == _size);
+        for (unsigned int i = 0; i < _size; ++i)
+        {
+            _elements[i] += vect._elements[i];
+        }
+    }
+
+    /** \brief Negates (inverts) vector. */
+    void Negate()
+    {
+        for (unsigned int i = 0; i < _size; ++i)
+        {
+            _elements[i] = -_elements[i];
+        }
+    }
+
+    /** \brief Substracts vector. */
+    void Substract(const VectorX<TYPE>& vect)
+    {
+        assert(vect._size == _size);
+        for (unsigned int i = 0; i < _size; ++i)
+        {
+            _elements[i] -= vect._elements[i];
+        }
+    }
+
+    /** \brief Multiplies by value. */
+    void MultiplyByValue(double value)
+    {
+        for (unsigned int i = 0; i < _size; ++i)
+        {
+            _elements[i] *= value;
+        }
+    }
+
+    /** \brief Divides by value. */
+    void DivideByValue(double value)
+    {
+        double value_inv = 1.0 / value;
+        for (unsigned int i = 0; i < _size; ++i)
+        {
+            _elements[i] *= value_inv;
+        }
+    }
+};
+
+/** \brief Multiplication operator (by number). */
+template <typename TYPE>
+inline VectorX<TYPE> operator*(double value, const VectorX<TYPE>& vect)
+{
+    return vect * value;
+}
+
+} // namespace mc
+
+#endif // MCUTILS_MATH_VECTORX_H_
@@ -0,0 +1,267 @@
+/****************************************************************************//*
+ * Copyright (C) 2026 Marek M. Cel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom
+ * the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef MCUTILS_MISC_ARENA_H_
+#define MCUTILS_MISC_ARENA_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include <mcutils/misc/PtrUtils.h>
+
+namespace mc {
+
+/**
+ * \brief Memory allocator interface.
+ * Runtime-sized containers (e.g. VectorX, MatrixX) take their storage from
+ * an allocator, so that memory management strategy can be chosen by user.
+ */
+class Allocator
+{
+public:
+
+    virtual ~Allocator() = default;
+
+    /**
+     * \brief Allocates memory.
+     * \param size number of bytes
+     * \param alignment alignment, power of 2
+     * \return pointer to the allocated memory
+     */
+    virtual void* Allocate(size_t size, size_t alignment) = 0;
+
+    /**
+     * \brief Deallocates memory.
+     * \param ptr pointer to the memory previously allocated by this allocator
+     * \param size number of bytes
+     */
+    virtual void Deallocate(void* ptr, size_t size) = 0;
+};
+
+/**
+ * \brief Arena (monotonic) allocator.
+ *
+ * Memory is taken sequentially from blocks obtained from the heap.
+ * Deallocation does nothing, the whole memory is made available again
+ * by Reset(). Reset() also merges blocks into one, so once the arena has
+ * grown to the size needed by a computation step, e.g. a simulation
+ * frame, repeating that step allocates nothing from the heap.
+ *
+ * Arena is not thread-safe.
+ */
+class Arena : public Allocator
+{
+public:
+
+    static constexpr size_t kDefaultBlockSize = 64 * 1024; ///< [B] default block size
+
+    /**
+     * \brief Constructor.
+     * \param block_size [B] initial block size
+     */
+    explicit Arena(size_t block_size = kDefaultBlockSize)
+    {
+        if (block_size > 0)
+        {
+            AddBlock(block_size);
+        }
+    }
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    /** \brief Destructor. */
+    ~Arena() override
+    {
+        ReleaseBlocks();
+    }
+
+    /**
+     * \brief Allocates memory from the current block, adds new block if needed.
+     * \param size number of bytes
+     * \param alignment alignment, power of 2
+     * \return pointer to the allocated memory
+     */
+    void* Allocate(size_t size, size_t alignment) override
+    {
+        void* ptr = _blocks.empty() ? nullptr : AllocateFromBlock(&_blocks.back(), size, alignment);
+
+        if (ptr == nullptr)
+        {
+            size_t block_size = _blocks.empty() ? kDefaultBlockSize : _blocks.back().size;
+            while (block_size < size + alignment) block_size *= 2;
+
+            AddBlock(block_size);
+            ptr = AllocateFromBlock(&_blocks.back(), size, alignment);
+        }
+
+        _used += size;
+
+        return ptr;
+    }
+
+    /** \brief Does nothing, memory is released by Reset(). */
+    void Deallocate(void*, size_t) override {}
+
+    /**
+     * \brief Makes the whole memory available again.
+     * Previously allocated memory must not be used afterwards. If arena
+     * consists of more than one block they are replaced with a single block
+     * of the total capacity.
+     */
+    void Reset()
+    {
+        if (_blocks.size() > 1)
+        {
+            size_t capacity = GetCapacity();
+            ReleaseBlocks();
+            AddBlock(capacity);
+        }
+        else if (_blocks.size() == 1)
+        {
+            _blocks.back().offset = 0;
+        }
+
+        _used = 0;
+    }
+
+    /** \return [B] total size of the arena blocks */
+    size_t GetCapacity() const
+    {
+        size_t capacity = 0;
+        for (const Block& block : _blocks)
+        {
+            capacity += block.size;
+        }
+        return capacity;
+    }
+
+    /** \return [B] number of bytes allocated since the last reset */
+    inline size_t GetUsed() const { return _used; }
+
+private:
+
+    /** \brief Memory block. */
+    struct Block
+    {
+        char* data = nullptr;   ///< block data
+        size_t size = 0;        ///< [B] block size
+        size_t offset = 0;      ///< [B] offset of the first free byte
+    };
+
+    std::vector<Block> _blocks; ///< memory blocks, the last one is the current one
+    size_t _used = 0;           ///< [B] number of bytes allocated since the last reset
+
+    /**
+     * \brief Allocates memory from the given block.
+     * \return pointer to the allocated memory or nullptr if block is too small
+     */
+    static void* AllocateFromBlock(Block* block, size_t size, size_t alignment)
+    {
+        uintptr_t base = reinterpret_cast<uintptr_t>(block->data);
+        uintptr_t addr = (base + block->offset + alignment - 1) & ~(uintptr_t(alignment) - 1);
+        size_t offset = static_cast<size_t>(addr - base);
+
+        if (offset + size > block->size)
+        {
+            return nullptr;
+        }
+
+        block->offset = offset + size;
+        return block->data + offset;
+    }
+
+    /** \brief Adds new block. */
+    void AddBlock(size_t size)
+    {
+        Block block;
+        block.data = new char[size];
+        block.size = size;
+        _blocks.push_back(block);
+    }
+
+    /** \brief Releases all blocks. */
+    void ReleaseBlocks()
+    {
+        for (Block& block : _blocks)
+        {
+            DeletePtrArray(block.data);
+        }
+        _blocks.clear();
+    }
+};
+
+/**
+ * \brief Allocates array of the given number of items.
+ * Items are value initialized.
+ * \param allocator allocator, if nullptr array is allocated with new[]
+ * \param count number of items
+ * \return pointer to the allocated array or nullptr if count is 0
+ */
+template <typename T>
+T* AllocateArray(Allocator* allocator, unsigned int count)
+{
+    static_assert(std::is_trivially_destructible<T>::value, "Item type must be trivially destructible");
+
+    if (count == 0)
+    {
+        return nullptr;
+    }
+
+    if (allocator == nullptr)
+    {
+        return new T[count]();
+    }
+
+    T* ptr = static_cast<T*>(allocator->Allocate(count * sizeof(T), alignof(T)));
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        new (ptr + i) T();
+    }
+    return ptr;
+}
+
+/**
+ * \brief Deallocates array allocated with AllocateArray() and sets it to 'nullptr'.
+ * \param allocator allocator used to allocate the array
+ * \param ptr pointer to the array
+ * \param count number of items
+ */
+template <typename T>
+void DeallocateArray(Allocator* allocator, T*& ptr, unsigned int count)
+{
+    if (allocator == nullptr)
+    {
+        DeletePtrArray(ptr);
+    }
+    else if (ptr)
+    {
+        allocator->Deallocate(ptr, count * sizeof(T));
+        ptr = nullptr;
+    }
+}
+
+} // namespace mc
+
+#endif // MCUTILS_MISC_ARENA_H_
@@ -22,11 +22,14 @@
 #ifndef MCUTILS_MISC_STRING_H_
 #define MCUTILS_MISC_STRING_H_
 
+#include <charconv>
 #include <cstdio>
+#include <cstdlib>
 #include <sstream>
 #include <cstring>
 #include <limits>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <mcutils/misc/Check.h>
@@ -132,6 +135,112 @@ inline std::string StripSpaces(const std::string& str)
     return str.substr(offset_l, offset_t - offset_l + 1);
 }
 
+/**
+ * \brief Checks if character is a white space.
+ * Unlike isspace() this function does not depend on the current locale.
+ * \param c character to be checked
+ * \return true if character is a white space, false otherwise
+ */
+inline bool IsSpace(char c)
+{
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+/**
+ * \brief Returns string view with leading white spaces skipped.
+ * \param str string to be processed
+ * \return string view with leading white spaces skipped
+ */
+inline std::string_view SkipSpaces(std::string_view str)
+{
+    std::string_view::size_type offset = 0;
+    while (offset < str.size() && IsSpace(str[offset]))
+    {
+        ++offset;
+    }
+    return str.substr(offset);
+}
+
+/**
+ * \brief Counts white space separated tokens.
+ * \param str string to be processed
+ * \return number of tokens
+ */
+inline unsigned int CountTokens(std::string_view str)
+{
+    unsigned int result = 0;
+    bool in_token = false;
+    for (char c : str)
+    {
+        bool space = IsSpace(c);
+        if (!space && !in_token) ++result;
+        in_token = !space;
+    }
+    return result;
+}
+
+/**
+ * \brief Parses number at the beginning of the string.
+ * Leading white spaces are skipped. Parsing does not allocate memory and
+ * does not depend on the current locale.
+ * \param str string to be processed, on success advanced past the number
+ * \param value output value, unchanged on failure
+ * \return true on success, false on failure
+ */
+inline bool ParseNumber(std::string_view* str, double* value)
+{
+    std::string_view temp = SkipSpaces(*str);
+
+    // leading plus sign is accepted as by stream extraction
+    std::string_view::size_type offset = 0;
+    if (temp.size() > 1 && temp[0] == '+' && temp[1] != '-' && temp[1] != '+')
+    {
+        offset = 1;
+    }
+
+    const char* first = temp.data() + offset;
+    const char* last  = temp.data() + temp.size();
+
+    if (first == last)
+    {
+        return false;
+    }
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    double result = 0.0;
+    std::from_chars_result fcr = std::from_chars(first, last, result);
+    if (fcr.ec != std::errc())
+    {
+        return false;
+    }
+    const char* end = fcr.ptr;
+#else
+    // floating point std::from_chars not available,
+    // std::strtod requires null terminated string
+    char buffer[128];
+    std::string_view::size_type length = 0;
+    while (first + length < last && length < sizeof(buffer) - 1 && !IsSpace(first[length]))
+    {
+        buffer[length] = first[length];
+        ++length;
+    }
+    buffer[length] = '\0';
+
+    char* buffer_end = nullptr;
+    double result = std::strtod(buffer, &buffer_end);
+    if (buffer_end == buffer)
+    {
+        return false;
+    }
+    const char* end = first + (buffer_end - buffer);
+#endif
+
+    *value = result;
+    *str = temp.substr(static_cast<std::string_view::size_type>(end - temp.data()));
+
+    return true;
+}
+
 /**
  * \brief Converts string into variable.
  * \param str string to be processed
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+
+#include <mcutils/math/BandLU.h>
+#include <mcutils/math/LU.h>
+
+class TestBandLU : public ::testing::Test
+{
+protected:
+    TestBandLU() {}
+    virtual ~TestBandLU() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+namespace {
+
+// band matrix with small values on diagonal, so that pivoting is needed
+template <unsigned int SIZE, unsigned int KL, unsigned int KU>
+void FillBandMatrix(mc::BandMatrix<double, SIZE, KL, KU>* band, mc::MatrixNxN<double, SIZE>* dense)
+{
+    for (unsigned int r = 0; r < SIZE; ++r)
+    {
+        for (unsigned int c = 0; c < SIZE; ++c)
+        {
+            if (band->IsInBand(r, c))
+            {
+                double value = (r == c) ? 0.01 * (r + 1) : std::sin(1.0 + r + 2.0 * c);
+                (*band)(r,c) = value;
+                (*dense)(r,c) = value;
+            }
+        }
+    }
+}
+
+} // namespace
+
+TEST_F(TestBandLU, CanSolve)
+{
+    constexpr unsigned int size = 10;
+
+    mc::BandMatrix<double, size, 2, 1> band;
+    mc::MatrixNxN<double, size> dense;
+    FillBandMatrix(&band, &dense);
+
+    mc::VectorN<double, size> x_ref;
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        x_ref(i) = 1.0 + i;
+    }
+
+    mc::VectorN<double, size> rhs = band * x_ref;
+
+    mc::BandLU<double, size, 2, 1> lu;
+    EXPECT_FALSE(lu.IsValid());
+    EXPECT_EQ(lu.Factorize(band), mc::Result::Success);
+    EXPECT_TRUE(lu.IsValid());
+
+    mc::VectorN<double, size> x;
+    EXPECT_EQ(lu.Solve(rhs, &x), mc::Result::Success);
+
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        EXPECT_NEAR(x(i), x_ref(i), 1.0e-9) << "Error at index " << i;
+    }
+
+    // the same determinant as dense factorization
+    mc::LU<double, size> lu_dense(dense);
+    EXPECT_NEAR(lu.GetDeterminant(), lu_dense.GetDeterminant(), 1.0e-9 * fabs(lu_dense.GetDeterminant()));
+}
+
+TEST_F(TestBandLU, CanSolveInPlace)
+{
+    constexpr unsigned int size = 7;
+
+    mc::BandMatrix<double, size, 1, 3> band;
+    mc::MatrixNxN<double, size> dense;
+    FillBandMatrix(&band, &dense);
+
+    mc::VectorN<double, size> x_ref;
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        x_ref(i) = std::cos(0.5 * i);
+    }
+
+    mc::VectorN<double, size> x = band * x_ref;
+
+    mc::BandLU<double, size, 1, 3> lu(band);
+    EXPECT_EQ(lu.Solve(x, &x), mc::Result::Success);
+
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        EXPECT_NEAR(x(i), x_ref(i), 1.0e-9) << "Error at index " << i;
+    }
+}
+
+TEST_F(TestBandLU, CanDetectSingularMatrix)
+{
+    // second column is zero
+    mc::BandMatrix<double, 4, 1, 1> band;
+    band(0,0) = 1.0;
+    band(2,2) = 1.0;
+    band(2,3) = 1.0;
+    band(3,3) = 1.0;
+
+    mc::BandLU<double, 4, 1, 1> lu;
+    EXPECT_EQ(lu.Factorize(band), mc::Result::Failure);
+    EXPECT_FALSE(lu.IsValid());
+    EXPECT_DOUBLE_EQ(lu.GetDeterminant(), 0.0);
+
+    mc::VectorN<double, 4> rhs;
+    mc::VectorN<double, 4> x;
+    EXPECT_EQ(lu.Solve(rhs, &x), mc::Result::Failure);
+}
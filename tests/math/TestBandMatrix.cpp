@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+#include <mcutils/math/BandMatrix.h>
+
+class TestBandMatrix : public ::testing::Test
+{
+protected:
+    TestBandMatrix() {}
+    virtual ~TestBandMatrix() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(TestBandMatrix, CanInstantiate)
+{
+    const mc::BandMatrix<double, 5, 1, 2> m;
+
+    EXPECT_EQ(m.kWidth, 4u);
+
+    for (unsigned int r = 0; r < 5; ++r)
+    {
+        for (unsigned int c = 0; c < 5; ++c)
+        {
+            EXPECT_DOUBLE_EQ(m(r,c), 0.0);
+        }
+    }
+}
+
+TEST_F(TestBandMatrix, CanCheckIfInBand)
+{
+    using Band = mc::BandMatrix<double, 5, 1, 2>;
+
+    EXPECT_TRUE(Band::IsInBand(0, 0));
+    EXPECT_TRUE(Band::IsInBand(0, 2));
+    EXPECT_FALSE(Band::IsInBand(0, 3));
+    EXPECT_TRUE(Band::IsInBand(1, 0));
+    EXPECT_FALSE(Band::IsInBand(2, 0));
+    EXPECT_TRUE(Band::IsInBand(4, 3));
+    EXPECT_FALSE(Band::IsInBand(4, 5));
+    EXPECT_FALSE(Band::IsInBand(5, 4));
+}
+
+TEST_F(TestBandMatrix, CanAccessItem)
+{
+    mc::BandMatrix<double, 4, 1, 1> m;
+
+    m(0,0) = 1.0;
+    m(0,1) = 2.0;
+    m(1,0) = 3.0;
+    m(3,3) = 4.0;
+
+    const mc::BandMatrix<double, 4, 1, 1>& cm = m;
+    EXPECT_DOUBLE_EQ(cm(0,0), 1.0);
+    EXPECT_DOUBLE_EQ(cm(0,1), 2.0);
+    EXPECT_DOUBLE_EQ(cm(1,0), 3.0);
+    EXPECT_DOUBLE_EQ(cm(3,3), 4.0);
+    EXPECT_DOUBLE_EQ(cm(0,3), 0.0);
+    EXPECT_DOUBLE_EQ(cm(3,0), 0.0);
+}
+
+TEST_F(TestBandMatrix, CanValidate)
+{
+    mc::BandMatrix<double, 4, 1, 1> m;
+    EXPECT_TRUE(m.IsValid());
+    m(2,1) = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_FALSE(m.IsValid());
+    m.Zeroize();
+    EXPECT_TRUE(m.IsValid());
+    EXPECT_DOUBLE_EQ(m(2,1), 0.0);
+}
+
+TEST_F(TestBandMatrix, CanMultiplyByVector)
+{
+    // 1 2 0 0     1     5
+    // 3 4 5 0  *  2  = 26
+    // 0 6 7 8     3    65
+    // 0 0 9 1     4    31
+    mc::BandMatrix<double, 4, 1, 1> m;
+    m(0,0) = 1.0; m(0,1) = 2.0;
+    m(1,0) = 3.0; m(1,1) = 4.0; m(1,2) = 5.0;
+    m(2,1) = 6.0; m(2,2) = 7.0; m(2,3) = 8.0;
+    m(3,2) = 9.0; m(3,3) = 1.0;
+
+    mc::VectorN<double, 4> v;
+    v.SetFromVector({ 1.0, 2.0, 3.0, 4.0 });
+
+    mc::VectorN<double, 4> r = m * v;
+    EXPECT_DOUBLE_EQ(r(0),  5.0);
+    EXPECT_DOUBLE_EQ(r(1), 26.0);
+    EXPECT_DOUBLE_EQ(r(2), 65.0);
+    EXPECT_DOUBLE_EQ(r(3), 31.0);
+}
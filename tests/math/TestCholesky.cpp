@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+
+#include <mcutils/math/Cholesky.h>
+
+class TestCholesky : public ::testing::Test
+{
+protected:
+    TestCholesky() {}
+    virtual ~TestCholesky() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(TestCholesky, CanFactorize)
+{
+    mc::MatrixNxN<double, 3> m;
+    m.SetFromVector({   4.0,  12.0, -16.0,
+                       12.0,  37.0, -43.0,
+                      -16.0, -43.0,  98.0 });
+
+    mc::Cholesky<double, 3> chol;
+    EXPECT_FALSE(chol.IsValid());
+    EXPECT_EQ(chol.Factorize(m), mc::Result::Success);
+    EXPECT_TRUE(chol.IsValid());
+
+    // expected values from
+    // https://en.wikipedia.org/wiki/Cholesky_decomposition#Example
+    const mc::MatrixNxN<double, 3>& l = chol.GetFactor();
+    std::vector<double> l_ref { 2.0, 0.0, 0.0,
+                                6.0, 1.0, 0.0,
+                               -8.0, 5.0, 3.0 };
+    for (unsigned int i = 0; i < 9; ++i)
+    {
+        EXPECT_NEAR(l(i / 3, i % 3), l_ref[i], 1.0e-12) << "Error at index " << i;
+    }
+
+    EXPECT_NEAR(chol.GetDeterminant(), 36.0, 1.0e-9);
+}
+
+TEST_F(TestCholesky, CanSolve)
+{
+    mc::MatrixNxN<double, 3> m;
+    m.SetFromVector({   4.0,  12.0, -16.0,
+                       12.0,  37.0, -43.0,
+                      -16.0, -43.0,  98.0 });
+
+    // x = 1, y = -1, z = 2
+    mc::VectorN<double, 3> rhs;
+    rhs.SetFromVector({ -40.0, -111.0, 223.0 });
+
+    mc::Cholesky<double, 3> chol(m);
+    mc::VectorN<double, 3> x;
+    EXPECT_EQ(chol.Solve(rhs, &x), mc::Result::Success);
+
+    EXPECT_NEAR(x(0),  1.0, 1.0e-9);
+    EXPECT_NEAR(x(1), -1.0, 1.0e-9);
+    EXPECT_NEAR(x(2),  2.0, 1.0e-9);
+
+    // triangular solves
+    mc::VectorN<double, 3> y = rhs;
+    chol.SolveLower(&y);
+    chol.SolveUpper(&y);
+    EXPECT_NEAR(y(0),  1.0, 1.0e-9);
+    EXPECT_NEAR(y(1), -1.0, 1.0e-9);
+    EXPECT_NEAR(y(2),  2.0, 1.0e-9);
+}
+
+TEST_F(TestCholesky, CanSolveMultipleRightHandSides)
+{
+    mc::MatrixNxN<double, 3> m;
+    m.SetFromVector({   4.0,  12.0, -16.0,
+                       12.0,  37.0, -43.0,
+                      -16.0, -43.0,  98.0 });
+
+    mc::MatrixMxN<double, 3, 2> rhs;
+    rhs.SetFromVector({  -40.0,   4.0,
+                        -111.0,  12.0,
+                         223.0, -16.0 });
+
+    mc::Cholesky<double, 3> chol(m);
+    EXPECT_EQ(chol.Solve(rhs, &rhs), mc::Result::Success);
+
+    EXPECT_NEAR(rhs(0,0),  1.0, 1.0e-9);
+    EXPECT_NEAR(rhs(1,0), -1.0, 1.0e-9);
+    EXPECT_NEAR(rhs(2,0),  2.0, 1.0e-9);
+
+    EXPECT_NEAR(rhs(0,1), 1.0, 1.0e-9);
+    EXPECT_NEAR(rhs(1,1), 0.0, 1.0e-9);
+    EXPECT_NEAR(rhs(2,1), 0.0, 1.0e-9);
+}
+
+TEST_F(TestCholesky, CanUpdateAndDowndate)
+{
+    mc::MatrixNxN<double, 3> m;
+    m.SetFromVector({   4.0,  12.0, -16.0,
+                       12.0,  37.0, -43.0,
+                      -16.0, -43.0,  98.0 });
+
+    mc::VectorN<double, 3> v;
+    v.SetFromVector({ 1.0, -2.0, 0.5 });
+
+    mc::MatrixNxN<double, 3> m_upd = m;
+    for (unsigned int r = 0; r < 3; ++r)
+    {
+        for (unsigned int c = 0; c < 3; ++c)
+        {
+            m_upd(r,c) += v(r) * v(c);
+        }
+    }
+
+    mc::Cholesky<double, 3> chol(m);
+    mc::Cholesky<double, 3> chol_ref(m_upd);
+
+    EXPECT_EQ(chol.Update(v), mc::Result::Success);
+    for (unsigned int r = 0; r < 3; ++r)
+    {
+        for (unsigned int c = 0; c < 3; ++c)
+        {
+            EXPECT_NEAR(chol.GetFactor()(r,c), chol_ref.GetFactor()(r,c), 1.0e-9);
+        }
+    }
+
+    EXPECT_EQ(chol.Downdate(v), mc::Result::Success);
+    mc::Cholesky<double, 3> chol_org(m);
+    for (unsigned int r = 0; r < 3; ++r)
+    {
+        for (unsigned int c = 0; c < 3; ++c)
+        {
+            EXPECT_NEAR(chol.GetFactor()(r,c), chol_org.GetFactor()(r,c), 1.0e-9);
+        }
+    }
+
+    // downdate that makes matrix not positive-definite
+    v.SetFromVector({ 3.0, 0.0, 0.0 });
+    EXPECT_EQ(chol.Downdate(v), mc::Result::Failure);
+    EXPECT_FALSE(chol.IsValid());
+}
+
+TEST_F(TestCholesky, CanDetectNotPositiveDefiniteMatrix)
+{
+    mc::MatrixNxN<double, 2> m;
+    m.SetFromVector({ 1.0, 2.0,
+                      2.0, 1.0 });
+
+    mc::Cholesky<double, 2> chol;
+    EXPECT_EQ(chol.Factorize(m), mc::Result::Failure);
+    EXPECT_FALSE(chol.IsValid());
+    EXPECT_DOUBLE_EQ(chol.GetDeterminant(), 0.0);
+
+    mc::VectorN<double, 2> rhs;
+    mc::VectorN<double, 2> x;
+    EXPECT_EQ(chol.Solve(rhs, &x), mc::Result::Failure);
+    EXPECT_EQ(chol.Update(rhs), mc::Result::Failure);
+}
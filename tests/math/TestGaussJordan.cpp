@@ -115,3 +115,35 @@ TEST_F(TestGaussJordan, CanSolveWithZerosAtDiagonal)
     EXPECT_NEAR(x(1), 1.0, 1.0e-9);
     EXPECT_NEAR(x(2), 2.0, 1.0e-9);
 }
+
+TEST_F(TestGaussJordan, CanSolveRuntimeSized)
+{
+    // x = 1
+    // y = 1
+    // z = 2
+    // 2x + 2y + z = 6
+    //  x +  y + z = 4
+    // 2x +  y + z = 5
+
+    mc::MatrixXd m(3, 3);
+    m.SetFromVector({ 2.0, 2.0, 1.0,
+                      1.0, 1.0, 1.0,
+                      2.0, 1.0, 1.0 });
+
+    mc::VectorXd rhs(3);
+    rhs.SetFromVector({ 6.0, 4.0, 5.0 });
+
+    mc::VectorXd x(3);
+    EXPECT_EQ(mc::SolveGaussJordan(m, rhs, &x), mc::Result::Success);
+
+    EXPECT_NEAR(x(0), 1.0, 1.0e-9);
+    EXPECT_NEAR(x(1), 1.0, 1.0e-9);
+    EXPECT_NEAR(x(2), 2.0, 1.0e-9);
+
+    mc::MatrixXd singular = mc::MatrixXd::GetIdentityMatrix(3);
+    singular(2,2) = 0.0;
+    EXPECT_EQ(mc::SolveGaussJordan(singular, rhs, &x), mc::Result::Failure);
+
+    mc::MatrixXd not_square(3, 2);
+    EXPECT_EQ(mc::SolveGaussJordan(not_square, rhs, &x), mc::Result::Failure);
+}
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include <mcutils/math/IterativeSolvers.h>
+
+class TestIterativeSolvers : public ::testing::Test
+{
+protected:
+    TestIterativeSolvers() {}
+    virtual ~TestIterativeSolvers() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+namespace {
+
+// thermal network like matrix, 2D grid Laplacian plus capacitance on diagonal
+template <unsigned int NX, unsigned int NY>
+void FillGridMatrix(mc::SparseMatrix<double, NX*NY, NX*NY>* m, double asymmetry)
+{
+    using Triplet = typename mc::SparseMatrix<double, NX*NY, NX*NY>::Triplet;
+    std::vector<Triplet> triplets;
+
+    for (unsigned int j = 0; j < NY; ++j)
+    {
+        for (unsigned int i = 0; i < NX; ++i)
+        {
+            unsigned int n = j * NX + i;
+            triplets.push_back({ n, n, 4.5 });
+            if (i > 0)      triplets.push_back({ n, n - 1,  -1.0 - asymmetry });
+            if (i < NX - 1) triplets.push_back({ n, n + 1,  -1.0 + asymmetry });
+            if (j > 0)      triplets.push_back({ n, n - NX, -1.0 });
+            if (j < NY - 1) triplets.push_back({ n, n + NX, -1.0 });
+        }
+    }
+
+    m->SetFromTriplets(triplets);
+}
+
+} // namespace
+
+TEST_F(TestIterativeSolvers, CanSolveConjugateGradient)
+{
+    constexpr unsigned int size = 10 * 12;
+
+    mc::SparseMatrix<double, size, size> m;
+    FillGridMatrix<10,12>(&m, 0.0);
+
+    mc::VectorN<double, size> x_ref;
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        x_ref(i) = std::sin(0.1 * i);
+    }
+
+    mc::VectorN<double, size> rhs = m * x_ref;
+    mc::VectorN<double, size> x;
+    EXPECT_EQ(mc::SolveConjugateGradient(m, rhs, &x, 1.0e-12), mc::Result::Success);
+
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        EXPECT_NEAR(x(i), x_ref(i), 1.0e-9) << "Error at index " << i;
+    }
+
+    // solution as initial guess
+    EXPECT_EQ(mc::SolveConjugateGradient(m, rhs, &x, 1.0e-12, 0), mc::Result::Success);
+}
+
+TEST_F(TestIterativeSolvers, CanSolveBiCGSTAB)
+{
+    constexpr unsigned int size = 10 * 12;
+
+    mc::SparseMatrix<double, size, size> m;
+    FillGridMatrix<10,12>(&m, 0.3);
+
+    mc::VectorN<double, size> x_ref;
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        x_ref(i) = std::sin(0.1 * i);
+    }
+
+    mc::VectorN<double, size> rhs = m * x_ref;
+    mc::VectorN<double, size> x;
+    EXPECT_EQ(mc::SolveBiCGSTAB(m, rhs, &x, 1.0e-12), mc::Result::Success);
+
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        EXPECT_NEAR(x(i), x_ref(i), 1.0e-9) << "Error at index " << i;
+    }
+}
+
+TEST_F(TestIterativeSolvers, CanDetectFailure)
+{
+    // zero on diagonal
+    mc::SparseMatrix<double, 2, 2> m;
+    m.SetFromTriplets({ { 0, 1, 1.0 }, { 1, 0, 1.0 } });
+
+    mc::VectorN<double, 2> rhs;
+    rhs.SetFromVector({ 1.0, 2.0 });
+
+    mc::VectorN<double, 2> x;
+    EXPECT_EQ(mc::SolveConjugateGradient(m, rhs, &x), mc::Result::Failure);
+    EXPECT_EQ(mc::SolveBiCGSTAB(m, rhs, &x), mc::Result::Failure);
+
+    // not converged within given number of iterations
+    constexpr unsigned int size = 10 * 12;
+    mc::SparseMatrix<double, size, size> m2;
+    FillGridMatrix<10,12>(&m2, 0.0);
+
+    mc::VectorN<double, size> rhs2;
+    rhs2(0) = 1.0;
+    mc::VectorN<double, size> x2;
+    EXPECT_EQ(mc::SolveConjugateGradient(m2, rhs2, &x2, 1.0e-12, 2), mc::Result::Failure);
+}
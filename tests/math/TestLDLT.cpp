@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+
+#include <mcutils/math/LDLT.h>
+
+class TestLDLT : public ::testing::Test
+{
+protected:
+    TestLDLT() {}
+    virtual ~TestLDLT() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(TestLDLT, CanFactorize)
+{
+    mc::MatrixNxN<double, 3> m;
+    m.SetFromVector({   4.0,  12.0, -16.0,
+                       12.0,  37.0, -43.0,
+                      -16.0, -43.0,  98.0 });
+
+    mc::LDLT<double, 3> ldlt;
+    EXPECT_FALSE(ldlt.IsValid());
+    EXPECT_EQ(ldlt.Factorize(m), mc::Result::Success);
+    EXPECT_TRUE(ldlt.IsValid());
+
+    // expected values from
+    // https://en.wikipedia.org/wiki/Cholesky_decomposition#Example
+    const mc::MatrixNxN<double, 3>& ld = ldlt.GetFactors();
+    std::vector<double> ld_ref { 4.0, 0.0, 0.0,
+                                 3.0, 1.0, 0.0,
+                                -4.0, 5.0, 9.0 };
+    for (unsigned int i = 0; i < 9; ++i)
+    {
+        EXPECT_NEAR(ld(i / 3, i % 3), ld_ref[i], 1.0e-12) << "Error at index " << i;
+    }
+
+    EXPECT_NEAR(ldlt.GetDeterminant(), 36.0, 1.0e-9);
+}
+
+TEST_F(TestLDLT, CanSolve)
+{
+    mc::MatrixNxN<double, 3> m;
+    m.SetFromVector({   4.0,  12.0, -16.0,
+                       12.0,  37.0, -43.0,
+                      -16.0, -43.0,  98.0 });
+
+    // x = 1, y = -1, z = 2
+    mc::VectorN<double, 3> rhs;
+    rhs.SetFromVector({ -40.0, -111.0, 223.0 });
+
+    mc::LDLT<double, 3> ldlt(m);
+    mc::VectorN<double, 3> x;
+    EXPECT_EQ(ldlt.Solve(rhs, &x), mc::Result::Success);
+
+    EXPECT_NEAR(x(0),  1.0, 1.0e-9);
+    EXPECT_NEAR(x(1), -1.0, 1.0e-9);
+    EXPECT_NEAR(x(2),  2.0, 1.0e-9);
+}
+
+TEST_F(TestLDLT, CanSolveIndefinite)
+{
+    // symmetric, not positive-definite
+    // x = 1, y = 2
+    mc::MatrixNxN<double, 2> m;
+    m.SetFromVector({ 1.0, 2.0,
+                      2.0, 1.0 });
+
+    mc::VectorN<double, 2> rhs;
+    rhs.SetFromVector({ 5.0, 4.0 });
+
+    mc::LDLT<double, 2> ldlt(m);
+    EXPECT_TRUE(ldlt.IsValid());
+    EXPECT_NEAR(ldlt.GetDeterminant(), -3.0, 1.0e-12);
+
+    mc::VectorN<double, 2> x;
+    EXPECT_EQ(ldlt.Solve(rhs, &x), mc::Result::Success);
+    EXPECT_NEAR(x(0), 1.0, 1.0e-9);
+    EXPECT_NEAR(x(1), 2.0, 1.0e-9);
+}
+
+TEST_F(TestLDLT, CanSolveMultipleRightHandSides)
+{
+    mc::MatrixNxN<double, 3> m;
+    m.SetFromVector({   4.0,  12.0, -16.0,
+                       12.0,  37.0, -43.0,
+                      -16.0, -43.0,  98.0 });
+
+    mc::MatrixMxN<double, 3, 2> rhs;
+    rhs.SetFromVector({  -40.0,   4.0,
+                        -111.0,  12.0,
+                         223.0, -16.0 });
+
+    mc::LDLT<double, 3> ldlt(m);
+    mc::MatrixMxN<double, 3, 2> x;
+    EXPECT_EQ(ldlt.Solve(rhs, &x), mc::Result::Success);
+
+    EXPECT_NEAR(x(0,0),  1.0, 1.0e-9);
+    EXPECT_NEAR(x(1,0), -1.0, 1.0e-9);
+    EXPECT_NEAR(x(2,0),  2.0, 1.0e-9);
+
+    EXPECT_NEAR(x(0,1), 1.0, 1.0e-9);
+    EXPECT_NEAR(x(1,1), 0.0, 1.0e-9);
+    EXPECT_NEAR(x(2,1), 0.0, 1.0e-9);
+}
+
+TEST_F(TestLDLT, CanUpdateAndDowndate)
+{
+    mc::MatrixNxN<double, 3> m;
+    m.SetFromVector({   4.0,  12.0, -16.0,
+                       12.0,  37.0, -43.0,
+                      -16.0, -43.0,  98.0 });
+
+    mc::VectorN<double, 3> v;
+    v.SetFromVector({ 1.0, -2.0, 0.5 });
+
+    mc::MatrixNxN<double, 3> m_upd = m;
+    for (unsigned int r = 0; r < 3; ++r)
+    {
+        for (unsigned int c = 0; c < 3; ++c)
+        {
+            m_upd(r,c) += v(r) * v(c);
+        }
+    }
+
+    mc::LDLT<double, 3> ldlt(m);
+    mc::LDLT<double, 3> ldlt_ref(m_upd);
+
+    EXPECT_EQ(ldlt.Update(v), mc::Result::Success);
+    for (unsigned int r = 0; r < 3; ++r)
+    {
+        for (unsigned int c = 0; c < 3; ++c)
+        {
+            EXPECT_NEAR(ldlt.GetFactors()(r,c), ldlt_ref.GetFactors()(r,c), 1.0e-9);
+        }
+    }
+
+    EXPECT_EQ(ldlt.Downdate(v), mc::Result::Success);
+    mc::LDLT<double, 3> ldlt_org(m);
+    for (unsigned int r = 0; r < 3; ++r)
+    {
+        for (unsigned int c = 0; c < 3; ++c)
+        {
+            EXPECT_NEAR(ldlt.GetFactors()(r,c), ldlt_org.GetFactors()(r,c), 1.0e-9);
+        }
+    }
+
+    // downdate that makes matrix singular
+    v.SetFromVector({ 2.0, 0.0, 0.0 });
+    EXPECT_EQ(ldlt.Downdate(v), mc::Result::Failure);
+    EXPECT_FALSE(ldlt.IsValid());
+}
+
+TEST_F(TestLDLT, CanDetectSingularMatrix)
+{
+    mc::MatrixNxN<double, 2> m;
+    m.SetFromVector({ 1.0, 2.0,
+                      2.0, 4.0 });
+
+    mc::LDLT<double, 2> ldlt;
+    EXPECT_EQ(ldlt.Factorize(m), mc::Result::Failure);
+    EXPECT_FALSE(ldlt.IsValid());
+    EXPECT_DOUBLE_EQ(ldlt.GetDeterminant(), 0.0);
+
+    mc::VectorN<double, 2> rhs;
+    mc::VectorN<double, 2> x;
+    EXPECT_EQ(ldlt.Solve(rhs, &x), mc::Result::Failure);
+}
@@ -0,0 +1,200 @@
+#include <gtest/gtest.h>
+
+#include <mcutils/math/GaussJordan.h>
+#include <mcutils/math/LU.h>
+
+class TestLU : public ::testing::Test
+{
+protected:
+    TestLU() {}
+    virtual ~TestLU() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(TestLU, CanFactorize)
+{
+    mc::MatrixNxN<double, 3> m;
+    m.SetFromVector({ 1.0, 1.0, 1.0,
+                      2.0, 1.0, 1.0,
+                      2.0, 2.0, 1.0 });
+
+    mc::LU<double, 3> lu;
+    EXPECT_FALSE(lu.IsValid());
+    EXPECT_EQ(lu.Factorize(m), mc::Result::Success);
+    EXPECT_TRUE(lu.IsValid());
+
+    // P*A = L*U
+    const mc::MatrixNxN<double, 3>& f = lu.GetFactors();
+    for (unsigned int r = 0; r < 3; ++r)
+    {
+        for (unsigned int c = 0; c < 3; ++c)
+        {
+            double sum = 0.0;
+            for (unsigned int k = 0; k < 3; ++k)
+            {
+                double l_rk = k < r ? f(r,k) : (k == r ? 1.0 : 0.0);
+                double u_kc = k <= c ? f(k,c) : 0.0;
+                sum += l_rk * u_kc;
+            }
+            EXPECT_NEAR(sum, m(lu.GetPermutation(r),c), 1.0e-12);
+        }
+    }
+
+    // multipliers does not exceed 1 due to pivoting
+    EXPECT_LE(fabs(f(1,0)), 1.0);
+    EXPECT_LE(fabs(f(2,0)), 1.0);
+    EXPECT_LE(fabs(f(2,1)), 1.0);
+}
+
+TEST_F(TestLU, CanSolve)
+{
+    // x = 1
+    // y = 1
+    // z = 2
+    //  x +  y + z = 4
+    // 2x +  y + z = 5
+    // 2x + 2y + z = 6
+
+    mc::MatrixNxN<double, 3> m;
+    m.SetFromVector({ 1.0, 1.0, 1.0,
+                      2.0, 1.0, 1.0,
+                      2.0, 2.0, 1.0 });
+
+    mc::VectorN<double, 3> rhs;
+    rhs.SetFromVector({ 4.0, 5.0, 6.0 });
+
+    mc::LU<double, 3> lu(m);
+    mc::VectorN<double, 3> x;
+    EXPECT_EQ(lu.Solve(rhs, &x), mc::Result::Success);
+
+    EXPECT_NEAR(x(0), 1.0, 1.0e-9);
+    EXPECT_NEAR(x(1), 1.0, 1.0e-9);
+    EXPECT_NEAR(x(2), 2.0, 1.0e-9);
+
+    // factors are reused for another right hand side
+    // x = 3
+    // y = -1
+    // z = 0
+    rhs.SetFromVector({ 2.0, 5.0, 4.0 });
+    EXPECT_EQ(lu.Solve(rhs, &rhs), mc::Result::Success);
+
+    EXPECT_NEAR(rhs(0),  3.0, 1.0e-9);
+    EXPECT_NEAR(rhs(1), -1.0, 1.0e-9);
+    EXPECT_NEAR(rhs(2),  0.0, 1.0e-9);
+}
+
+TEST_F(TestLU, CanSolveWithZerosAtDiagonal)
+{
+    mc::MatrixNxN<double, 4> m;
+    m.SetFromVector({ 0.0, 2.0, 1.0, 3.0,
+                      1.0, 0.0, 2.0, 1.0,
+                      4.0, 1.0, 0.0, 2.0,
+                      2.0, 3.0, 1.0, 0.0 });
+
+    mc::VectorN<double, 4> x_ref;
+    x_ref.SetFromVector({ 1.0, -2.0, 3.0, 0.5 });
+
+    const mc::MatrixMxN<double, 4, 4>& mb = m;
+    mc::VectorN<double, 4> rhs = mb * x_ref;
+
+    mc::VectorN<double, 4> x_gj;
+    EXPECT_EQ(mc::SolveGaussJordan(m, rhs, &x_gj), mc::Result::Success);
+
+    mc::LU<double, 4> lu(m);
+    mc::VectorN<double, 4> x;
+    EXPECT_EQ(lu.Solve(rhs, &x), mc::Result::Success);
+
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        EXPECT_NEAR(x(i), x_ref(i), 1.0e-9) << "Error at index " << i;
+        EXPECT_NEAR(x(i), x_gj(i), 1.0e-9) << "Error at index " << i;
+    }
+}
+
+TEST_F(TestLU, CanSolveMultipleRightHandSides)
+{
+    mc::MatrixNxN<double, 3> m;
+    m.SetFromVector({ 1.0, 1.0, 1.0,
+                      2.0, 1.0, 1.0,
+                      2.0, 2.0, 1.0 });
+
+    mc::MatrixMxN<double, 3, 2> rhs;
+    rhs.SetFromVector({ 4.0, 2.0,
+                        5.0, 5.0,
+                        6.0, 4.0 });
+
+    mc::LU<double, 3> lu(m);
+    mc::MatrixMxN<double, 3, 2> x;
+    EXPECT_EQ(lu.Solve(rhs, &x), mc::Result::Success);
+
+    EXPECT_NEAR(x(0,0), 1.0, 1.0e-9);
+    EXPECT_NEAR(x(1,0), 1.0, 1.0e-9);
+    EXPECT_NEAR(x(2,0), 2.0, 1.0e-9);
+
+    EXPECT_NEAR(x(0,1),  3.0, 1.0e-9);
+    EXPECT_NEAR(x(1,1), -1.0, 1.0e-9);
+    EXPECT_NEAR(x(2,1),  0.0, 1.0e-9);
+}
+
+TEST_F(TestLU, CanGetDeterminant)
+{
+    mc::MatrixNxN<double, 3> m;
+    m.SetFromVector({ 2.0, 2.0, 1.0,
+                      2.0, 1.0, 1.0,
+                      1.0, 1.0, 1.0 });
+
+    // 2*(1-1) - 2*(2-1) + 1*(2-1) = -1
+    mc::LU<double, 3> lu(m);
+    EXPECT_NEAR(lu.GetDeterminant(), -1.0, 1.0e-12);
+
+    mc::MatrixNxN<double, 3> m2;
+    m2.SetFromVector({ 4.0, 0.0, 0.0,
+                       0.0, 0.0, 3.0,
+                       0.0, 2.0, 0.0 });
+
+    // rows swap changes sign
+    mc::LU<double, 3> lu2(m2);
+    EXPECT_NEAR(lu2.GetDeterminant(), -24.0, 1.0e-12);
+}
+
+TEST_F(TestLU, CanGetInverse)
+{
+    mc::MatrixNxN<double, 3> m;
+    m.SetFromVector({ 2.0, 2.0, 1.0,
+                      2.0, 1.0, 1.0,
+                      1.0, 1.0, 1.0 });
+
+    mc::LU<double, 3> lu(m);
+    mc::MatrixNxN<double, 3> inv;
+    EXPECT_EQ(lu.GetInverse(&inv), mc::Result::Success);
+
+    mc::MatrixNxN<double, 3> i3 = m * inv;
+    for (unsigned int r = 0; r < 3; ++r)
+    {
+        for (unsigned int c = 0; c < 3; ++c)
+        {
+            EXPECT_NEAR(i3(r,c), r == c ? 1.0 : 0.0, 1.0e-12);
+        }
+    }
+}
+
+TEST_F(TestLU, CanDetectSingularMatrix)
+{
+    mc::MatrixNxN<double, 3> m;
+    m.SetFromVector({ 1.0, 2.0, 3.0,
+                      2.0, 4.0, 6.0,
+                      1.0, 1.0, 1.0 });
+
+    mc::LU<double, 3> lu;
+    EXPECT_EQ(lu.Factorize(m), mc::Result::Failure);
+    EXPECT_FALSE(lu.IsValid());
+    EXPECT_DOUBLE_EQ(lu.GetDeterminant(), 0.0);
+
+    mc::VectorN<double, 3> rhs;
+    mc::VectorN<double, 3> x;
+    EXPECT_EQ(lu.Solve(rhs, &x), mc::Result::Failure);
+
+    mc::MatrixNxN<double, 3> inv;
+    EXPECT_EQ(lu.GetInverse(&inv), mc::Result::Failure);
+}
@@ -542,3 +542,30 @@ TEST_F(TestMatrix3x3, CanUnaryDivideByNumber)
     EXPECT_DOUBLE_EQ(m1.zy(), 4.0);
     EXPECT_DOUBLE_EQ(m1.zz(), 4.5);
 }
+
+TEST_F(TestMatrix3x3, CanUseInConstantExpressions)
+{
+    constexpr mc::Matrix3x3d m1(1.0, 2.0, 3.0,
+                                4.0, 5.0, 6.0,
+                                7.0, 8.0, 9.0);
+    constexpr mc::Matrix3x3d m2 = m1 * m1.GetTransposed() - mc::Matrix3x3d::GetIdentityMatrix() * 2.0;
+    constexpr mc::Vector3d v = m1 * mc::Vector3d(1.0, 0.0, -1.0);
+
+    static_assert(m2.xx() ==  12.0, "Matrix product");
+    static_assert(m2.xy() ==  32.0, "Matrix product");
+    static_assert(m2.zy() == 122.0, "Matrix product");
+    static_assert(m2.zz() == 192.0, "Matrix product");
+    static_assert(v.x() == -2.0 && v.y() == -2.0 && v.z() == -2.0, "Vector product");
+
+    // constexpr product matches the one of MatrixNxN
+    const mc::MatrixNxN<double, 3>& m1_nxn = m1;
+    mc::MatrixNxN<double, 3> m1_nxn_t = m1_nxn.GetTransposed();
+    mc::MatrixNxN<double, 3> m3 = m1_nxn * m1_nxn_t;
+    for (unsigned int r = 0; r < 3; ++r)
+    {
+        for (unsigned int c = 0; c < 3; ++c)
+        {
+            EXPECT_DOUBLE_EQ(m2(r,c), m3(r,c) - (r == c ? 2.0 : 0.0)) << r << " " << c;
+        }
+    }
+}
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include <mcutils/math/Matrix.h>
+#include <mcutils/math/MatrixExpr.h>
+#include <mcutils/math/Vector.h>
+
+using namespace units::literals;
+
+class TestMatrixExpr : public ::testing::Test
+{
+protected:
+    TestMatrixExpr() {}
+    virtual ~TestMatrixExpr() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(TestMatrixExpr, CanEvaluate)
+{
+    mc::Matrix4x4d m1;
+    mc::Matrix4x4d m2;
+    for (unsigned int r = 0; r < 4; ++r)
+    {
+        for (unsigned int c = 0; c < 4; ++c)
+        {
+            m1(r, c) = 1.0 + r * 4 + c;
+            m2(r, c) = 0.5 * r - c;
+        }
+    }
+
+    mc::Matrix4x4d ref = m1 * 2.0 - m2 / 4.0 + (-m1);
+    mc::Matrix4x4d m = mc::MatrixTerm(m1) * 2.0 - mc::MatrixTerm(m2) / 4.0 + (-mc::MatrixTerm(m1));
+
+    for (unsigned int r = 0; r < 4; ++r)
+    {
+        for (unsigned int c = 0; c < 4; ++c)
+        {
+            EXPECT_DOUBLE_EQ(m(r, c), ref(r, c)) << r << " " << c;
+        }
+    }
+
+    auto m_eval = (mc::MatrixTerm(m1) + mc::MatrixTerm(m2)).Evaluate();
+    for (unsigned int r = 0; r < 4; ++r)
+    {
+        for (unsigned int c = 0; c < 4; ++c)
+        {
+            EXPECT_DOUBLE_EQ(m_eval(r, c), m1(r, c) + m2(r, c)) << r << " " << c;
+        }
+    }
+}
+
+TEST_F(TestMatrixExpr, CanMultiplyByVector)
+{
+    mc::MatrixMxN<double, 2, 3> a;
+    a.SetFromVector({ 1.0, 2.0, 3.0,
+                      4.0, 5.0, 6.0 });
+    mc::MatrixMxN<double, 2, 2> b;
+    b.SetFromVector({ 0.0, 1.0,
+                     -1.0, 0.0 });
+
+    mc::VectorN<double, 3> x;
+    x.SetFromVector({ 1.0, -1.0, 2.0 });
+    mc::VectorN<double, 2> u;
+    u.SetFromVector({ 3.0, 4.0 });
+    mc::VectorN<double, 2> c;
+    c.SetFromVector({ 1.0, 1.0 });
+
+    mc::VectorN<double, 2> ref = a * x + b * u - c * 2.0;
+    mc::VectorN<double, 2> v = mc::MatrixTerm(a) * mc::VectorTerm(x)
+                             + mc::MatrixTerm(b) * mc::VectorTerm(u)
+                             - mc::VectorTerm(c) * 2.0;
+
+    EXPECT_DOUBLE_EQ(v(0), ref(0));
+    EXPECT_DOUBLE_EQ(v(1), ref(1));
+    EXPECT_DOUBLE_EQ(v(0), 1.0 - 2.0 + 6.0 + 4.0 - 2.0);
+    EXPECT_DOUBLE_EQ(v(1), 4.0 - 5.0 + 12.0 - 3.0 - 2.0);
+
+    // assigning to the vector operand
+    u = mc::MatrixTerm(b) * mc::VectorTerm(u);
+    EXPECT_DOUBLE_EQ(u(0),  4.0);
+    EXPECT_DOUBLE_EQ(u(1), -3.0);
+
+    // vector expression operand
+    mc::VectorN<double, 2> w = (mc::MatrixTerm(b) * 2.0) * (mc::VectorTerm(u) + mc::VectorTerm(c));
+    EXPECT_DOUBLE_EQ(w(0), -4.0);
+    EXPECT_DOUBLE_EQ(w(1), -10.0);
+}
+
+TEST_F(TestMatrixExpr, CanMultiplyByUVector3)
+{
+    mc::Matrix3x3d m(0.0, -1.0, 0.0,
+                     1.0,  0.0, 0.0,
+                     0.0,  0.0, 2.0);
+
+    mc::Vector3_m v1(1.0_m, 2.0_m, 3.0_m);
+    mc::Vector3_m v2(1.0_m, 1.0_m, 1.0_m);
+
+    mc::Vector3_m v = mc::MatrixTerm(m) * mc::VectorTerm(v1) + mc::VectorTerm(v2);
+
+    EXPECT_DOUBLE_EQ(v.x()(), -1.0);
+    EXPECT_DOUBLE_EQ(v.y()(),  2.0);
+    EXPECT_DOUBLE_EQ(v.z()(),  7.0);
+}
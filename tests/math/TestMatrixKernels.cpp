@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include <mcutils/math/Matrix.h>
+#include <mcutils/math/MatrixKernels.h>
+
+class TestMatrixKernels : public ::testing::Test
+{
+protected:
+    TestMatrixKernels() {}
+    virtual ~TestMatrixKernels() {}
+    void SetUp() override {}
+    void TearDown() override {}
+
+    template <typename TYPE, unsigned int M, unsigned int K, unsigned int N>
+    void CheckMultiply(double tolerance)
+    {
+        std::vector<TYPE> a(M * K);
+        std::vector<TYPE> b(K * N);
+        std::vector<TYPE> c(M * N, TYPE{-999});
+
+        for ( unsigned int i = 0; i < a.size(); ++i ) a[i] = static_cast<TYPE>(std::sin(0.3 * i) + 0.1 * (i % 7));
+        for ( unsigned int i = 0; i < b.size(); ++i ) b[i] = static_cast<TYPE>(std::cos(0.7 * i) - 0.2 * (i % 5));
+
+        mc::MatrixKernels::Multiply<TYPE, M, K, N>(a.data(), b.data(), c.data());
+
+        for ( unsigned int r = 0; r < M; ++r )
+        {
+            for ( unsigned int col = 0; col < N; ++col )
+            {
+                double expected = 0.0;
+                for ( unsigned int i = 0; i < K; ++i )
+                {
+                    expected += static_cast<double>(a[r * K + i]) * static_cast<double>(b[i * N + col]);
+                }
+
+                EXPECT_NEAR(c[r * N + col], expected, tolerance) << "M= " << M << " K= " << K << " N= " << N
+                                                                 << " r= " << r << " c= " << col;
+            }
+        }
+    }
+};
+
+TEST_F(TestMatrixKernels, CanMultiplySmall)
+{
+    CheckMultiply<double, 1, 1, 1>(1.0e-12);
+    CheckMultiply<double, 2, 2, 2>(1.0e-12);
+    CheckMultiply<double, 3, 3, 3>(1.0e-12);
+    CheckMultiply<double, 4, 4, 4>(1.0e-12);
+    CheckMultiply<double, 5, 5, 5>(1.0e-12);
+    CheckMultiply<double, 6, 6, 6>(1.0e-12);
+    CheckMultiply<double, 7, 7, 7>(1.0e-12);
+}
+
+TEST_F(TestMatrixKernels, CanMultiplyLarge)
+{
+    CheckMultiply<double, 12, 12, 12>(1.0e-12);
+    CheckMultiply<double, 18, 18, 18>(1.0e-12);
+    CheckMultiply<double, 33, 33, 33>(1.0e-11);
+    CheckMultiply<double, 70, 70, 70>(1.0e-11);
+    CheckMultiply<double, 130, 130, 130>(1.0e-10);
+}
+
+TEST_F(TestMatrixKernels, CanMultiplyRectangular)
+{
+    CheckMultiply<double, 1, 18, 1>(1.0e-12);
+    CheckMultiply<double, 6, 18, 12>(1.0e-12);
+    CheckMultiply<double, 18, 6, 3>(1.0e-12);
+    CheckMultiply<double, 3, 70, 17>(1.0e-11);
+    CheckMultiply<double, 17, 3, 70>(1.0e-11);
+}
+
+TEST_F(TestMatrixKernels, CanMultiplyFloat)
+{
+    CheckMultiply<float, 3, 3, 3>(1.0e-5);
+    CheckMultiply<float, 6, 6, 6>(1.0e-5);
+    CheckMultiply<float, 18, 12, 7>(1.0e-4);
+}
+
+TEST_F(TestMatrixKernels, CanMultiplyMatrixMxN)
+{
+    mc::MatrixMxN<double,2,3> m1;
+    m1.SetFromVector({ 1.0, 2.0, 3.0,
+                       4.0, 5.0, 6.0 });
+
+    mc::MatrixMxN<double,3,2> m2;
+    m2.SetFromVector({ 1.0, 2.0,
+                       3.0, 4.0,
+                       5.0, 6.0 });
+
+    mc::MatrixMxN<double,2,2> mr = m1 * m2;
+
+    EXPECT_DOUBLE_EQ(mr(0,0), 22.0);
+    EXPECT_DOUBLE_EQ(mr(0,1), 28.0);
+    EXPECT_DOUBLE_EQ(mr(1,0), 49.0);
+    EXPECT_DOUBLE_EQ(mr(1,1), 64.0);
+}
+
+TEST_F(TestMatrixKernels, CanMultiplyMatrixNxN)
+{
+    constexpr int size = 18;
+
+    mc::MatrixNxN<double,size> m1;
+    mc::MatrixNxN<double,size> m2;
+    for ( int r = 0; r < size; ++r )
+    {
+        for ( int c = 0; c < size; ++c )
+        {
+            m1(r,c) = 0.1 * r - 0.2 * c;
+            m2(r,c) = (r == c) ? 2.0 : 0.0;
+        }
+    }
+
+    mc::MatrixNxN<double,size> mr = m1 * m2;
+
+    for ( int r = 0; r < size; ++r )
+    {
+        for ( int c = 0; c < size; ++c )
+        {
+            EXPECT_DOUBLE_EQ(mr(r,c), 2.0 * m1(r,c));
+        }
+    }
+}
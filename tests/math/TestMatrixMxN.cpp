@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <cmath>
+
 #include <mcutils/math/Matrix.h>
 
 class TestMatrixMxN : public ::testing::Test
@@ -158,6 +160,26 @@ TEST_F(TestMatrixMxN, CanSetFromString)
     EXPECT_FALSE(m2.IsValid());
 }
 
+TEST_F(TestMatrixMxN, CanSetFromInvalidString)
+{
+    constexpr int rows = 2;
+    constexpr int cols = 2;
+
+    mc::MatrixMxN<double,rows,cols> m;
+    m.SetFromString("1.0 2.0 3.0");
+    EXPECT_FALSE(m.IsValid());
+    EXPECT_TRUE(std::isnan(m(0,0)));
+
+    m.SetFromString("1.0 2.0 3.0 nan");
+    EXPECT_FALSE(m.IsValid());
+    EXPECT_TRUE(std::isnan(m(0,0)));
+
+    m.SetFromString("+1.0 2.0 3.0 -4.0");
+    EXPECT_TRUE(m.IsValid());
+    EXPECT_DOUBLE_EQ(m(0,0),  1.0);
+    EXPECT_DOUBLE_EQ(m(1,1), -4.0);
+}
+
 TEST_F(TestMatrixMxN, CanSwapRows)
 {
     constexpr int rows = 3;
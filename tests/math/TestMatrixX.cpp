@@ -0,0 +1,297 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <mcutils/math/Matrix.h>
+#include <mcutils/misc/Arena.h>
+
+class TestMatrixX : public ::testing::Test
+{
+protected:
+    TestMatrixX() {}
+    virtual ~TestMatrixX() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(TestMatrixX, CanInstantiate)
+{
+    mc::MatrixXd m0;
+    EXPECT_EQ(m0.rows(), 0u);
+    EXPECT_EQ(m0.cols(), 0u);
+    EXPECT_EQ(m0.data(), nullptr);
+
+    mc::MatrixXd m(50, 60);
+    EXPECT_EQ(m.rows(), 50u);
+    EXPECT_EQ(m.cols(), 60u);
+    EXPECT_EQ(m.size(), 3000u);
+
+    for ( unsigned int r = 0; r < m.rows(); ++r )
+    {
+        for ( unsigned int c = 0; c < m.cols(); ++c )
+        {
+            EXPECT_DOUBLE_EQ(m(r,c), 0.0) << "Error at row " << r << " and column " << c;
+        }
+    }
+}
+
+TEST_F(TestMatrixX, CanInstantiateFromArena)
+{
+    mc::Arena arena;
+    mc::MatrixXd m(50, 60, &arena);
+    EXPECT_EQ(m.GetAllocator(), &arena);
+    EXPECT_GE(arena.GetUsed(), 3000 * sizeof(double));
+
+    mc::MatrixXd m1(m);
+    EXPECT_EQ(m1.GetAllocator(), &arena);
+    EXPECT_TRUE(m1 == m);
+}
+
+TEST_F(TestMatrixX, CanGetIdentityMatrix)
+{
+    mc::MatrixXd m = mc::MatrixXd::GetIdentityMatrix(4);
+
+    for ( unsigned int r = 0; r < m.rows(); ++r )
+    {
+        for ( unsigned int c = 0; c < m.cols(); ++c )
+        {
+            EXPECT_DOUBLE_EQ(m(r,c), r == c ? 1.0 : 0.0);
+        }
+    }
+}
+
+TEST_F(TestMatrixX, CanFill)
+{
+    mc::MatrixXd m(2, 3);
+    m.Fill(2.0);
+
+    for ( unsigned int r = 0; r < m.rows(); ++r )
+    {
+        for ( unsigned int c = 0; c < m.cols(); ++c )
+        {
+            EXPECT_DOUBLE_EQ(m(r,c), 2.0);
+        }
+    }
+}
+
+TEST_F(TestMatrixX, CanCopyAndMove)
+{
+    mc::MatrixXd m(2, 2);
+    m.SetFromVector({ 1.0, 2.0, 3.0, 4.0 });
+
+    // assignment of the same size does not reallocate
+    mc::MatrixXd m1(2, 2);
+    const double* ptr = m1.data();
+    m1 = m;
+    EXPECT_EQ(m1.data(), ptr);
+    EXPECT_TRUE(m1 == m);
+
+    mc::MatrixXd m2(std::move(m1));
+    EXPECT_TRUE(m2 == m);
+    EXPECT_EQ(m1.size(), 0u);
+
+    mc::MatrixXd m3;
+    m3 = std::move(m2);
+    EXPECT_TRUE(m3 == m);
+}
+
+TEST_F(TestMatrixX, CanValidate)
+{
+    mc::MatrixXd m(2, 2);
+    m.SetFromVector({ 1.0, 2.0, 3.0, 4.0 });
+    EXPECT_TRUE(m.IsValid());
+    m(1,0) = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_FALSE(m.IsValid());
+}
+
+TEST_F(TestMatrixX, CanGetVector)
+{
+    mc::MatrixXd m(2, 3);
+    m.SetFromVector({ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 });
+
+    EXPECT_DOUBLE_EQ(m(0,2), 3.0);
+    EXPECT_DOUBLE_EQ(m(1,0), 4.0);
+
+    std::vector<double> x = m.GetVector();
+    ASSERT_EQ(x.size(), 6u);
+    for ( unsigned int i = 0; i < x.size(); ++i )
+    {
+        EXPECT_DOUBLE_EQ(x[i], static_cast<double>(i + 1));
+    }
+}
+
+TEST_F(TestMatrixX, CanSetFromString)
+{
+    char str[] =
+    { R"##(
+        1.0 2.0 3.0
+        4.0 5.0 6.0
+    )##" };
+
+    mc::MatrixXd m(2, 3);
+    m.SetFromString(str);
+
+    EXPECT_DOUBLE_EQ(m(0,0), 1.0);
+    EXPECT_DOUBLE_EQ(m(0,1), 2.0);
+    EXPECT_DOUBLE_EQ(m(0,2), 3.0);
+    EXPECT_DOUBLE_EQ(m(1,0), 4.0);
+    EXPECT_DOUBLE_EQ(m(1,1), 5.0);
+    EXPECT_DOUBLE_EQ(m(1,2), 6.0);
+}
+
+TEST_F(TestMatrixX, CanSetFromInvalidString)
+{
+    mc::MatrixXd m(2, 2);
+    m.SetFromString("1.0 2.0 3.0");
+    EXPECT_FALSE(m.IsValid());
+    EXPECT_TRUE(std::isnan(m(0,0)));
+
+    m.SetFromString("lorem ipsum");
+    EXPECT_FALSE(m.IsValid());
+
+    m.SetFromString("+1.0 2.0 3.0 -4.0");
+    EXPECT_TRUE(m.IsValid());
+    EXPECT_DOUBLE_EQ(m(0,0),  1.0);
+    EXPECT_DOUBLE_EQ(m(1,1), -4.0);
+}
+
+TEST_F(TestMatrixX, CanSwapRows)
+{
+    mc::MatrixXd m(3, 2);
+    m.SetFromVector({ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 });
+    m.SwapRows(0, 2);
+
+    EXPECT_DOUBLE_EQ(m(0,0), 5.0);
+    EXPECT_DOUBLE_EQ(m(0,1), 6.0);
+    EXPECT_DOUBLE_EQ(m(1,0), 3.0);
+    EXPECT_DOUBLE_EQ(m(1,1), 4.0);
+    EXPECT_DOUBLE_EQ(m(2,0), 1.0);
+    EXPECT_DOUBLE_EQ(m(2,1), 2.0);
+}
+
+TEST_F(TestMatrixX, CanConvertToString)
+{
+    mc::MatrixXd m(3, 3);
+    m.SetFromVector({ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0 });
+    EXPECT_STREQ(m.ToString().c_str(), "1\t2\t3\t\n4\t5\t6\t\n7\t8\t9");
+}
+
+TEST_F(TestMatrixX, CanTranspose)
+{
+    mc::MatrixXd m(2, 3);
+    m.SetFromVector({ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 });
+
+    mc::MatrixXd mt = m.GetTransposed();
+    EXPECT_EQ(mt.rows(), 3u);
+    EXPECT_EQ(mt.cols(), 2u);
+    for ( unsigned int r = 0; r < m.rows(); ++r )
+    {
+        for ( unsigned int c = 0; c < m.cols(); ++c )
+        {
+            EXPECT_DOUBLE_EQ(mt(c,r), m(r,c));
+        }
+    }
+
+    m.Transpose();
+    EXPECT_TRUE(m == mt);
+
+    mc::MatrixXd ms(2, 2);
+    ms.SetFromVector({ 1.0, 2.0, 3.0, 4.0 });
+    ms.Transpose();
+    EXPECT_DOUBLE_EQ(ms(0,1), 3.0);
+    EXPECT_DOUBLE_EQ(ms(1,0), 2.0);
+}
+
+TEST_F(TestMatrixX, CanAddAndSubstract)
+{
+    mc::MatrixXd m1(2, 2);
+    mc::MatrixXd m2(2, 2);
+    m1.SetFromVector({ 1.0, 2.0, 3.0, 4.0 });
+    m2.SetFromVector({ 5.0, 6.0, 7.0, 8.0 });
+
+    mc::MatrixXd ms = m1 + m2;
+    EXPECT_DOUBLE_EQ(ms(0,0),  6.0);
+    EXPECT_DOUBLE_EQ(ms(1,1), 12.0);
+
+    mc::MatrixXd md = m2 - m1;
+    EXPECT_DOUBLE_EQ(md(0,0), 4.0);
+    EXPECT_DOUBLE_EQ(md(1,1), 4.0);
+
+    mc::MatrixXd mn = -m1;
+    EXPECT_DOUBLE_EQ(mn(0,1), -2.0);
+
+    m1 += m2;
+    EXPECT_TRUE(m1 == ms);
+    m1 -= m2;
+    EXPECT_DOUBLE_EQ(m1(1,0), 3.0);
+}
+
+TEST_F(TestMatrixX, CanMultiplyAndDivideByNumber)
+{
+    mc::MatrixXd m(2, 2);
+    m.SetFromVector({ 1.0, 2.0, 3.0, 4.0 });
+
+    mc::MatrixXd m1 = m * 2.0;
+    mc::MatrixXd m2 = m / 2.0;
+    EXPECT_DOUBLE_EQ(m1(1,1), 8.0);
+    EXPECT_DOUBLE_EQ(m2(1,1), 2.0);
+
+    m *= 2.0;
+    EXPECT_TRUE(m == m1);
+    m /= 4.0;
+    EXPECT_TRUE(m == m2);
+}
+
+TEST_F(TestMatrixX, CanMultiplyByVector)
+{
+    mc::MatrixXd m(2, 3);
+    m.SetFromVector({ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 });
+
+    mc::VectorXd v(3);
+    v.SetFromVector({ 1.0, 2.0, 3.0 });
+
+    mc::VectorXd r = m * v;
+    ASSERT_EQ(r.size(), 2u);
+    EXPECT_DOUBLE_EQ(r(0), 14.0);
+    EXPECT_DOUBLE_EQ(r(1), 32.0);
+
+    mc::VectorXd r1(2);
+    m.MultiplyByVector(v, &r1);
+    EXPECT_TRUE(r1 == r);
+}
+
+TEST_F(TestMatrixX, CanMultiplyByMatrix)
+{
+    mc::MatrixXd m1(2, 3);
+    mc::MatrixXd m2(3, 2);
+    m1.SetFromVector({ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 });
+    m2.SetFromVector({ 7.0, 8.0, 9.0, 10.0, 11.0, 12.0 });
+
+    mc::MatrixXd m = m1 * m2;
+    ASSERT_EQ(m.rows(), 2u);
+    ASSERT_EQ(m.cols(), 2u);
+    EXPECT_DOUBLE_EQ(m(0,0),  58.0);
+    EXPECT_DOUBLE_EQ(m(0,1),  64.0);
+    EXPECT_DOUBLE_EQ(m(1,0), 139.0);
+    EXPECT_DOUBLE_EQ(m(1,1), 154.0);
+
+    mc::MatrixXd i = mc::MatrixXd::GetIdentityMatrix(3);
+    EXPECT_TRUE(m1 * i == m1);
+}
+
+TEST_F(TestMatrixX, CanCompare)
+{
+    mc::MatrixXd m1(2, 2);
+    mc::MatrixXd m2(2, 2);
+    mc::MatrixXd m3(1, 4);
+    m1.SetFromVector({ 1.0, 2.0, 3.0, 4.0 });
+    m2.SetFromVector({ 1.0, 2.0, 3.0, 4.0 });
+    m3.SetFromVector({ 1.0, 2.0, 3.0, 4.0 });
+
+    EXPECT_TRUE(m1 == m2);
+    EXPECT_FALSE(m1 != m2);
+    EXPECT_TRUE(m1 != m3);
+
+    m2(1,1) = 5.0;
+    EXPECT_TRUE(m1 != m2);
+}
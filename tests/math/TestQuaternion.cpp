@@ -520,3 +520,16 @@ TEST_F(TestQuaternion, CanCompare)
     EXPECT_FALSE(q != q5);
 }
 
+
+TEST_F(TestQuaternion, CanUseInConstantExpressions)
+{
+    constexpr mc::Quaternion q1(0.5, 0.5, 0.5, 0.5);
+    constexpr mc::Quaternion q2 = q1 * q1.GetConjugated();
+    constexpr mc::Quaternion q3 = (q1 + q2) * 2.0 - q1 / 0.5;
+
+    static_assert(q2 == mc::Quaternion(), "Product by conjugate");
+    static_assert(q3 == mc::Quaternion(2.0, 0.0, 0.0, 0.0), "Arithmetic");
+    static_assert(q1.GetLength2() == 1.0, "Length squared");
+
+    EXPECT_TRUE(q2 == mc::Quaternion());
+}
@@ -0,0 +1,282 @@
+#include <gtest/gtest.h>
+
+#include <mcutils/math/QuaternionBatch.h>
+#include <mcutils/math/RMatrix.h>
+#include <mcutils/math/Vector3Batch.h>
+#include <mcutils/misc/Arena.h>
+
+using namespace units::literals;
+
+class TestQuaternionBatch : public ::testing::Test
+{
+protected:
+    TestQuaternionBatch() {}
+    virtual ~TestQuaternionBatch() {}
+    void SetUp() override {}
+    void TearDown() override {}
+
+    // size not being a multiple of batch kernels lanes number
+    static constexpr unsigned int kSize = 7;
+
+    static mc::Quaternion GetQuaternion(unsigned int i, double offset = 0.0)
+    {
+        return mc::Quaternion(mc::Angles(units::angle::radian_t(0.1 * i + offset),
+                                         units::angle::radian_t(0.2 - 0.05 * i),
+                                         units::angle::radian_t(0.3 * i - offset)));
+    }
+
+    static void Fill(mc::QuaternionBatch* batch, double offset = 0.0)
+    {
+        for ( unsigned int i = 0; i < batch->size(); ++i )
+        {
+            batch->Set(i, GetQuaternion(i, offset));
+        }
+    }
+
+    static void ExpectNear(const mc::Quaternion& q1, const mc::Quaternion& q2,
+                           unsigned int i, double tol = 1.0e-12)
+    {
+        EXPECT_NEAR(q1.e0(), q2.e0(), tol) << "Error at index " << i;
+        EXPECT_NEAR(q1.ex(), q2.ex(), tol) << "Error at index " << i;
+        EXPECT_NEAR(q1.ey(), q2.ey(), tol) << "Error at index " << i;
+        EXPECT_NEAR(q1.ez(), q2.ez(), tol) << "Error at index " << i;
+    }
+};
+
+TEST_F(TestQuaternionBatch, CanInstantiate)
+{
+    mc::QuaternionBatch b(kSize);
+    EXPECT_EQ(b.size(), kSize);
+    EXPECT_EQ(b.GetAllocator(), nullptr);
+    EXPECT_TRUE(b.IsValid());
+
+    for ( unsigned int i = 0; i < b.size(); ++i )
+    {
+        ExpectNear(b.Get(i), mc::Quaternion(), i, 0.0);
+    }
+}
+
+TEST_F(TestQuaternionBatch, CanInstantiateFromArena)
+{
+    mc::Arena arena;
+    mc::QuaternionBatch b(kSize, &arena);
+    EXPECT_EQ(b.GetAllocator(), &arena);
+    EXPECT_GE(arena.GetUsed(), 4 * kSize * sizeof(double));
+
+    Fill(&b);
+    mc::QuaternionBatch b1(b);
+    EXPECT_EQ(b1.GetAllocator(), &arena);
+    EXPECT_EQ(b1.size(), kSize);
+    for ( unsigned int i = 0; i < b1.size(); ++i )
+    {
+        ExpectNear(b1.Get(i), GetQuaternion(i), i, 0.0);
+    }
+}
+
+TEST_F(TestQuaternionBatch, CanSetAndGet)
+{
+    mc::QuaternionBatch b(kSize);
+    Fill(&b);
+
+    for ( unsigned int i = 0; i < b.size(); ++i )
+    {
+        ExpectNear(b.Get(i), GetQuaternion(i), i, 0.0);
+        EXPECT_DOUBLE_EQ(b.e0()[i], GetQuaternion(i).e0()) << "Error at index " << i;
+        EXPECT_DOUBLE_EQ(b.ex()[i], GetQuaternion(i).ex()) << "Error at index " << i;
+        EXPECT_DOUBLE_EQ(b.ey()[i], GetQuaternion(i).ey()) << "Error at index " << i;
+        EXPECT_DOUBLE_EQ(b.ez()[i], GetQuaternion(i).ez()) << "Error at index " << i;
+    }
+}
+
+TEST_F(TestQuaternionBatch, CanSetFromVectorAndGetVector)
+{
+    std::vector<mc::Quaternion> qs;
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        qs.push_back(GetQuaternion(i));
+    }
+
+    mc::QuaternionBatch b;
+    b.SetFromVector(qs);
+    EXPECT_EQ(b.size(), kSize);
+
+    std::vector<mc::Quaternion> qs1 = b.GetVector();
+    ASSERT_EQ(qs1.size(), qs.size());
+    for ( unsigned int i = 0; i < qs.size(); ++i )
+    {
+        ExpectNear(qs1[i], qs[i], i, 0.0);
+    }
+}
+
+TEST_F(TestQuaternionBatch, CanResize)
+{
+    mc::QuaternionBatch b(kSize);
+    Fill(&b);
+    b.Resize(2 * kSize + 1);
+    EXPECT_EQ(b.size(), 2 * kSize + 1);
+    for ( unsigned int i = 0; i < b.size(); ++i )
+    {
+        ExpectNear(b.Get(i), mc::Quaternion(), i, 0.0);
+    }
+}
+
+TEST_F(TestQuaternionBatch, CanConjugate)
+{
+    mc::QuaternionBatch b(kSize);
+    Fill(&b);
+    b.Conjugate();
+
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        ExpectNear(b.Get(i), GetQuaternion(i).GetConjugated(), i, 0.0);
+    }
+}
+
+TEST_F(TestQuaternionBatch, CanNormalize)
+{
+    mc::QuaternionBatch b(kSize);
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        b.Set(i, GetQuaternion(i) * (1.0 + 0.1 * i));
+    }
+    b.Set(3, mc::Quaternion(0.0, 0.0, 0.0, 0.0));
+    b.Normalize();
+
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        mc::Quaternion q = (GetQuaternion(i) * (1.0 + 0.1 * i)).GetNormalized();
+        if ( i == 3 ) q = mc::Quaternion(0.0, 0.0, 0.0, 0.0);
+        ExpectNear(b.Get(i), q, i);
+    }
+    EXPECT_TRUE(b.IsValid());
+}
+
+TEST_F(TestQuaternionBatch, CanMultiply)
+{
+    mc::QuaternionBatch b1(kSize);
+    mc::QuaternionBatch b2(kSize);
+    mc::QuaternionBatch b3(kSize);
+    Fill(&b1);
+    Fill(&b2, 0.7);
+
+    b1.Multiply(b2, &b3);
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        ExpectNear(b3.Get(i), GetQuaternion(i) * GetQuaternion(i, 0.7), i);
+    }
+}
+
+TEST_F(TestQuaternionBatch, CanRotateVectorsConsistently)
+{
+    // vectors rotated with rotation matrices obtained from batch quaternions
+    // match vectors rotated with scalar types
+    mc::QuaternionBatch qb(kSize);
+    Fill(&qb);
+
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        mc::RMatrix m(qb.Get(i));
+        mc::Vector3Batch vb(kSize);
+        for ( unsigned int j = 0; j < kSize; ++j )
+        {
+            vb.Set(j, mc::Vector3d(1.0 + j, -2.0 * j, 0.5));
+        }
+
+        vb.MultiplyByMatrix(m, &vb);
+        for ( unsigned int j = 0; j < kSize; ++j )
+        {
+            mc::Vector3d v = mc::RMatrix(GetQuaternion(i)) * mc::Vector3d(1.0 + j, -2.0 * j, 0.5);
+            EXPECT_NEAR(vb.Get(j).x(), v.x(), 1.0e-12) << "Error at index " << i << " " << j;
+            EXPECT_NEAR(vb.Get(j).y(), v.y(), 1.0e-12) << "Error at index " << i << " " << j;
+            EXPECT_NEAR(vb.Get(j).z(), v.z(), 1.0e-12) << "Error at index " << i << " " << j;
+        }
+    }
+}
+
+TEST_F(TestQuaternionBatch, CanAddScaled)
+{
+    mc::QuaternionBatch b1(kSize);
+    mc::QuaternionBatch b2(kSize);
+    Fill(&b1);
+    Fill(&b2, 0.7);
+
+    b1.AddScaled(b2, 0.1);
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        ExpectNear(b1.Get(i), GetQuaternion(i) + 0.1 * GetQuaternion(i, 0.7), i);
+    }
+}
+
+TEST_F(TestQuaternionBatch, CanAssign)
+{
+    mc::QuaternionBatch b1(kSize);
+    Fill(&b1);
+
+    mc::QuaternionBatch b2(kSize + 1);
+    const double* e0 = b2.e0();
+    b2 = b1;
+    EXPECT_EQ(b2.size(), kSize);
+    EXPECT_EQ(b2.e0(), e0);   // same padded size, no reallocation
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        ExpectNear(b2.Get(i), GetQuaternion(i), i, 0.0);
+    }
+
+    mc::QuaternionBatch b3;
+    b3 = std::move(b2);
+    EXPECT_EQ(b3.size(), kSize);
+    EXPECT_EQ(b3.e0(), e0);
+    EXPECT_EQ(b2.size(), 0u);
+}
+
+TEST_F(TestQuaternionBatch, CanUnaryAdd)
+{
+    mc::QuaternionBatch b1(kSize);
+    mc::QuaternionBatch b2(kSize);
+    Fill(&b1);
+    Fill(&b2, 0.7);
+
+    b1 += b2;
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        ExpectNear(b1.Get(i), GetQuaternion(i) + GetQuaternion(i, 0.7), i, 0.0);
+    }
+}
+
+TEST_F(TestQuaternionBatch, CanUnarySubstract)
+{
+    mc::QuaternionBatch b1(kSize);
+    mc::QuaternionBatch b2(kSize);
+    Fill(&b1);
+    Fill(&b2, 0.7);
+
+    b1 -= b2;
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        ExpectNear(b1.Get(i), GetQuaternion(i) - GetQuaternion(i, 0.7), i, 0.0);
+    }
+}
+
+TEST_F(TestQuaternionBatch, CanUnaryMultiply)
+{
+    mc::QuaternionBatch b(kSize);
+    Fill(&b);
+
+    b *= 2.5;
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        ExpectNear(b.Get(i), GetQuaternion(i) * 2.5, i, 0.0);
+    }
+}
+
+TEST_F(TestQuaternionBatch, CanUnaryDivide)
+{
+    mc::QuaternionBatch b(kSize);
+    Fill(&b);
+
+    b /= 2.0;
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        ExpectNear(b.Get(i), GetQuaternion(i) / 2.0, i, 0.0);
+    }
+}
@@ -796,3 +796,25 @@ TEST_F(TestRMatrix, CanUnaryDivideByNumber)
     EXPECT_DOUBLE_EQ(m1.zy(), 4.0);
     EXPECT_DOUBLE_EQ(m1.zz(), 4.5);
 }
+
+TEST_F(TestRMatrix, CanUseInConstantExpressions)
+{
+    // 90 deg about z-axis
+    constexpr mc::Quaternion q(M_SQRT1_2, 0.0, 0.0, M_SQRT1_2);
+    constexpr mc::RMatrix m(q);
+    constexpr mc::RMatrix m2 = m * m.GetTransposed();
+    constexpr mc::Vector3d v = m * mc::Vector3d(1.0, 0.0, 0.0);
+
+    static_assert(m2.xx() > 1.0 - 1.0e-12 && m2.xx() < 1.0 + 1.0e-12, "Orthogonality");
+    static_assert(m2.xy() > -1.0e-12 && m2.xy() < 1.0e-12, "Orthogonality");
+    static_assert(v.y() < -1.0 + 1.0e-12, "Passive rotation");
+
+    mc::RMatrix m_ref(mc::Angles(0.0_rad, 0.0_rad, 90_deg));
+    for (unsigned int r = 0; r < 3; ++r)
+    {
+        for (unsigned int c = 0; c < 3; ++c)
+        {
+            EXPECT_NEAR(m(r,c), m_ref(r,c), 1.0e-12) << r << " " << c;
+        }
+    }
+}
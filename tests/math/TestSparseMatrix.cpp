@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <mcutils/math/SparseMatrix.h>
+
+class TestSparseMatrix : public ::testing::Test
+{
+protected:
+    TestSparseMatrix() {}
+    virtual ~TestSparseMatrix() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(TestSparseMatrix, CanInstantiate)
+{
+    mc::SparseMatrix<double, 3, 4> m;
+    EXPECT_EQ(m.GetNonZerosCount(), 0u);
+    EXPECT_DOUBLE_EQ(m(2,3), 0.0);
+    EXPECT_TRUE(m.IsValid());
+}
+
+TEST_F(TestSparseMatrix, CanSetFromTriplets)
+{
+    // 1 0 2
+    // 0 0 0
+    // 3 4 0
+    mc::SparseMatrix<double, 3, 3> m;
+    m.SetFromTriplets({ { 2, 1, 4.0 },
+                        { 0, 2, 2.0 },
+                        { 2, 0, 1.0 },
+                        { 0, 0, 1.0 },
+                        { 2, 0, 2.0 } });
+
+    EXPECT_EQ(m.GetNonZerosCount(), 4u);
+
+    EXPECT_DOUBLE_EQ(m(0,0), 1.0);
+    EXPECT_DOUBLE_EQ(m(0,1), 0.0);
+    EXPECT_DOUBLE_EQ(m(0,2), 2.0);
+    EXPECT_DOUBLE_EQ(m(1,0), 0.0);
+    EXPECT_DOUBLE_EQ(m(1,1), 0.0);
+    EXPECT_DOUBLE_EQ(m(1,2), 0.0);
+    EXPECT_DOUBLE_EQ(m(2,0), 3.0);
+    EXPECT_DOUBLE_EQ(m(2,1), 4.0);
+    EXPECT_DOUBLE_EQ(m(2,2), 0.0);
+
+    const unsigned int* offsets = m.GetRowOffsets();
+    EXPECT_EQ(offsets[0], 0u);
+    EXPECT_EQ(offsets[1], 2u);
+    EXPECT_EQ(offsets[2], 2u);
+    EXPECT_EQ(offsets[3], 4u);
+
+    ASSERT_EQ(m.GetColIndices().size(), 4u);
+    EXPECT_EQ(m.GetColIndices()[0], 0u);
+    EXPECT_EQ(m.GetColIndices()[1], 2u);
+    EXPECT_EQ(m.GetColIndices()[2], 0u);
+    EXPECT_EQ(m.GetColIndices()[3], 1u);
+}
+
+TEST_F(TestSparseMatrix, CanSetFromMatrix)
+{
+    mc::MatrixMxN<double, 2, 3> d;
+    d.SetFromVector({ 1.0, 0.0, 2.0,
+                      0.0, 1.0e-12, 3.0 });
+
+    mc::SparseMatrix<double, 2, 3> m;
+    m.SetFromMatrix(d, 1.0e-9);
+
+    EXPECT_EQ(m.GetNonZerosCount(), 3u);
+    EXPECT_DOUBLE_EQ(m(0,0), 1.0);
+    EXPECT_DOUBLE_EQ(m(0,2), 2.0);
+    EXPECT_DOUBLE_EQ(m(1,1), 0.0);
+    EXPECT_DOUBLE_EQ(m(1,2), 3.0);
+}
+
+TEST_F(TestSparseMatrix, CanUpdateValues)
+{
+    mc::SparseMatrix<double, 2, 2> m;
+    m.SetFromTriplets({ { 0, 0, 1.0 }, { 1, 1, 2.0 } });
+
+    double* ptr = m.GetValuePtr(1, 1);
+    ASSERT_NE(ptr, nullptr);
+    *ptr = 5.0;
+    EXPECT_DOUBLE_EQ(m(1,1), 5.0);
+
+    EXPECT_EQ(m.GetValuePtr(0, 1), nullptr);
+
+    *m.GetValuePtr(0, 0) = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_FALSE(m.IsValid());
+}
+
+TEST_F(TestSparseMatrix, CanMultiplyByVector)
+{
+    // 1 0 2     1     7
+    // 0 0 0  *  2  =  0
+    // 3 4 0     3    11
+    // 0 0 5          15
+    mc::SparseMatrix<double, 4, 3> m;
+    m.SetFromTriplets({ { 0, 0, 1.0 }, { 0, 2, 2.0 },
+                        { 2, 0, 3.0 }, { 2, 1, 4.0 },
+                        { 3, 2, 5.0 } });
+
+    mc::VectorN<double, 3> v;
+    v.SetFromVector({ 1.0, 2.0, 3.0 });
+
+    mc::VectorN<double, 4> r = m * v;
+    EXPECT_DOUBLE_EQ(r(0),  7.0);
+    EXPECT_DOUBLE_EQ(r(1),  0.0);
+    EXPECT_DOUBLE_EQ(r(2), 11.0);
+    EXPECT_DOUBLE_EQ(r(3), 15.0);
+}
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <mcutils/math/StaticTable.h>
+
+class TestStaticTable : public ::testing::Test
+{
+protected:
+    TestStaticTable() {}
+    virtual ~TestStaticTable() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+// y = x^2 - 1
+constexpr mc::StaticTable<double,double,6> kTab(
+    {{ -2.0, -1.0,  0.0,  1.0,  2.0,  3.0 }},
+    {{  1.0,  0.0, -1.0,  0.0,  3.0,  8.0 }}
+);
+
+static_assert(kTab.GetValue(-1.0) ==  0.0, "Compile-time lookup failed.");
+static_assert(kTab.GetValue( 2.5) ==  5.5, "Compile-time interpolation failed.");
+static_assert(kTab.GetValue(-9.0) ==  1.0, "Compile-time lookup out of range failed.");
+static_assert(kTab.GetValue( 9.0) ==  8.0, "Compile-time lookup out of range failed.");
+
+TEST_F(TestStaticTable, CanInstantiate)
+{
+    constexpr mc::StaticTable<double,double,1> tab({{ 1.7 }}, {{ 2.2 }});
+    EXPECT_EQ(tab.size(), 1);
+    EXPECT_DOUBLE_EQ(tab.GetValue(0.0), 2.2);
+    EXPECT_DOUBLE_EQ(tab.GetValue(1.7), 2.2);
+    EXPECT_DOUBLE_EQ(tab.GetValue(9.9), 2.2);
+}
+
+TEST_F(TestStaticTable, CanGetKeyByIndex)
+{
+    EXPECT_DOUBLE_EQ(kTab.GetKeyByIndex(0), -2.0);
+    EXPECT_DOUBLE_EQ(kTab.GetKeyByIndex(3),  1.0);
+    EXPECT_DOUBLE_EQ(kTab.GetKeyByIndex(5),  3.0);
+    EXPECT_TRUE(std::isnan(kTab.GetKeyByIndex(6)));
+}
+
+TEST_F(TestStaticTable, CanGetValue)
+{
+    std::vector<double> key_values { -2.0, -1.0,  0.0,  1.0,  2.0,  3.0 };
+    std::vector<double> table_data {  1.0,  0.0, -1.0,  0.0,  3.0,  8.0 };
+
+    for ( unsigned int i = 0; i < key_values.size(); ++i )
+    {
+        EXPECT_DOUBLE_EQ(kTab.GetValue(key_values[i]), table_data[i]);
+    }
+
+    EXPECT_DOUBLE_EQ(kTab.GetValue(-1.5),  0.5);
+    EXPECT_DOUBLE_EQ(kTab.GetValue( 0.5), -0.5);
+    EXPECT_DOUBLE_EQ(kTab.GetValue( 2.5),  5.5);
+    EXPECT_DOUBLE_EQ(kTab.GetValue(-9.0),  1.0);
+    EXPECT_DOUBLE_EQ(kTab.GetValue( 9.0),  8.0);
+
+    EXPECT_TRUE(std::isnan(kTab.GetValue(std::numeric_limits<double>::quiet_NaN())));
+}
+
+TEST_F(TestStaticTable, CanGetValueByIndex)
+{
+    EXPECT_DOUBLE_EQ(kTab.GetValueByIndex(0),  1.0);
+    EXPECT_DOUBLE_EQ(kTab.GetValueByIndex(2), -1.0);
+    EXPECT_DOUBLE_EQ(kTab.GetValueByIndex(5),  8.0);
+    EXPECT_TRUE(std::isnan(kTab.GetValueByIndex(6)));
+}
+
+TEST_F(TestStaticTable, CanGetFirstValue)
+{
+    EXPECT_DOUBLE_EQ(kTab.GetFirstValue(), 1.0);
+}
+
+TEST_F(TestStaticTable, CanGetLastValue)
+{
+    EXPECT_DOUBLE_EQ(kTab.GetLastValue(), 8.0);
+}
+
+TEST_F(TestStaticTable, CanGetTable)
+{
+    mc::Table<double,double> tab = kTab.GetTable();
+
+    EXPECT_EQ(tab.size(), kTab.size());
+
+    for ( int i = 0; i < 100; ++i )
+    {
+        double x = -3.0 + 0.07 * i;
+        EXPECT_DOUBLE_EQ(tab.GetValue(x), kTab.GetValue(x));
+    }
+}
+
+TEST_F(TestStaticTable, CanConvertToTable)
+{
+    mc::Table<double,double> tab = kTab;
+
+    EXPECT_EQ(tab.size(), kTab.size());
+
+    for ( int i = 0; i < 100; ++i )
+    {
+        double x = -3.0 + 0.07 * i;
+        EXPECT_DOUBLE_EQ(tab.GetValue(x), kTab.GetValue(x));
+    }
+}
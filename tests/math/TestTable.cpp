@@ -1,10 +1,12 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <cmath>
 
 #include <units.h>
 
 #include <mcutils/math/Table.h>
+#include <mcutils/math/Table2.h>
 
 using namespace units::literals;
 
@@ -167,6 +169,69 @@ TEST_F(TestTable, CanGetKeyOfValueMaxRanged)
     EXPECT_DOUBLE_EQ(tab.GetKeyOfValueMax(1.0, 2.0), 2.0);
 }
 
+TEST_F(TestTable, CanGetKeyOfValueMinMaxRangedLarge)
+{
+    std::vector<double> key_values;
+    std::vector<double> table_data;
+
+    for ( int i = 0; i < 200; ++i )
+    {
+        double x = 0.1 * i;
+        key_values.push_back(x);
+        table_data.push_back(std::round(10.0 * std::sin(1.7 * x) * std::cos(0.3 * x)) - 20.0);
+    }
+
+    mc::Table<double,double> tab(key_values, table_data);
+
+    for ( unsigned int i0 = 0; i0 < key_values.size(); i0 += 7 )
+    {
+        for ( unsigned int i1 = i0; i1 < key_values.size(); i1 += 3 )
+        {
+            // reference values, first occurrence of the extremum
+            unsigned int i_min = i0;
+            unsigned int i_max = i0;
+            for ( unsigned int i = i0; i <= i1; ++i )
+            {
+                if ( table_data[i] < table_data[i_min] ) i_min = i;
+                if ( table_data[i] > table_data[i_max] ) i_max = i;
+            }
+
+            double key_min = key_values[i0] - 0.05;
+            double key_max = key_values[i1] + 0.05;
+
+            EXPECT_DOUBLE_EQ(tab.GetKeyOfValueMin(key_min, key_max), key_values[i_min]) << i0 << " " << i1;
+            EXPECT_DOUBLE_EQ(tab.GetKeyOfValueMax(key_min, key_max), key_values[i_max]) << i0 << " " << i1;
+        }
+    }
+
+    // empty range
+    double x_min = tab.GetKeyOfValueMin(1.01, 1.09);
+    double x_max = tab.GetKeyOfValueMax(5.0, 4.0);
+    EXPECT_FALSE(x_min == x_min); // NaN
+    EXPECT_FALSE(x_max == x_max); // NaN
+
+    // range index is updated when data changes
+    mc::Table<double,double> tab1(tab);
+    tab1.MultiplyValues(-1.0);
+    EXPECT_DOUBLE_EQ(tab1.GetKeyOfValueMin(0.0, 20.0), tab.GetKeyOfValueMax(0.0, 20.0));
+    EXPECT_DOUBLE_EQ(tab1.GetKeyOfValueMax(0.0, 20.0), tab.GetKeyOfValueMin(0.0, 20.0));
+
+    tab.SetData(key_values, std::vector<double>(key_values.size(), 1.0));
+    EXPECT_DOUBLE_EQ(tab.GetKeyOfValueMin(0.0, 20.0), 0.0);
+    EXPECT_DOUBLE_EQ(tab.GetKeyOfValueMax(0.0, 20.0), 0.0);
+}
+
+TEST_F(TestTable, CanGetKeyOfValueMaxOfNegativeValues)
+{
+    std::vector<double> key_values { -2.0, -1.0,  0.0,  1.0,  2.0,  3.0 };
+    std::vector<double> table_data { -4.0, -3.0, -1.0, -2.0, -5.0, -6.0 };
+
+    mc::Table<double,double> tab(key_values, table_data);
+
+    EXPECT_DOUBLE_EQ(tab.GetKeyOfValueMax(), 0.0);
+    EXPECT_DOUBLE_EQ(tab.GetKeyOfValueMax(1.0, 3.0), 1.0);
+}
+
 TEST_F(TestTable, CanGetValue)
 {
     mc::Table<double,units::length::meter_t> tab0;
@@ -214,6 +279,397 @@ TEST_F(TestTable, CanGetValueOutOfRange)
     EXPECT_DOUBLE_EQ(tab.GetValue(  9.0 ), 8.0);
 }
 
+TEST_F(TestTable, CanGetValueInAnyOrder)
+{
+    // y = 3x - 1, non-uniformly spaced keys
+    std::vector<double> key_values;
+    std::vector<double> table_data;
+
+    for ( int i = 0; i < 1000; ++i )
+    {
+        double x = 0.1 * i + 0.01 * (i % 3);
+        key_values.push_back(x);
+        table_data.push_back(3.0 * x - 1.0);
+    }
+
+    mc::Table<double,double> tab(key_values, table_data);
+
+    // sequential, backward and jumping queries
+    for ( int i = 0; i < 9990; ++i )
+    {
+        double x = 0.01 * i;
+        EXPECT_NEAR(tab.GetValue(x), 3.0 * x - 1.0, 1.0e-9);
+    }
+
+    for ( int i = 9990; i >= 0; --i )
+    {
+        double x = 0.01 * i;
+        EXPECT_NEAR(tab.GetValue(x), 3.0 * x - 1.0, 1.0e-9);
+    }
+
+    for ( int i = 0; i < 1000; ++i )
+    {
+        double x = 0.01 * ((i * 7919) % 9990);
+        EXPECT_NEAR(tab.GetValue(x), 3.0 * x - 1.0, 1.0e-9);
+    }
+
+    EXPECT_DOUBLE_EQ(tab.GetValue(-1.0), table_data.front());
+    EXPECT_NEAR(tab.GetValue(50.0), 3.0 * 50.0 - 1.0, 1.0e-9);
+    EXPECT_DOUBLE_EQ(tab.GetValue(1000.0), table_data.back());
+}
+
+TEST_F(TestTable, CanGetValueWithCursor)
+{
+    // y = x^2 - 1
+    std::vector<double> key_values { -2.0, -1.0,  0.0,  1.0,  2.0,  3.0 };
+    std::vector<double> table_data {  1.0,  0.0, -1.0,  0.0,  3.0,  8.0 };
+
+    const mc::Table<double,double> tab(key_values, table_data);
+
+    mc::TableCursor cursor_1;
+    mc::TableCursor cursor_2;
+
+    EXPECT_DOUBLE_EQ(tab.GetValue(-1.5, &cursor_1),  0.5);
+    EXPECT_EQ(cursor_1.index, 0);
+    EXPECT_DOUBLE_EQ(tab.GetValue( 2.5, &cursor_2),  5.5);
+    EXPECT_EQ(cursor_2.index, 4);
+    EXPECT_DOUBLE_EQ(tab.GetValue(-0.5, &cursor_1), -0.5);
+    EXPECT_EQ(cursor_1.index, 1);
+    EXPECT_DOUBLE_EQ(tab.GetValue( 1.5, &cursor_2),  1.5);
+    EXPECT_EQ(cursor_2.index, 3);
+
+    EXPECT_DOUBLE_EQ(tab.GetValue(-9.0, &cursor_1), 1.0);
+    EXPECT_DOUBLE_EQ(tab.GetValue( 9.0, &cursor_2), 8.0);
+    EXPECT_DOUBLE_EQ(tab.GetValue( 0.5, &cursor_1), -0.5);
+    EXPECT_DOUBLE_EQ(tab.GetValue( 0.5, &cursor_2), -0.5);
+}
+
+TEST_F(TestTable, CanGetValueStateless)
+{
+    // y = x^2 - 1
+    std::vector<double> key_values { -2.0, -1.0,  0.0,  1.0,  2.0,  3.0 };
+    std::vector<double> table_data {  1.0,  0.0, -1.0,  0.0,  3.0,  8.0 };
+
+    const mc::Table<double,double> tab(key_values, table_data);
+
+    for ( unsigned int i = 0; i < key_values.size(); ++i )
+    {
+        EXPECT_DOUBLE_EQ(tab.GetValueStateless(key_values[i]), table_data[i]);
+    }
+
+    EXPECT_DOUBLE_EQ(tab.GetValueStateless( 2.5),  5.5);
+    EXPECT_DOUBLE_EQ(tab.GetValueStateless(-1.5),  0.5);
+    EXPECT_DOUBLE_EQ(tab.GetValueStateless(-9.0),  1.0);
+    EXPECT_DOUBLE_EQ(tab.GetValueStateless( 9.0),  8.0);
+
+    std::vector<double> key_values_0;
+    std::vector<double> table_data_0;
+    mc::Table<double,double> tab0(key_values_0, table_data_0);
+    EXPECT_TRUE(std::isnan(tab0.GetValueStateless(0.0)));
+}
+
+TEST_F(TestTable, CanGetValues)
+{
+    // y = x^2 - 1
+    std::vector<double> key_values { -2.0, -1.0,  0.0,  1.0,  2.0,  3.0 };
+    std::vector<double> table_data {  1.0,  0.0, -1.0,  0.0,  3.0,  8.0 };
+
+    mc::Table<double,double> tab(key_values, table_data);
+
+    std::vector<double> keys;
+    for ( int i = 0; i < 500; ++i )
+    {
+        keys.push_back(-3.0 + 0.01 * ((i * 37) % 700));
+    }
+    keys.push_back(-std::numeric_limits<double>::infinity());
+    keys.push_back( std::numeric_limits<double>::infinity());
+
+    std::vector<double> values = tab.GetValues(keys);
+
+    ASSERT_EQ(values.size(), keys.size());
+    for ( unsigned int i = 0; i < keys.size(); ++i )
+    {
+        EXPECT_NEAR(values[i], tab.GetValueStateless(keys[i]), 1.0e-12);
+    }
+
+    std::sort(keys.begin(), keys.end());
+    values = tab.GetValues(keys);
+
+    for ( unsigned int i = 0; i < keys.size(); ++i )
+    {
+        EXPECT_NEAR(values[i], tab.GetValueStateless(keys[i]), 1.0e-12);
+    }
+
+    double key_nan = std::numeric_limits<double>::quiet_NaN();
+    double val_nan = 0.0;
+    tab.GetValues(&key_nan, &val_nan, 1);
+    EXPECT_TRUE(std::isnan(val_nan));
+
+    std::vector<double> key_values_0;
+    std::vector<double> table_data_0;
+    mc::Table<double,double> tab0(key_values_0, table_data_0);
+    std::vector<double> values0 = tab0.GetValues(keys);
+    ASSERT_EQ(values0.size(), keys.size());
+    EXPECT_TRUE(std::isnan(values0[0]));
+}
+
+TEST_F(TestTable, CanDetectUniformKeys)
+{
+    std::vector<double> k1 { -2.0, -1.0,  0.0,  1.0,  2.0,  3.0 };
+    std::vector<double> v1 {  1.0,  0.0, -1.0,  0.0,  3.0,  8.0 };
+    mc::Table<double,double> t1(k1, v1);
+    EXPECT_TRUE(t1.IsUniform());
+
+    t1.MultiplyKeys(0.1);
+    EXPECT_TRUE(t1.IsUniform());
+
+    std::vector<double> k2 { -2.0, -1.0,  0.0,  1.5,  2.0,  3.0 };
+    std::vector<double> v2 {  1.0,  0.0, -1.0,  0.0,  3.0,  8.0 };
+    mc::Table<double,double> t2(k2, v2);
+    EXPECT_FALSE(t2.IsUniform());
+
+    mc::Table<double,double> t3;
+    EXPECT_FALSE(t3.IsUniform());
+
+    mc::Table<double,double> t4(t1);
+    EXPECT_TRUE(t4.IsUniform());
+}
+
+TEST_F(TestTable, CanGetValueFromUniformTable)
+{
+    // y = x^2 - 1
+    std::vector<double> key_values;
+    std::vector<double> table_data;
+
+    for ( int i = 0; i < 301; ++i )
+    {
+        double x = -1.0 + 0.01 * i;
+        key_values.push_back(x);
+        table_data.push_back(x * x - 1.0);
+    }
+
+    mc::Table<double,double> tab(key_values, table_data);
+    ASSERT_TRUE(tab.IsUniform());
+
+    for ( unsigned int i = 0; i < key_values.size(); ++i )
+    {
+        EXPECT_DOUBLE_EQ(tab.GetValueStateless(key_values[i]), table_data[i]);
+    }
+
+    for ( int i = 0; i < 1000; ++i )
+    {
+        double x = -1.5 + 0.0037 * ((i * 7919) % 1000);
+        double y = 0.0;
+
+        if ( x <= key_values.front() )
+        {
+            y = table_data.front();
+        }
+        else if ( x >= key_values.back() )
+        {
+            y = table_data.back();
+        }
+        else
+        {
+            unsigned int j = 0;
+            while ( !(x >= key_values[j] && x < key_values[j + 1]) ) ++j;
+            y = table_data[j] + (x - key_values[j])
+              * (table_data[j + 1] - table_data[j]) / (key_values[j + 1] - key_values[j]);
+        }
+
+        EXPECT_NEAR(tab.GetValue(x), y, 1.0e-12);
+        EXPECT_NEAR(tab.GetValueStateless(x), y, 1.0e-12);
+    }
+
+    std::vector<double> keys { 0.5, -0.5, -2.0, 2.5, 0.123, -0.987, 1.999 };
+    std::vector<double> values = tab.GetValues(keys);
+    for ( unsigned int i = 0; i < keys.size(); ++i )
+    {
+        EXPECT_DOUBLE_EQ(values[i], tab.GetValueStateless(keys[i]));
+    }
+
+    EXPECT_TRUE(std::isnan(tab.GetValueStateless(std::numeric_limits<double>::quiet_NaN())));
+}
+
+TEST_F(TestTable, CanSetInterpolation)
+{
+    std::vector<double> key_values { 0.0, 1.0, 2.0, 3.0, 4.0 };
+    std::vector<double> table_data { 0.0, 1.0, 4.0, 9.0, 16.0 };
+
+    mc::Table<double,double> tab(key_values, table_data);
+    EXPECT_EQ(tab.GetInterpolation(), mc::TableInterpolation::Linear);
+
+    tab.SetInterpolation(mc::TableInterpolation::MonotoneCubic);
+    EXPECT_EQ(tab.GetInterpolation(), mc::TableInterpolation::MonotoneCubic);
+    EXPECT_TRUE(tab.IsValid());
+
+    tab.SetInterpolation(mc::TableInterpolation::Akima);
+    EXPECT_EQ(tab.GetInterpolation(), mc::TableInterpolation::Akima);
+    EXPECT_TRUE(tab.IsValid());
+
+    tab.SetInterpolation(mc::TableInterpolation::Linear);
+    EXPECT_EQ(tab.GetInterpolation(), mc::TableInterpolation::Linear);
+    EXPECT_DOUBLE_EQ(tab.GetValue(1.5), 2.5);
+
+    std::vector<double> empty;
+    mc::Table<double,double> tab0(empty, empty);
+    tab0.SetInterpolation(mc::TableInterpolation::Akima);
+    EXPECT_TRUE(std::isnan(tab0.GetValue(0.0)));
+    tab0.SetData(key_values, table_data);
+    EXPECT_DOUBLE_EQ(tab0.GetValue(2.0), 4.0);
+}
+
+TEST_F(TestTable, CanGetValueCubic)
+{
+    const mc::TableInterpolation methods[] = {
+        mc::TableInterpolation::MonotoneCubic,
+        mc::TableInterpolation::Akima
+    };
+
+    // y = sin(x)
+    std::vector<double> key_values;
+    std::vector<double> table_data;
+
+    for ( int i = 0; i < 21; ++i )
+    {
+        double x = 0.3 * i + 0.05 * (i % 2);
+        key_values.push_back(x);
+        table_data.push_back(sin(x));
+    }
+
+    mc::Table<double,double> tab_lin(key_values, table_data);
+
+    for ( mc::TableInterpolation method : methods )
+    {
+        mc::Table<double,double> tab(key_values, table_data);
+        tab.SetInterpolation(method);
+
+        // passes through breakpoints
+        for ( unsigned int i = 0; i < key_values.size(); ++i )
+        {
+            EXPECT_NEAR(tab.GetValue(key_values[i]), table_data[i], 1.0e-12);
+        }
+
+        // out of range
+        EXPECT_DOUBLE_EQ(tab.GetValue(-1.0), table_data.front());
+        EXPECT_DOUBLE_EQ(tab.GetValue(99.0), table_data.back());
+
+        double err_lin = 0.0;
+        double err_cub = 0.0;
+
+        for ( int i = 0; i < 500; ++i )
+        {
+            double x = key_values.front() + 0.001 + 0.0123 * i;
+            if ( x >= key_values.back() ) break;
+            err_lin = std::max(err_lin, fabs(tab_lin.GetValue(x) - sin(x)));
+            err_cub = std::max(err_cub, fabs(tab.GetValue(x) - sin(x)));
+
+            EXPECT_DOUBLE_EQ(tab.GetValueStateless(x), tab.GetValue(x));
+        }
+
+        EXPECT_LT(err_cub, 0.5 * err_lin);
+
+        std::vector<double> keys { 5.5, 0.5, -2.0, 7.5, 0.123, 3.987, 1.999 };
+        std::vector<double> values = tab.GetValues(keys);
+        for ( unsigned int i = 0; i < keys.size(); ++i )
+        {
+            EXPECT_DOUBLE_EQ(values[i], tab.GetValueStateless(keys[i]));
+        }
+    }
+}
+
+TEST_F(TestTable, CanGetValueCubicFromLinearData)
+{
+    const mc::TableInterpolation methods[] = {
+        mc::TableInterpolation::MonotoneCubic,
+        mc::TableInterpolation::Akima
+    };
+
+    // y = 2x - 1
+    std::vector<double> key_values { -2.0, -1.0, 0.5, 1.0, 3.0, 3.5, 7.0 };
+    std::vector<units::length::meter_t> table_data;
+    for ( double x : key_values ) table_data.push_back(units::length::meter_t(2.0 * x - 1.0));
+
+    for ( mc::TableInterpolation method : methods )
+    {
+        mc::Table<double, units::length::meter_t> tab(key_values, table_data);
+        tab.SetInterpolation(method);
+
+        for ( int i = 0; i < 100; ++i )
+        {
+            double x = -2.0 + 0.09 * i;
+            EXPECT_NEAR(tab.GetValue(x)(), 2.0 * x - 1.0, 1.0e-12);
+        }
+    }
+}
+
+TEST_F(TestTable, CanGetValueMonotoneCubicPreservesMonotonicity)
+{
+    // step-like data, overshoots with unconstrained cubic interpolation
+    std::vector<double> key_values { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0 };
+    std::vector<double> table_data { 0.0, 0.0, 0.0, 0.1, 1.0, 1.0, 1.0, 5.0 };
+
+    mc::Table<double,double> tab(key_values, table_data);
+    tab.SetInterpolation(mc::TableInterpolation::MonotoneCubic);
+
+    double y_prev = tab.GetValue(0.0);
+    for ( int i = 1; i <= 700; ++i )
+    {
+        double y = tab.GetValue(0.01 * i);
+        EXPECT_GE(y, y_prev - 1.0e-12);
+        y_prev = y;
+    }
+
+    // flat segments stay flat
+    EXPECT_DOUBLE_EQ(tab.GetValue(0.5), 0.0);
+    EXPECT_DOUBLE_EQ(tab.GetValue(1.5), 0.0);
+    EXPECT_DOUBLE_EQ(tab.GetValue(4.5), 1.0);
+    EXPECT_DOUBLE_EQ(tab.GetValue(5.5), 1.0);
+}
+
+TEST_F(TestTable, CanGetValueAkimaFlatSegments)
+{
+    std::vector<double> key_values { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 };
+    std::vector<double> table_data { 0.0, 0.0, 0.0, 1.0, 1.0, 1.0, 1.0 };
+
+    mc::Table<double,double> tab(key_values, table_data);
+    tab.SetInterpolation(mc::TableInterpolation::Akima);
+
+    EXPECT_NEAR(tab.GetValue(0.5), 0.0, 1.0e-12);
+    EXPECT_NEAR(tab.GetValue(1.5), 0.0, 1.0e-12);
+    EXPECT_NEAR(tab.GetValue(4.5), 1.0, 1.0e-12);
+    EXPECT_NEAR(tab.GetValue(5.5), 1.0, 1.0e-12);
+}
+
+TEST_F(TestTable, CanCopyAndAssignInterpolation)
+{
+    std::vector<double> key_values { 0.0, 1.0, 2.0, 3.0, 4.0 };
+    std::vector<double> table_data { 0.0, 1.0, 4.0, 9.0, 16.0 };
+
+    mc::Table<double,double> tab(key_values, table_data);
+    tab.SetInterpolation(mc::TableInterpolation::Akima);
+    double y = tab.GetValue(2.5);
+    EXPECT_NE(y, 6.5);
+
+    mc::Table<double,double> tab1(tab);
+    EXPECT_EQ(tab1.GetInterpolation(), mc::TableInterpolation::Akima);
+    EXPECT_DOUBLE_EQ(tab1.GetValue(2.5), y);
+
+    mc::Table<double,double> tab2;
+    tab2 = tab;
+    EXPECT_EQ(tab2.GetInterpolation(), mc::TableInterpolation::Akima);
+    EXPECT_DOUBLE_EQ(tab2.GetValue(2.5), y);
+
+    mc::Table<double,double> tab3(std::move(tab1));
+    EXPECT_EQ(tab3.GetInterpolation(), mc::TableInterpolation::Akima);
+    EXPECT_DOUBLE_EQ(tab3.GetValue(2.5), y);
+
+    mc::Table<double,double> tab4;
+    tab4 = std::move(tab2);
+    EXPECT_EQ(tab4.GetInterpolation(), mc::TableInterpolation::Akima);
+    EXPECT_DOUBLE_EQ(tab4.GetValue(2.5), y);
+}
+
 TEST_F(TestTable, CanGetValueByIndex)
 {
     mc::Table<double,double> tab0;
@@ -396,6 +852,179 @@ TEST_F(TestTable, CanConvertToString)
     EXPECT_STREQ(tab.ToString().c_str(), "0\t0\n1\t2\n2\t4\n");
 }
 
+TEST_F(TestTable, CanConvertToBinary)
+{
+    std::vector<double> key_values { 0.0,  1.0,  2.0,  3.5 };
+    std::vector<double> table_data { 0.0,  2.0,  4.0, -1.0 };
+
+    mc::Table<double,double> tab(key_values, table_data);
+
+    std::vector<char> bin = tab.ToBinary();
+    ASSERT_GE(bin.size(), sizeof(mc::TableBinaryHeader));
+
+    mc::TableBinaryHeader header;
+    ASSERT_EQ(mc::ReadTableBinaryHeader(bin.data(), bin.size(), &header), mc::Result::Success);
+    EXPECT_EQ(header.dimensions, 1);
+    EXPECT_EQ(header.count[0], 4);
+    EXPECT_EQ(header.size, bin.size());
+}
+
+TEST_F(TestTable, CanSetFromBinary)
+{
+    std::vector<double> key_values { -2.0, -1.0,  0.0,  1.0,  2.0,  3.0 };
+    std::vector<units::length::meter_t> table_data { 1.0_m, 0.0_m, -1.0_m, 0.0_m, 3.0_m, 8.0_m };
+
+    mc::Table<double, units::length::meter_t> tab0(key_values, table_data);
+    tab0.SetInterpolation(mc::TableInterpolation::Akima);
+    std::vector<char> bin = tab0.ToBinary();
+
+    mc::Table<double, units::length::meter_t> tab;
+    EXPECT_EQ(tab.SetFromBinary(bin.data(), bin.size()), mc::Result::Success);
+    EXPECT_FALSE(tab.IsWrapped());
+    EXPECT_TRUE(tab.IsValid());
+    EXPECT_TRUE(tab.IsUniform());
+    EXPECT_EQ(tab.size(), 6);
+    EXPECT_EQ(tab.GetInterpolation(), mc::TableInterpolation::Akima);
+
+    for ( int i = 0; i < 60; ++i )
+    {
+        double x = -2.5 + 0.1 * i;
+        EXPECT_DOUBLE_EQ(tab.GetValue(x)(), tab0.GetValue(x)());
+    }
+
+    // empty table
+    std::vector<double> empty_keys;
+    std::vector<units::length::meter_t> empty_data;
+    mc::Table<double, units::length::meter_t> tab_empty(empty_keys, empty_data);
+    std::vector<char> bin_empty = tab_empty.ToBinary();
+    EXPECT_EQ(tab.SetFromBinary(bin_empty.data(), bin_empty.size()), mc::Result::Success);
+    EXPECT_EQ(tab.size(), 0);
+    EXPECT_TRUE(std::isnan(tab.GetValue(0.0)()));
+}
+
+TEST_F(TestTable, CanNotSetFromInvalidBinary)
+{
+    std::vector<double> key_values { 0.0,  1.0,  2.0 };
+    std::vector<double> table_data { 0.0,  2.0,  4.0 };
+
+    mc::Table<double,double> tab0(key_values, table_data);
+    std::vector<char> bin = tab0.ToBinary();
+
+    mc::Table<double,double> tab;
+
+    // truncated
+    EXPECT_EQ(tab.SetFromBinary(bin.data(), bin.size() - 1), mc::Result::Failure);
+    EXPECT_EQ(tab.SetFromBinary(bin.data(), 10), mc::Result::Failure);
+    EXPECT_EQ(tab.SetFromBinary(nullptr, 0), mc::Result::Failure);
+
+    // table unchanged on failure
+    EXPECT_EQ(tab.size(), 1);
+
+    // wrong magic number
+    std::vector<char> bin1 = bin;
+    bin1[0] = 'X';
+    EXPECT_EQ(tab.SetFromBinary(bin1.data(), bin1.size()), mc::Result::Failure);
+
+    // wrong endianness
+    std::vector<char> bin2 = bin;
+    std::reverse(bin2.begin() + 4, bin2.begin() + 8);
+    EXPECT_EQ(tab.SetFromBinary(bin2.data(), bin2.size()), mc::Result::Failure);
+
+    // wrong dimensions
+    mc::Table2<double,double,double> tab2;
+    std::vector<char> bin3 = tab2.ToBinary();
+    EXPECT_EQ(tab.SetFromBinary(bin3.data(), bin3.size()), mc::Result::Failure);
+
+    // wrong types
+    mc::Table<float,double> tab4;
+    EXPECT_EQ(tab4.SetFromBinary(bin.data(), bin.size()), mc::Result::Failure);
+}
+
+TEST_F(TestTable, CanWrapBinary)
+{
+    std::vector<double> key_values { -2.0, -1.0,  0.0,  1.0,  2.0,  3.0 };
+    std::vector<double> table_data {  1.0,  0.0, -1.0,  0.0,  3.0,  8.0 };
+
+    mc::Table<double,double> tab0(key_values, table_data);
+    std::vector<char> bin = tab0.ToBinary();
+
+    struct alignas(mc::kTableBinaryAlignment) Block { char data[mc::kTableBinaryAlignment]; };
+    std::vector<Block> buffer(bin.size() / sizeof(Block) + 1);
+    char* data = reinterpret_cast<char*>(buffer.data());
+    std::copy(bin.begin(), bin.end(), data);
+
+    mc::Table<double,double> tab;
+    EXPECT_EQ(tab.WrapBinary(data, bin.size()), mc::Result::Success);
+    EXPECT_TRUE(tab.IsWrapped());
+    EXPECT_EQ(tab.size(), 6);
+    EXPECT_DOUBLE_EQ(tab.GetValue(1.5), 1.5);
+    EXPECT_DOUBLE_EQ(tab.GetValue(-1.5), 0.5);
+
+    // misaligned
+    mc::Table<double,double> tab1;
+    std::copy(bin.begin(), bin.end(), data + 1);
+    EXPECT_EQ(tab1.WrapBinary(data + 1, bin.size()), mc::Result::Failure);
+    EXPECT_FALSE(tab1.IsWrapped());
+    std::copy(bin.begin(), bin.end(), data);
+
+    // copies share wrapped data
+    mc::Table<double,double> tab2(tab);
+    EXPECT_TRUE(tab2.IsWrapped());
+    EXPECT_DOUBLE_EQ(tab2.GetValue(1.5), 1.5);
+
+    mc::Table<double,double> tab3;
+    tab3 = tab;
+    EXPECT_TRUE(tab3.IsWrapped());
+    EXPECT_DOUBLE_EQ(tab3.GetValue(1.5), 1.5);
+
+    tab3.MultiplyKeys(2.0);
+    EXPECT_FALSE(tab3.IsWrapped());
+    EXPECT_TRUE(tab2.IsWrapped());
+    EXPECT_DOUBLE_EQ(tab2.GetValue(1.5), 1.5);
+
+    // modification does not change wrapped data
+    mc::Table<double,double> tab6;
+    tab6.WrapBinary(data, bin.size());
+    tab6.MultiplyValues(2.0);
+    EXPECT_FALSE(tab6.IsWrapped());
+    EXPECT_DOUBLE_EQ(tab6.GetValue(1.5), 3.0);
+    EXPECT_DOUBLE_EQ(tab.GetValue(1.5), 1.5);
+
+    tab.SetInterpolation(mc::TableInterpolation::MonotoneCubic);
+    EXPECT_FALSE(tab.IsWrapped());
+    EXPECT_DOUBLE_EQ(tab.GetValue(1.0), 0.0);
+
+    // moves remain wrapped
+    mc::Table<double,double> tab7;
+    tab7.WrapBinary(data, bin.size());
+    mc::Table<double,double> tab8(std::move(tab7));
+    EXPECT_TRUE(tab8.IsWrapped());
+    EXPECT_DOUBLE_EQ(tab8.GetValue(1.5), 1.5);
+    tab8.SetData(key_values, key_values);
+    EXPECT_FALSE(tab8.IsWrapped());
+    EXPECT_DOUBLE_EQ(tab8.GetValue(1.5), 1.5);
+
+}
+
+TEST_F(TestTable, CanConvertTableToBinary)
+{
+    char str[] =
+    { R"##(
+        0.0  0.0
+        1.0  2.0
+        2.0  4.0
+    )##" };
+
+    std::vector<char> bin = mc::ConvertTableToBinary<double,double>(str, mc::TableInterpolation::MonotoneCubic);
+
+    mc::Table<double,double> tab;
+    EXPECT_EQ(tab.SetFromBinary(bin.data(), bin.size()), mc::Result::Success);
+    EXPECT_EQ(tab.size(), 3);
+    EXPECT_EQ(tab.GetInterpolation(), mc::TableInterpolation::MonotoneCubic);
+    EXPECT_DOUBLE_EQ(tab.GetValue(0.5), 1.0);
+    EXPECT_DOUBLE_EQ(tab.GetValue(1.5), 3.0);
+}
+
 TEST_F(TestTable, CanSetDataFromVector)
 {
     // y = x^2 - 1
@@ -442,6 +1071,36 @@ TEST_F(TestTable, CanSetFromString)
     EXPECT_FALSE(tab2.IsValid());
 }
 
+TEST_F(TestTable, CanSetFromInvalidString)
+{
+    const char* invalid[] = {
+        "",
+        "   \n  ",
+        "1.0",
+        "1.0 2.0 3.0",
+        "1.0 2.0 3.0 lorem",
+        "1.0 2.0 3.0 4.0x",
+        "1.0,2.0 3.0,4.0",
+        "1.0 nan",
+        "1.0 inf"
+    };
+
+    for ( const char* str : invalid )
+    {
+        mc::Table<double,double> tab;
+        tab.SetFromString(str);
+        EXPECT_FALSE(tab.IsValid()) << str;
+        EXPECT_EQ(tab.size(), 1) << str;
+    }
+
+    mc::Table<double,double> tab;
+    tab.SetFromString("\t+1.0 -2.0\r\n 2.0 1e1 ");
+    EXPECT_TRUE(tab.IsValid());
+    EXPECT_EQ(tab.size(), 2);
+    EXPECT_DOUBLE_EQ(tab.GetValue(1.0), -2.0);
+    EXPECT_DOUBLE_EQ(tab.GetValue(2.0), 10.0);
+}
+
 TEST_F(TestTable, CanAdd)
 {
     mc::Table<double,double> tab;
@@ -462,6 +1121,36 @@ TEST_F(TestTable, CanAdd)
     }
 }
 
+TEST_F(TestTable, CanAddTablesOfDifferentKeys)
+{
+    std::vector<double> k1 { -2.0, -1.0,  0.0,  1.0,  2.0,  3.0 };
+    std::vector<double> t1 {  1.0,  0.0, -1.0,  0.0,  3.0,  8.0 }; // y = x^2 - 1
+    std::vector<double> k2 { -1.5, -0.5,  0.5,  1.0,  1.2,  1.4,  2.5 };
+    std::vector<double> t2 {  3.0,  1.0,  0.0,  2.0,  5.0, -1.0,  4.0 };
+
+    mc::Table<double,double> tab1(k1, t1);
+    mc::Table<double,double> tab2(k2, t2);
+
+    mc::Table<double,double> tab = tab1 + tab2;
+
+    EXPECT_EQ(tab.size(), k1.size());
+
+    for ( unsigned int i = 0; i < tab.size(); ++i )
+    {
+        EXPECT_DOUBLE_EQ(tab.GetKeyByIndex(i), k1[i]);
+        EXPECT_DOUBLE_EQ(tab.GetValue(k1[i]), t1[i] + tab2.GetValue(k1[i]));
+    }
+
+    // cubic interpolation of the added table
+    tab2.SetInterpolation(mc::TableInterpolation::Akima);
+    tab = tab1 + tab2;
+
+    for ( unsigned int i = 0; i < tab.size(); ++i )
+    {
+        EXPECT_DOUBLE_EQ(tab.GetValue(k1[i]), t1[i] + tab2.GetValue(k1[i]));
+    }
+}
+
 TEST_F(TestTable, CanMultiply)
 {
     mc::Table<double,double> tab;
@@ -485,6 +1174,88 @@ TEST_F(TestTable, CanMultiply)
     EXPECT_DOUBLE_EQ(tab.GetValue(1.5), 3.0);
 }
 
+TEST_F(TestTable, CanShareDataBetweenCopies)
+{
+    // y = x^2 - 1
+    std::vector<double> key_values { -2.0, -1.0,  0.0,  1.0,  2.0,  3.0 };
+    std::vector<double> table_data {  1.0,  0.0, -1.0,  0.0,  3.0,  8.0 };
+
+    mc::Table<double,double> tab(key_values, table_data);
+    EXPECT_FALSE(tab.IsShared());
+
+    mc::Table<double,double> tab1(tab);
+    mc::Table<double,double> tab2;
+    tab2 = tab;
+    mc::Table<double,double> tab3(tab);
+    mc::Table<double,double> tab4(tab);
+    EXPECT_TRUE(tab.IsShared());
+    EXPECT_TRUE(tab1.IsShared());
+
+    tab1.MultiplyValues(2.0);
+    tab2.MultiplyKeys(2.0);
+    tab3.SetInterpolation(mc::TableInterpolation::Akima);
+    tab4.SetData(key_values, std::vector<double>(key_values.size(), 0.0));
+    EXPECT_FALSE(tab1.IsShared());
+    EXPECT_FALSE(tab2.IsShared());
+    EXPECT_FALSE(tab3.IsShared());
+    EXPECT_FALSE(tab4.IsShared());
+    EXPECT_FALSE(tab.IsShared());
+
+    for ( unsigned int i = 0; i < tab.size(); ++i )
+    {
+        EXPECT_DOUBLE_EQ(tab.GetValue(key_values[i]), table_data[i]);
+        EXPECT_DOUBLE_EQ(tab1.GetValue(key_values[i]), 2.0 * table_data[i]);
+        EXPECT_DOUBLE_EQ(tab2.GetValue(2.0 * key_values[i]), table_data[i]);
+        EXPECT_DOUBLE_EQ(tab3.GetValue(key_values[i]), table_data[i]);
+        EXPECT_DOUBLE_EQ(tab4.GetValue(key_values[i]), 0.0);
+    }
+
+    EXPECT_EQ(tab.GetInterpolation(), mc::TableInterpolation::Linear);
+    EXPECT_DOUBLE_EQ(tab.GetValue(1.5), 1.5);
+}
+
+TEST_F(TestTable, CanUseSinglePrecision)
+{
+    std::vector<double> key_values { -2.0, -1.0,  0.0,  1.5,  2.0,  3.0 };
+    std::vector<double> table_data {  1.0,  0.0, -1.0,  0.5,  3.0,  8.0 };
+
+    std::vector<float> key_values_f(key_values.begin(), key_values.end());
+    std::vector<float> table_data_f(table_data.begin(), table_data.end());
+
+    std::vector<units::length::meter_t> table_data_u;
+    for ( double v : table_data ) table_data_u.push_back(units::length::meter_t(v));
+
+    mc::Table<double,double> tab(key_values, table_data);
+    mc::Table<float,float> tab_f(key_values_f, table_data_f);
+    mc::Table<float,units::length::meter_t> tab_u(key_values_f, table_data_u);
+
+    EXPECT_TRUE(tab_f.IsValid());
+
+    for ( mc::TableInterpolation interpolation : { mc::TableInterpolation::Linear,
+                                                   mc::TableInterpolation::MonotoneCubic,
+                                                   mc::TableInterpolation::Akima } )
+    {
+        tab.SetInterpolation(interpolation);
+        tab_f.SetInterpolation(interpolation);
+        tab_u.SetInterpolation(interpolation);
+
+        for ( double x = -2.5; x <= 3.5; x += 0.05 )
+        {
+            EXPECT_NEAR(tab_f.GetValue(static_cast<float>(x)), tab.GetValue(x), 1.0e-5) << "x= " << x;
+            EXPECT_NEAR(tab_u.GetValue(static_cast<float>(x))(), tab.GetValue(x), 1.0e-5) << "x= " << x;
+        }
+    }
+
+    std::vector<char> binary = tab_f.ToBinary();
+    mc::Table<float,float> tab_b;
+    EXPECT_EQ(tab_b.SetFromBinary(binary.data(), binary.size()), mc::Result::Success);
+    EXPECT_FLOAT_EQ(tab_b.GetValue(0.75f), tab_f.GetValue(0.75f));
+
+    // binary data of double precision table is rejected
+    std::vector<char> binary_d = tab.ToBinary();
+    EXPECT_EQ(tab_b.SetFromBinary(binary_d.data(), binary_d.size()), mc::Result::Failure);
+}
+
 TEST_F(TestTable, CanAssign)
 {
     // y = x^2 - 1
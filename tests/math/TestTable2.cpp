@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <cmath>
 
 #include <mcutils/math/Table2.h>
@@ -213,6 +214,126 @@ TEST_F(TestTable2, CanGetTable)
     EXPECT_DOUBLE_EQ(tab1.GetValue(  2.0 ),  4.0);
 }
 
+TEST_F(TestTable2, CanUseSinglePrecision)
+{
+    std::vector<double> r { -1.0,  0.0,  1.0,  2.5 };
+    std::vector<double> c {  0.0,  1.0,  3.0 };
+    std::vector<double> v
+    {
+        0.0,  1.0,  2.0,
+       -1.0,  0.0,  4.0,
+        0.0,  1.0, -2.0,
+        3.0,  4.0,  1.0
+    };
+
+    mc::Table2<double,double,double> tab(r, c, v);
+    mc::Table2<float,float,float> tab_f(std::vector<float>(r.begin(), r.end()),
+                                       std::vector<float>(c.begin(), c.end()),
+                                       std::vector<float>(v.begin(), v.end()));
+
+    EXPECT_TRUE(tab_f.IsValid());
+
+    for ( double x = -2.0; x <= 3.0; x += 0.1 )
+    {
+        for ( double y = -1.0; y <= 4.0; y += 0.1 )
+        {
+            const float xf = static_cast<float>(x);
+            const float yf = static_cast<float>(y);
+            EXPECT_NEAR(tab_f.GetValue(xf, yf), tab.GetValue(xf, yf), 1.0e-5) << "x= " << x << " y= " << y;
+            EXPECT_NEAR(tab_f.GetSlice(yf).GetValue(xf), tab.GetValue(xf, yf), 1.0e-5) << "x= " << x << " y= " << y;
+        }
+    }
+
+    std::vector<char> binary = tab_f.ToBinary();
+    mc::Table2<float,float,float> tab_b;
+    EXPECT_EQ(tab_b.SetFromBinary(binary.data(), binary.size()), mc::Result::Success);
+    EXPECT_FLOAT_EQ(tab_b.GetValue(0.5f, 2.0f), tab_f.GetValue(0.5f, 2.0f));
+}
+
+TEST_F(TestTable2, CanGetSlice)
+{
+    std::vector<double> r { -1.0,  0.0,  1.0,  2.5 };
+    std::vector<double> c {  0.0,  1.0,  3.0 };
+    std::vector<double> v
+    {
+        0.0,  1.0,  2.0,
+       -1.0,  0.0,  4.0,
+        0.0,  1.0, -2.0,
+        3.0,  4.0,  1.0
+    };
+
+    mc::Table2<double,double,double> tab(r, c, v);
+
+    for ( double y = -1.0; y <= 4.0; y += 0.25 )
+    {
+        mc::Table2Slice<double,double,double> slice = tab.GetSlice(y);
+        mc::Table<double,double> tab1 = tab.GetTable(y);
+
+        EXPECT_EQ(slice.size(), r.size());
+        EXPECT_DOUBLE_EQ(slice.GetColValue(), y);
+
+        for ( unsigned int i = 0; i < slice.size(); ++i )
+        {
+            EXPECT_DOUBLE_EQ(slice.GetKeyByIndex(i), r[i]);
+            EXPECT_NEAR(slice.GetValueByIndex(i), tab1.GetValueByIndex(i), 1.0e-12);
+        }
+
+        mc::TableCursor cursor;
+        for ( double x = -2.0; x <= 3.0; x += 0.1 )
+        {
+            EXPECT_NEAR(slice.GetValue(x), tab.GetValueStateless(x, y), 1.0e-12) << "x= " << x << " y= " << y;
+            EXPECT_NEAR(slice.GetValue(x, &cursor), tab1.GetValue(x), 1.0e-12) << "x= " << x << " y= " << y;
+            EXPECT_NEAR(slice.GetValueStateless(x), tab1.GetValue(x), 1.0e-12) << "x= " << x << " y= " << y;
+        }
+    }
+
+    mc::Table2Slice<double,double,double> slice = tab.GetSlice(0.5);
+
+    // slice is not affected by later table modifications
+    tab.MultiplyValues(2.0);
+    EXPECT_DOUBLE_EQ(slice.GetValue(0.0), -0.5);
+    EXPECT_DOUBLE_EQ(tab.GetSlice(0.5).GetValue(0.0), -1.0);
+
+    mc::Table2Slice<double,double,double> empty;
+    EXPECT_EQ(empty.size(), 0);
+    EXPECT_TRUE(std::isnan(empty.GetValue(0.0)));
+    EXPECT_TRUE(std::isnan(empty.GetKeyByIndex(0)));
+}
+
+TEST_F(TestTable2, CanGetTableCached)
+{
+    std::vector<double> r { -1.0,  0.0,  1.0 };
+    std::vector<double> c {  0.0,  1.0 };
+    std::vector<double> v
+    {
+        0.0,  1.0,
+       -1.0,  0.0,
+        2.0,  4.0
+    };
+
+    mc::Table2<double,double,double> tab(r, c, v);
+    mc::Table2SliceCache<double,double,double> cache;
+
+    const mc::Table<double,double>& tab1 = tab.GetTable(0.5, &cache);
+    EXPECT_DOUBLE_EQ(tab1.GetValue(1.0), 3.0);
+
+    // same column key, cached table is reused
+    const mc::Table<double,double>* ptr = &tab.GetTable(0.5, &cache);
+    EXPECT_EQ(ptr, &cache.table);
+    EXPECT_DOUBLE_EQ(ptr->GetValue(1.0), 3.0);
+
+    // different column key
+    EXPECT_DOUBLE_EQ(tab.GetTable(1.0, &cache).GetValue(1.0), 4.0);
+
+    // modified table data
+    tab.MultiplyValues(2.0);
+    EXPECT_DOUBLE_EQ(tab.GetTable(1.0, &cache).GetValue(1.0), 8.0);
+
+    // different table
+    mc::Table2<double,double,double> tab2(r, c, v);
+    EXPECT_DOUBLE_EQ(tab2.GetTable(1.0, &cache).GetValue(1.0), 4.0);
+}
+
 TEST_F(TestTable2, CanGetValue)
 {
     // z = x^2 + y - 1
@@ -276,6 +397,65 @@ TEST_F(TestTable2, CanGetValueOutOfRange)
     EXPECT_DOUBLE_EQ(tab.GetValue(  0.0, -1.0 ), -1.0);
 }
 
+TEST_F(TestTable2, CanGetValueWithCursor)
+{
+    std::vector<double> r { -2.0, -1.0, -0.5,  0.0,  1.0,  1.5,  3.0 };
+    std::vector<double> c {  0.0,  0.5,  1.0,  2.0,  4.0 };
+    std::vector<double> v;
+
+    for ( unsigned int ir = 0; ir < r.size(); ++ir )
+    {
+        for ( unsigned int ic = 0; ic < c.size(); ++ic )
+        {
+            v.push_back(std::sin(r[ir]) * std::cos(c[ic]) + r[ir] * c[ic]);
+        }
+    }
+
+    mc::Table2<double,double,double> tab(r, c, v);
+
+    // reference bilinear interpolation
+    auto ref = [&](double x, double y)
+    {
+        x = std::min(std::max(x, r.front()), r.back());
+        y = std::min(std::max(y, c.front()), c.back());
+        unsigned int ir = 0;
+        unsigned int ic = 0;
+        while ( ir + 2 < r.size() && x >= r[ir + 1] ) ++ir;
+        while ( ic + 2 < c.size() && y >= c[ic + 1] ) ++ic;
+        double fx = (x - r[ir]) / (r[ir + 1] - r[ir]);
+        double fy = (y - c[ic]) / (c[ic + 1] - c[ic]);
+        double z1 = v[ ir      * c.size() + ic] * (1.0 - fy) + v[ ir      * c.size() + ic + 1] * fy;
+        double z2 = v[(ir + 1) * c.size() + ic] * (1.0 - fy) + v[(ir + 1) * c.size() + ic + 1] * fy;
+        return z1 * (1.0 - fx) + z2 * fx;
+    };
+
+    mc::Table2Cursor cursor;
+
+    // sweeping forward, backward and jumping
+    std::vector<double> xs;
+    for ( double x = -2.5; x <= 3.5; x += 0.1 ) xs.push_back(x);
+    for ( double x =  3.5; x >= -2.5; x -= 0.1 ) xs.push_back(x);
+    for ( int i = 0; i < 50; ++i ) xs.push_back(-2.5 + std::fmod(i * 2.37, 6.0));
+
+    for ( unsigned int i = 0; i < xs.size(); ++i )
+    {
+        double x = xs[i];
+        double y = -0.5 + std::fmod(i * 0.13, 5.0);
+        EXPECT_NEAR(tab.GetValue(x, y), ref(x, y), 1.0e-12) << x << " " << y;
+        EXPECT_NEAR(tab.GetValue(x, y, &cursor), ref(x, y), 1.0e-12) << x << " " << y;
+        EXPECT_NEAR(tab.GetValueStateless(x, y), ref(x, y), 1.0e-12) << x << " " << y;
+    }
+
+    // last keys
+    EXPECT_DOUBLE_EQ(tab.GetValue(r.back(), c.back()), v.back());
+    EXPECT_DOUBLE_EQ(tab.GetValue(r.back(), c.back(), &cursor), v.back());
+
+    // invalid cursor
+    cursor.row = 100;
+    cursor.col = 100;
+    EXPECT_NEAR(tab.GetValue(0.2, 0.7, &cursor), ref(0.2, 0.7), 1.0e-12);
+}
+
 TEST_F(TestTable2, CanGetValueByIndex)
 {
     mc::Table2<double,double,double> tab0;
@@ -482,6 +662,130 @@ TEST_F(TestTable2, CanSetDataFromString)
     EXPECT_FALSE(tab2.IsValid());
 }
 
+TEST_F(TestTable2, CanSetFromBinary)
+{
+    // z = x^2 + y - 1
+    std::vector<double> r { 0.0, 1.0, 2.0 };
+    std::vector<double> c { 0.0, 1.0 };
+    std::vector<double> v { -1.0, 0.0,
+                             0.0, 1.0,
+                             3.0, 4.0 };
+
+    mc::Table2<double,double,double> tab0(r, c, v);
+    std::vector<char> bin = tab0.ToBinary();
+
+    mc::Table2<double,double,double> tab;
+    EXPECT_EQ(tab.SetFromBinary(bin.data(), bin.size()), mc::Result::Success);
+    EXPECT_FALSE(tab.IsWrapped());
+    EXPECT_TRUE(tab.IsValid());
+    EXPECT_EQ(tab.rows(), 3);
+    EXPECT_EQ(tab.cols(), 2);
+
+    for ( int ir = 0; ir < 30; ++ir )
+    {
+        for ( int ic = 0; ic < 15; ++ic )
+        {
+            double x = -0.5 + 0.1 * ir;
+            double y = -0.2 + 0.1 * ic;
+            EXPECT_DOUBLE_EQ(tab.GetValue(x, y), tab0.GetValue(x, y));
+        }
+    }
+
+    // invalid data
+    std::vector<char> bin1 = bin;
+    bin1[0] = 'X';
+    EXPECT_EQ(tab.SetFromBinary(bin1.data(), bin1.size()), mc::Result::Failure);
+    EXPECT_EQ(tab.SetFromBinary(bin.data(), bin.size() - 1), mc::Result::Failure);
+
+    mc::Table<double,double> tab1d;
+    std::vector<char> bin2 = tab1d.ToBinary();
+    EXPECT_EQ(tab.SetFromBinary(bin2.data(), bin2.size()), mc::Result::Failure);
+
+    EXPECT_EQ(tab.rows(), 3);
+    EXPECT_EQ(tab.cols(), 2);
+}
+
+TEST_F(TestTable2, CanWrapBinary)
+{
+    // z = x^2 + y - 1
+    std::vector<double> r { 0.0, 1.0, 2.0 };
+    std::vector<double> c { 0.0, 1.0 };
+    std::vector<double> v { -1.0, 0.0,
+                             0.0, 1.0,
+                             3.0, 4.0 };
+
+    mc::Table2<double,double,double> tab0(r, c, v);
+    std::vector<char> bin = tab0.ToBinary();
+
+    struct alignas(mc::kTableBinaryAlignment) Block { char data[mc::kTableBinaryAlignment]; };
+    std::vector<Block> buffer(bin.size() / sizeof(Block) + 1);
+    char* data = reinterpret_cast<char*>(buffer.data());
+    std::copy(bin.begin(), bin.end(), data);
+
+    mc::Table2<double,double,double> tab;
+    EXPECT_EQ(tab.WrapBinary(data, bin.size()), mc::Result::Success);
+    EXPECT_TRUE(tab.IsWrapped());
+    EXPECT_DOUBLE_EQ(tab.GetValue(1.5, 0.5), tab0.GetValue(1.5, 0.5));
+
+    // copies share wrapped data
+    mc::Table2<double,double,double> tab1(tab);
+    EXPECT_TRUE(tab1.IsWrapped());
+    EXPECT_DOUBLE_EQ(tab1.GetValue(1.5, 0.5), tab0.GetValue(1.5, 0.5));
+
+    mc::Table2<double,double,double> tab2(std::move(tab));
+    EXPECT_TRUE(tab2.IsWrapped());
+
+    tab2.MultiplyValues(2.0);
+    EXPECT_FALSE(tab2.IsWrapped());
+    EXPECT_DOUBLE_EQ(tab2.GetValue(1.5, 0.5), 2.0 * tab0.GetValue(1.5, 0.5));
+
+    // wrapped data unchanged
+    mc::Table2<double,double,double> tab3;
+    EXPECT_EQ(tab3.WrapBinary(data, bin.size()), mc::Result::Success);
+    EXPECT_DOUBLE_EQ(tab3.GetValue(1.5, 0.5), tab0.GetValue(1.5, 0.5));
+    tab3 = tab0;
+    EXPECT_FALSE(tab3.IsWrapped());
+}
+
+TEST_F(TestTable2, CanConvertTable2ToBinary)
+{
+    char str[] =
+    { R"##(
+             1.0  2.0  3.0
+        1.0  2.0  3.0  4.0
+        2.0  3.0  4.0  5.0
+    )##" };
+
+    std::vector<char> bin = mc::ConvertTable2ToBinary<double,double,double>(str);
+
+    mc::Table2<double,double,double> tab;
+    EXPECT_EQ(tab.SetFromBinary(bin.data(), bin.size()), mc::Result::Success);
+    EXPECT_EQ(tab.rows(), 2);
+    EXPECT_EQ(tab.cols(), 3);
+    EXPECT_DOUBLE_EQ(tab.GetValue(1.5, 2.5), 4.0);
+}
+
+TEST_F(TestTable2, CanSetDataFromInvalidString)
+{
+    const char* invalid[] = {
+        "",
+        "1.0 2.0\n1.0 2.0",
+        "1.0 2.0\n1.0 2.0 3.0\n2.0",
+        "1.0 2.0\n1.0 2.0 3.0 lorem",
+        "1.0 2.0\n1.0 2.0 3.0x",
+        "1.0 lorem\n1.0 2.0 3.0"
+    };
+
+    for ( const char* str : invalid )
+    {
+        mc::Table2<double,double,double> tab;
+        tab.SetFromString(str);
+        EXPECT_FALSE(tab.IsValid()) << str;
+        EXPECT_EQ(tab.rows(), 1) << str;
+        EXPECT_EQ(tab.cols(), 1) << str;
+    }
+}
+
 TEST_F(TestTable2, CanConvertToString)
 {
     // z = x^2 + y - 1
@@ -496,6 +800,52 @@ TEST_F(TestTable2, CanConvertToString)
     EXPECT_STREQ(tab.ToString().c_str(), "\t0\t1\n0\t0\t1\n1\t2\t3\n2\t4\t5\n");
 }
 
+TEST_F(TestTable2, CanShareDataBetweenCopies)
+{
+    // z = x^2 + y - 1
+    std::vector<double> r { -1.0,  0.0,  1.0,  2.0 };
+    std::vector<double> c {  0.0,  1.0 };
+    std::vector<double> v {  0.0,  1.0,
+                            -1.0,  0.0,
+                             0.0,  1.0,
+                             3.0,  4.0 };
+
+    mc::Table2<double,double,double> tab(r, c, v);
+    EXPECT_FALSE(tab.IsShared());
+
+    mc::Table2<double,double,double> tab1(tab);
+    mc::Table2<double,double,double> tab2;
+    tab2 = tab;
+    mc::Table2<double,double,double> tab3(tab);
+    mc::Table2<double,double,double> tab4(tab);
+    EXPECT_TRUE(tab.IsShared());
+    EXPECT_TRUE(tab1.IsShared());
+
+    tab1.MultiplyValues(2.0);
+    tab2.MultiplyRows(2.0);
+    tab3.MultiplyCols(2.0);
+    tab4.SetData(r, c, std::vector<double>(v.size(), 0.0));
+    EXPECT_FALSE(tab1.IsShared());
+    EXPECT_FALSE(tab2.IsShared());
+    EXPECT_FALSE(tab3.IsShared());
+    EXPECT_FALSE(tab4.IsShared());
+    EXPECT_FALSE(tab.IsShared());
+
+    auto fun = [&](int ir, int ic){ return r[ir]*r[ir] + c[ic] - 1.0; };
+
+    for ( unsigned int ir = 0; ir < tab.rows(); ++ir )
+    {
+        for ( unsigned int ic = 0; ic < tab.cols(); ++ic )
+        {
+            EXPECT_DOUBLE_EQ(tab.GetValue(r[ir], c[ic]), fun(ir,ic));
+            EXPECT_DOUBLE_EQ(tab1.GetValue(r[ir], c[ic]), 2.0 * fun(ir,ic));
+            EXPECT_DOUBLE_EQ(tab2.GetValue(2.0 * r[ir], c[ic]), fun(ir,ic));
+            EXPECT_DOUBLE_EQ(tab3.GetValue(r[ir], 2.0 * c[ic]), fun(ir,ic));
+            EXPECT_DOUBLE_EQ(tab4.GetValue(r[ir], c[ic]), 0.0);
+        }
+    }
+}
+
 TEST_F(TestTable2, CanAssign)
 {
     mc::Table2<double,double,double> tab;
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+
+#include <mcutils/math/TableBinary.h>
+
+class TestTableBinary : public ::testing::Test
+{
+protected:
+    TestTableBinary() {}
+    virtual ~TestTableBinary() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(TestTableBinary, CanAlignTableBinaryOffset)
+{
+    EXPECT_EQ(mc::AlignTableBinaryOffset(0), 0);
+    EXPECT_EQ(mc::AlignTableBinaryOffset(1), mc::kTableBinaryAlignment);
+    EXPECT_EQ(mc::AlignTableBinaryOffset(mc::kTableBinaryAlignment), mc::kTableBinaryAlignment);
+    EXPECT_EQ(mc::AlignTableBinaryOffset(mc::kTableBinaryAlignment + 1), 2 * mc::kTableBinaryAlignment);
+}
+
+TEST_F(TestTableBinary, CanInitTableBinaryHeader)
+{
+    const std::uint64_t lengths[] = { 24, 0, 100 };
+
+    mc::TableBinaryHeader header;
+    mc::InitTableBinaryHeader(&header, lengths, 3);
+
+    EXPECT_EQ(std::memcmp(header.magic, "MCTB", 4), 0);
+    EXPECT_EQ(header.endianness, mc::kTableBinaryEndianness);
+    EXPECT_EQ(header.version, mc::kTableBinaryVersion);
+
+    EXPECT_EQ(header.offset[0] % mc::kTableBinaryAlignment, 0);
+    EXPECT_GE(header.offset[0], sizeof(mc::TableBinaryHeader));
+    EXPECT_EQ(header.length[0], 24);
+
+    EXPECT_EQ(header.offset[1], 0);
+    EXPECT_EQ(header.length[1], 0);
+
+    EXPECT_EQ(header.offset[2], header.offset[0] + mc::kTableBinaryAlignment);
+    EXPECT_EQ(header.length[2], 100);
+
+    EXPECT_EQ(header.offset[3], 0);
+    EXPECT_EQ(header.size, header.offset[2] + 2 * mc::kTableBinaryAlignment);
+}
+
+TEST_F(TestTableBinary, CanWriteAndReadTableBinary)
+{
+    const double keys[] = { 1.0, 2.0, 3.0 };
+    const double vals[] = { 4.0, 5.0, 6.0, 7.0 };
+
+    const std::uint64_t lengths[] = { sizeof(keys), sizeof(vals) };
+    const void* sections[] = { keys, vals };
+
+    mc::TableBinaryHeader header;
+    mc::InitTableBinaryHeader(&header, lengths, 2);
+    header.dimensions = 1;
+    header.count[0] = 3;
+
+    std::vector<char> bin = mc::WriteTableBinary(header, sections);
+    EXPECT_EQ(bin.size(), header.size);
+
+    mc::TableBinaryHeader header_read;
+    EXPECT_EQ(mc::ReadTableBinaryHeader(bin.data(), bin.size(), &header_read), mc::Result::Success);
+    EXPECT_EQ(header_read.dimensions, 1);
+    EXPECT_EQ(header_read.count[0], 3);
+    EXPECT_EQ(std::memcmp(bin.data() + header_read.offset[0], keys, sizeof(keys)), 0);
+    EXPECT_EQ(std::memcmp(bin.data() + header_read.offset[1], vals, sizeof(vals)), 0);
+}
+
+TEST_F(TestTableBinary, CanNotReadInvalidTableBinary)
+{
+    const double keys[] = { 1.0, 2.0, 3.0 };
+
+    const std::uint64_t lengths[] = { sizeof(keys) };
+    const void* sections[] = { keys };
+
+    mc::TableBinaryHeader header;
+    mc::InitTableBinaryHeader(&header, lengths, 1);
+
+    std::vector<char> bin = mc::WriteTableBinary(header, sections);
+
+    mc::TableBinaryHeader header_read;
+    EXPECT_EQ(mc::ReadTableBinaryHeader(nullptr, bin.size(), &header_read), mc::Result::Failure);
+    EXPECT_EQ(mc::ReadTableBinaryHeader(bin.data(), sizeof(mc::TableBinaryHeader) - 1, &header_read), mc::Result::Failure);
+    EXPECT_EQ(mc::ReadTableBinaryHeader(bin.data(), bin.size() - 1, &header_read), mc::Result::Failure);
+
+    mc::TableBinaryHeader header_bad = header;
+    header_bad.version = mc::kTableBinaryVersion + 1;
+    std::memcpy(bin.data(), &header_bad, sizeof(header_bad));
+    EXPECT_EQ(mc::ReadTableBinaryHeader(bin.data(), bin.size(), &header_read), mc::Result::Failure);
+
+    header_bad = header;
+    header_bad.offset[0] += 8;
+    std::memcpy(bin.data(), &header_bad, sizeof(header_bad));
+    EXPECT_EQ(mc::ReadTableBinaryHeader(bin.data(), bin.size(), &header_read), mc::Result::Failure);
+
+    header_bad = header;
+    header_bad.length[0] = header.size;
+    std::memcpy(bin.data(), &header_bad, sizeof(header_bad));
+    EXPECT_EQ(mc::ReadTableBinaryHeader(bin.data(), bin.size(), &header_read), mc::Result::Failure);
+
+    std::memcpy(bin.data(), &header, sizeof(header));
+    EXPECT_EQ(mc::ReadTableBinaryHeader(bin.data(), bin.size(), &header_read), mc::Result::Success);
+}
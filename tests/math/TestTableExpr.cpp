@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <units.h>
+
+#include <mcutils/math/TableExpr.h>
+
+using namespace units::literals;
+
+class TestTableExpr : public ::testing::Test
+{
+protected:
+    TestTableExpr() {}
+    virtual ~TestTableExpr() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(TestTableExpr, CanGetValue)
+{
+    std::vector<double> k1 { -2.0, -1.0,  0.0,  1.0,  2.0,  3.0 };
+    std::vector<double> t1 {  1.0,  0.0, -1.0,  0.0,  3.0,  8.0 }; // y = x^2 - 1
+    std::vector<double> k2 { -1.5,  0.5,  2.5 };
+    std::vector<double> t2 {  3.0,  1.0, -2.0 };
+
+    mc::Table<double,double> tab1(k1, t1);
+    mc::Table<double,double> tab2(k2, t2);
+
+    auto expr = mc::TableTerm(tab1) * 2.0 - mc::TableTerm(tab2) + 0.5 * mc::TableTerm(tab1);
+
+    for ( double x = -3.0; x <= 4.0; x += 0.05 )
+    {
+        EXPECT_NEAR(expr.GetValue(x), 2.5 * tab1.GetValue(x) - tab2.GetValue(x), 1.0e-12) << x;
+    }
+}
+
+TEST_F(TestTableExpr, CanEvaluate)
+{
+    std::vector<double> k1 { -2.0, -1.0,  0.0,  1.0,  2.0,  3.0 };
+    std::vector<double> t1 {  1.0,  0.0, -1.0,  0.0,  3.0,  8.0 }; // y = x^2 - 1
+    std::vector<double> k2 { -1.5, -1.0,  0.5,  2.5,  4.0 };
+    std::vector<double> t2 {  3.0,  2.0,  1.0, -2.0,  1.0 };
+    std::vector<double> k3 { -2.5,  3.5 };
+    std::vector<double> t3 {  1.0,  2.0 };
+
+    mc::Table<double,double> tab1(k1, t1);
+    mc::Table<double,double> tab2(k2, t2);
+    mc::Table<double,double> tab3(k3, t3);
+
+    auto expr = mc::TableTerm(tab1) + mc::TableTerm(tab2) * 2.0 - mc::TableTerm(tab3);
+
+    mc::Table<double,double> tab = expr.Evaluate();
+
+    // merged keys
+    std::vector<double> keys { -2.5, -2.0, -1.5, -1.0, 0.0, 0.5, 1.0, 2.0, 2.5, 3.0, 3.5, 4.0 };
+    ASSERT_EQ(tab.size(), keys.size());
+
+    for ( unsigned int i = 0; i < tab.size(); ++i )
+    {
+        EXPECT_DOUBLE_EQ(tab.GetKeyByIndex(i), keys[i]);
+    }
+
+    // piecewise linear expression is exactly represented
+    for ( double x = -3.0; x <= 4.5; x += 0.05 )
+    {
+        EXPECT_NEAR(tab.GetValue(x), expr.GetValue(x), 1.0e-12) << x;
+    }
+}
+
+TEST_F(TestTableExpr, CanConvertToTable)
+{
+    std::vector<double> k1 { 0.0, 1.0, 2.0 };
+    std::vector<double> t1 { 0.0, 1.0, 4.0 };
+    std::vector<double> k2 { 0.5, 1.0 };
+    std::vector<double> t2 { 1.0, 3.0 };
+
+    mc::Table<double,double> tab1(k1, t1);
+    mc::Table<double,double> tab2(k2, t2);
+
+    mc::Table<double,double> tab = mc::TableTerm(tab1) + mc::TableTerm(tab2);
+    EXPECT_EQ(tab.size(), 4);
+    EXPECT_DOUBLE_EQ(tab.GetValue(0.75), 2.75);
+
+    tab = mc::TableTerm(tab2) * 3.0;
+    EXPECT_EQ(tab.size(), 2);
+    EXPECT_DOUBLE_EQ(tab.GetValue(0.75), 6.0);
+}
+
+TEST_F(TestTableExpr, CanEvaluateUnits)
+{
+    std::vector<double>                 k1 { 0.0, 1.0, 2.0 };
+    std::vector<units::length::meter_t> t1 { 0_m, 1_m, 4_m };
+    std::vector<double>                 k2 { 0.5, 1.5 };
+    std::vector<units::length::meter_t> t2 { 2_m, 4_m };
+
+    mc::Table<double,units::length::meter_t> tab1(k1, t1);
+    mc::Table<double,units::length::meter_t> tab2(k2, t2);
+
+    mc::Table<double,units::length::meter_t> tab = (mc::TableTerm(tab1) - mc::TableTerm(tab2)).Evaluate();
+
+    EXPECT_EQ(tab.size(), 5);
+    EXPECT_DOUBLE_EQ(tab.GetValue(1.0)(), -2.0);
+    EXPECT_DOUBLE_EQ(tab.GetValue(1.75)(), -0.75);
+}
+
+TEST_F(TestTableExpr, CanEvaluateEmpty)
+{
+    std::vector<double> k1;
+    std::vector<double> t1;
+
+    mc::Table<double,double> tab1(k1, t1);
+    mc::Table<double,double> tab = (mc::TableTerm(tab1) * 2.0).Evaluate();
+
+    EXPECT_EQ(tab.size(), 0);
+}
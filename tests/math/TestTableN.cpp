@@ -0,0 +1,257 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include <units.h>
+
+#include <mcutils/math/TableN.h>
+
+using namespace units::literals;
+
+class TestTableN : public ::testing::Test
+{
+protected:
+    TestTableN() {}
+    virtual ~TestTableN() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(TestTableN, CanInstantiate)
+{
+    mc::TableN<3,double> tab;
+    EXPECT_EQ(tab.size(), 1);
+    EXPECT_EQ(tab.size(0), 1);
+    EXPECT_EQ(tab.size(2), 1);
+    EXPECT_DOUBLE_EQ(tab.GetValue(0.0, 0.0, 0.0), 0.0);
+    EXPECT_DOUBLE_EQ(tab.GetValue(1.0, 2.0, 3.0), 0.0);
+
+    mc::TableN<2,double> tab2(1.1);
+    EXPECT_DOUBLE_EQ(tab2.GetValue(-2.0, 3.0), 1.1);
+}
+
+TEST_F(TestTableN, CanConvertFromTable)
+{
+    std::vector<double> k { -2.0, -1.0,  0.0,  1.5,  2.0,  3.0 };
+    std::vector<double> v {  1.0,  0.0, -1.0,  0.5,  3.0,  8.0 };
+
+    mc::Table<double,double> tab1(k, v);
+    mc::TableN<1,double> tab(tab1);
+
+    EXPECT_EQ(tab.size(), k.size());
+
+    for ( double x = -3.0; x <= 4.0; x += 0.05 )
+    {
+        EXPECT_NEAR(tab.GetValue(x), tab1.GetValue(x), 1.0e-12) << "x= " << x;
+    }
+}
+
+TEST_F(TestTableN, CanConvertFromTable2)
+{
+    std::vector<double> r { -1.0,  0.0,  1.0,  2.5 };
+    std::vector<double> c {  0.0,  1.0,  3.0 };
+    std::vector<double> v {  0.0,  1.0,  2.0,
+                            -1.0,  0.0,  4.0,
+                             0.0,  1.0, -2.0,
+                             3.0,  4.0,  1.0 };
+
+    mc::Table2<double,double,double> tab2(r, c, v);
+    mc::TableN<2,double> tab(tab2);
+
+    EXPECT_EQ(tab.size(0), r.size());
+    EXPECT_EQ(tab.size(1), c.size());
+
+    for ( double x = -2.0; x <= 3.0; x += 0.1 )
+    {
+        for ( double y = -1.0; y <= 4.0; y += 0.1 )
+        {
+            EXPECT_NEAR(tab.GetValue(x, y), tab2.GetValue(x, y), 1.0e-12) << "x= " << x << " y= " << y;
+        }
+    }
+}
+
+TEST_F(TestTableN, CanGetValue)
+{
+    // multilinear function is reproduced exactly
+    auto fun = [](double x, double y, double z)
+    {
+        return 1.0 + 2.0*x - 3.0*y + 0.5*z + x*y - 2.0*y*z + 0.25*x*z + 1.5*x*y*z;
+    };
+
+    std::array<std::vector<double>,3> keys {
+        std::vector<double>{ -1.0, 0.0, 0.5, 2.0 },
+        std::vector<double>{  0.0, 1.0, 3.0 },
+        std::vector<double>{ -2.0, -1.0, 0.0, 1.0, 2.0 }
+    };
+
+    std::vector<double> data;
+    for ( double x : keys[0] )
+        for ( double y : keys[1] )
+            for ( double z : keys[2] )
+                data.push_back(fun(x, y, z));
+
+    mc::TableN<3,double> tab(keys, data);
+    EXPECT_TRUE(tab.IsValid());
+
+    for ( double x = -1.0; x <= 2.0; x += 0.15 )
+    {
+        for ( double y = 0.0; y <= 3.0; y += 0.2 )
+        {
+            for ( double z = -2.0; z <= 2.0; z += 0.25 )
+            {
+                // within single cell function is multilinear
+                EXPECT_NEAR(tab.GetValue(x, y, z), fun(x, y, z), 1.0e-9) << x << " " << y << " " << z;
+                EXPECT_NEAR(tab.GetValueStateless({ x, y, z }), fun(x, y, z), 1.0e-9);
+            }
+        }
+    }
+}
+
+TEST_F(TestTableN, CanGetValue4D)
+{
+    auto fun = [](double a, double b, double c, double d)
+    {
+        return a - b + 2.0*c*d + a*b*c*d;
+    };
+
+    std::array<std::vector<double>,4> keys {
+        std::vector<double>{ 0.0, 1.0, 2.0 },
+        std::vector<double>{ 0.0, 0.5, 2.0 },
+        std::vector<double>{ -1.0, 1.0 },
+        std::vector<double>{ 0.0, 1.0, 1.5, 4.0 }
+    };
+
+    std::vector<double> data;
+    for ( double a : keys[0] )
+        for ( double b : keys[1] )
+            for ( double c : keys[2] )
+                for ( double d : keys[3] )
+                    data.push_back(fun(a, b, c, d));
+
+    mc::TableN<4,double> tab(keys, data);
+
+    mc::TableNCursor<4> cursor;
+    for ( double a = 0.0; a <= 2.0; a += 0.3 )
+        for ( double b = 0.0; b <= 2.0; b += 0.3 )
+            for ( double c = -1.0; c <= 1.0; c += 0.5 )
+                for ( double d = 0.0; d <= 4.0; d += 0.4 )
+                    EXPECT_NEAR(tab.GetValue({ a, b, c, d }, &cursor), fun(a, b, c, d), 1.0e-9);
+}
+
+TEST_F(TestTableN, CanGetValueOutOfRange)
+{
+    std::array<std::vector<double>,2> keys {
+        std::vector<double>{ 0.0, 1.0 },
+        std::vector<double>{ 0.0, 1.0, 2.0 }
+    };
+    std::vector<double> data { 1.0, 2.0, 3.0,
+                               4.0, 5.0, 6.0 };
+
+    mc::TableN<2,double> tab(keys, data);
+
+    EXPECT_DOUBLE_EQ(tab.GetValue(-1.0, -1.0), 1.0);
+    EXPECT_DOUBLE_EQ(tab.GetValue( 2.0,  3.0), 6.0);
+    EXPECT_DOUBLE_EQ(tab.GetValue(-1.0,  1.5), 2.5);
+    EXPECT_DOUBLE_EQ(tab.GetValue( 0.5,  9.0), 4.5);
+}
+
+TEST_F(TestTableN, CanGetValues)
+{
+    std::array<std::vector<double>,3> keys {
+        std::vector<double>{ 0.0, 1.0, 2.0, 3.0, 4.0 },       // uniform
+        std::vector<double>{ 0.0, 0.1, 0.5, 2.0 },
+        std::vector<double>{ 5.0 }                             // single key
+    };
+
+    std::vector<double> data;
+    for ( double x : keys[0] )
+        for ( double y : keys[1] )
+            data.push_back(std::sin(x) + y*y);
+
+    mc::TableN<3,double> tab(keys, data);
+    EXPECT_EQ(tab.size(), 20);
+
+    std::vector<std::array<double,3>> k;
+    for ( double x = -0.5; x <= 4.5; x += 0.1 )
+        k.push_back({ x, 0.3 * x, 1.0 });
+
+    std::vector<double> values = tab.GetValues(k);
+    ASSERT_EQ(values.size(), k.size());
+
+    for ( unsigned int i = 0; i < k.size(); ++i )
+    {
+        EXPECT_DOUBLE_EQ(values[i], tab.GetValueStateless(k[i])) << "i= " << i;
+    }
+}
+
+TEST_F(TestTableN, CanGetValueUnits)
+{
+    std::array<std::vector<double>,2> keys {
+        std::vector<double>{ 0.0, 1.0 },
+        std::vector<double>{ 0.0, 2.0 }
+    };
+    std::vector<units::length::meter_t> data { 0.0_m, 2.0_m,
+                                               1.0_m, 3.0_m };
+
+    mc::TableN<2,units::length::meter_t> tab(keys, data);
+
+    EXPECT_DOUBLE_EQ(tab.GetValue(0.5, 1.0)(), 1.5);
+    EXPECT_DOUBLE_EQ(tab.GetValueByIndex({ 1, 1 })(), 3.0);
+}
+
+TEST_F(TestTableN, CanGetKeyAndValueByIndex)
+{
+    std::array<std::vector<double>,2> keys {
+        std::vector<double>{ 0.0, 1.0 },
+        std::vector<double>{ 0.0, 1.0, 2.0 }
+    };
+    std::vector<double> data { 1.0, 2.0, 3.0,
+                               4.0, 5.0, 6.0 };
+
+    mc::TableN<2,double> tab(keys, data);
+
+    EXPECT_DOUBLE_EQ(tab.GetKeyByIndex(1, 2), 2.0);
+    EXPECT_DOUBLE_EQ(tab.GetValueByIndex({ 1, 0 }), 4.0);
+    EXPECT_TRUE(std::isnan(tab.GetKeyByIndex(0, 2)));
+    EXPECT_TRUE(std::isnan(tab.GetKeyByIndex(2, 0)));
+    EXPECT_TRUE(std::isnan(tab.GetValueByIndex({ 2, 0 })));
+}
+
+TEST_F(TestTableN, CanHandleInvalidData)
+{
+    std::array<std::vector<double>,2> keys {
+        std::vector<double>{ 0.0, 1.0 },
+        std::vector<double>{ 0.0, 1.0, 2.0 }
+    };
+    std::vector<double> data { 1.0, 2.0, 3.0, 4.0 };
+
+    mc::TableN<2,double> tab(keys, data);
+
+    EXPECT_EQ(tab.size(), 0);
+    EXPECT_FALSE(tab.IsValid());
+    EXPECT_TRUE(std::isnan(tab.GetValue(0.5, 0.5)));
+}
+
+TEST_F(TestTableN, CanShareDataBetweenCopies)
+{
+    std::array<std::vector<double>,2> keys {
+        std::vector<double>{ 0.0, 1.0 },
+        std::vector<double>{ 0.0, 1.0 }
+    };
+    std::vector<double> data { 1.0, 2.0, 3.0, 4.0 };
+
+    mc::TableN<2,double> tab1(keys, data);
+    mc::TableN<2,double> tab2(tab1);
+
+    EXPECT_TRUE(tab1.IsShared());
+    EXPECT_TRUE(tab2.IsShared());
+
+    tab2.MultiplyValues(2.0);
+    tab2.MultiplyKeys(0, 2.0);
+
+    EXPECT_FALSE(tab1.IsShared());
+    EXPECT_DOUBLE_EQ(tab1.GetValue(1.0, 1.0), 4.0);
+    EXPECT_DOUBLE_EQ(tab2.GetValue(1.0, 1.0), 6.0);
+    EXPECT_DOUBLE_EQ(tab2.GetValue(2.0, 1.0), 8.0);
+}
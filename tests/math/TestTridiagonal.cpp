@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+
+#include <mcutils/math/Tridiagonal.h>
+
+class TestTridiagonal : public ::testing::Test
+{
+protected:
+    TestTridiagonal() {}
+    virtual ~TestTridiagonal() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(TestTridiagonal, CanSolve)
+{
+    // chain of 5 nodes, -1 2 -1 stencil
+    // x = 1, 2, 3, 4, 5
+    constexpr unsigned int size = 5;
+
+    mc::TridiagonalMatrix<double, size> m;
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        m(i,i) = 2.0;
+        if (i > 0)        m(i,i-1) = -1.0;
+        if (i < size - 1) m(i,i+1) = -1.0;
+    }
+
+    mc::VectorN<double, size> rhs;
+    rhs.SetFromVector({ 0.0, 0.0, 0.0, 0.0, 6.0 });
+
+    mc::VectorN<double, size> x;
+    EXPECT_EQ(mc::SolveTridiagonal(m, rhs, &x), mc::Result::Success);
+
+    EXPECT_NEAR(x(0), 1.0, 1.0e-9);
+    EXPECT_NEAR(x(1), 2.0, 1.0e-9);
+    EXPECT_NEAR(x(2), 3.0, 1.0e-9);
+    EXPECT_NEAR(x(3), 4.0, 1.0e-9);
+    EXPECT_NEAR(x(4), 5.0, 1.0e-9);
+
+    // in place
+    EXPECT_EQ(mc::SolveTridiagonal(m, rhs, &rhs), mc::Result::Success);
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        EXPECT_NEAR(rhs(i), x(i), 1.0e-12) << "Error at index " << i;
+    }
+}
+
+TEST_F(TestTridiagonal, CanSolveLargeSystem)
+{
+    constexpr unsigned int size = 200;
+
+    mc::TridiagonalMatrix<double, size> m;
+    mc::VectorN<double, size> x_ref;
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        m(i,i) = 4.0 + std::sin(i);
+        if (i > 0)        m(i,i-1) = -1.0 - 0.5 * std::cos(i);
+        if (i < size - 1) m(i,i+1) = -1.0;
+        x_ref(i) = std::cos(0.1 * i);
+    }
+
+    mc::VectorN<double, size> rhs = m * x_ref;
+    mc::VectorN<double, size> x;
+    EXPECT_EQ(mc::SolveTridiagonal(m, rhs, &x), mc::Result::Success);
+
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        EXPECT_NEAR(x(i), x_ref(i), 1.0e-9) << "Error at index " << i;
+    }
+}
+
+TEST_F(TestTridiagonal, CanDetectZeroPivot)
+{
+    mc::TridiagonalMatrix<double, 3> m;
+    m(0,0) = 1.0; m(0,1) = 1.0;
+    m(1,0) = 1.0; m(1,1) = 1.0; m(1,2) = 1.0;
+    m(2,1) = 1.0; m(2,2) = 1.0;
+
+    mc::VectorN<double, 3> rhs;
+    mc::VectorN<double, 3> x;
+    EXPECT_EQ(mc::SolveTridiagonal(m, rhs, &x), mc::Result::Failure);
+}
@@ -331,3 +331,20 @@ TEST_F(TestVector3, CanMultiplyNumberByVector)
     EXPECT_DOUBLE_EQ(r.y(), 0.0);
     EXPECT_DOUBLE_EQ(r.z(), 0.0);
 }
+
+TEST_F(TestVector3, CanUseInConstantExpressions)
+{
+    constexpr mc::Vector3d v1(1.0, 2.0, 3.0);
+    constexpr mc::Vector3d v2 = mc::Vector3d::i() * 2.0 - mc::Vector3d::k();
+    constexpr mc::Vector3d v3 = v1 % v2 + (-v1) / 2.0;
+
+    static_assert(v1 * v2 == -1.0, "Dot product");
+    static_assert(v3.x() == -2.5, "Cross product");
+    static_assert(v3.y() ==  6.0, "Cross product");
+    static_assert(v3.z() == -5.5, "Cross product");
+    static_assert(v1.GetLength2() == 14.0, "Length squared");
+
+    EXPECT_DOUBLE_EQ(v3.x(), -2.5);
+    EXPECT_DOUBLE_EQ(v3.y(),  6.0);
+    EXPECT_DOUBLE_EQ(v3.z(), -5.5);
+}
@@ -0,0 +1,299 @@
+#include <gtest/gtest.h>
+
+#include <mcutils/math/RMatrix.h>
+#include <mcutils/math/Vector3Batch.h>
+#include <mcutils/misc/Arena.h>
+
+using namespace units::literals;
+
+class TestVector3Batch : public ::testing::Test
+{
+protected:
+    TestVector3Batch() {}
+    virtual ~TestVector3Batch() {}
+    void SetUp() override {}
+    void TearDown() override {}
+
+    // size not being a multiple of batch kernels lanes number
+    static constexpr unsigned int kSize = 7;
+
+    static mc::Vector3d GetVector(unsigned int i, double offset = 0.0)
+    {
+        return mc::Vector3d(1.0 + i + offset, 2.0 - 0.5 * i, -3.0 + 0.25 * i * i);
+    }
+
+    static void Fill(mc::Vector3Batch* batch, double offset = 0.0)
+    {
+        for ( unsigned int i = 0; i < batch->size(); ++i )
+        {
+            batch->Set(i, GetVector(i, offset));
+        }
+    }
+};
+
+TEST_F(TestVector3Batch, CanInstantiate)
+{
+    mc::Vector3Batch b(kSize);
+    EXPECT_EQ(b.size(), kSize);
+    EXPECT_EQ(b.GetAllocator(), nullptr);
+    EXPECT_TRUE(b.IsValid());
+
+    for ( unsigned int i = 0; i < b.size(); ++i )
+    {
+        EXPECT_DOUBLE_EQ(b.Get(i).x(), 0.0) << "Error at index " << i;
+        EXPECT_DOUBLE_EQ(b.Get(i).y(), 0.0) << "Error at index " << i;
+        EXPECT_DOUBLE_EQ(b.Get(i).z(), 0.0) << "Error at index " << i;
+    }
+}
+
+TEST_F(TestVector3Batch, CanInstantiateFromArena)
+{
+    mc::Arena arena;
+    mc::Vector3Batch b(kSize, &arena);
+    EXPECT_EQ(b.GetAllocator(), &arena);
+    EXPECT_GE(arena.GetUsed(), 3 * kSize * sizeof(double));
+
+    Fill(&b);
+    mc::Vector3Batch b1(b);
+    EXPECT_EQ(b1.GetAllocator(), &arena);
+    EXPECT_EQ(b1.size(), kSize);
+    for ( unsigned int i = 0; i < b1.size(); ++i )
+    {
+        EXPECT_DOUBLE_EQ(b1.Get(i).x(), GetVector(i).x()) << "Error at index " << i;
+        EXPECT_DOUBLE_EQ(b1.Get(i).y(), GetVector(i).y()) << "Error at index " << i;
+        EXPECT_DOUBLE_EQ(b1.Get(i).z(), GetVector(i).z()) << "Error at index " << i;
+    }
+}
+
+TEST_F(TestVector3Batch, CanSetAndGet)
+{
+    mc::Vector3Batch b(kSize);
+    Fill(&b);
+
+    for ( unsigned int i = 0; i < b.size(); ++i )
+    {
+        mc::Vector3d v = b.Get(i);
+        EXPECT_DOUBLE_EQ(v.x(), GetVector(i).x()) << "Error at index " << i;
+        EXPECT_DOUBLE_EQ(v.y(), GetVector(i).y()) << "Error at index " << i;
+        EXPECT_DOUBLE_EQ(v.z(), GetVector(i).z()) << "Error at index " << i;
+        EXPECT_DOUBLE_EQ(b.x()[i], GetVector(i).x()) << "Error at index " << i;
+        EXPECT_DOUBLE_EQ(b.y()[i], GetVector(i).y()) << "Error at index " << i;
+        EXPECT_DOUBLE_EQ(b.z()[i], GetVector(i).z()) << "Error at index " << i;
+    }
+}
+
+TEST_F(TestVector3Batch, CanSetFromVectorAndGetVector)
+{
+    std::vector<mc::Vector3d> vs;
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        vs.push_back(GetVector(i));
+    }
+
+    mc::Vector3Batch b;
+    b.SetFromVector(vs);
+    EXPECT_EQ(b.size(), kSize);
+
+    std::vector<mc::Vector3d> vs1 = b.GetVector();
+    ASSERT_EQ(vs1.size(), vs.size());
+    for ( unsigned int i = 0; i < vs.size(); ++i )
+    {
+        EXPECT_DOUBLE_EQ(vs1[i].x(), vs[i].x()) << "Error at index " << i;
+        EXPECT_DOUBLE_EQ(vs1[i].y(), vs[i].y()) << "Error at index " << i;
+        EXPECT_DOUBLE_EQ(vs1[i].z(), vs[i].z()) << "Error at index " << i;
+    }
+}
+
+TEST_F(TestVector3Batch, CanResize)
+{
+    mc::Vector3Batch b(kSize);
+    Fill(&b);
+    b.Resize(2 * kSize + 1);
+    EXPECT_EQ(b.size(), 2 * kSize + 1);
+    for ( unsigned int i = 0; i < b.size(); ++i )
+    {
+        EXPECT_DOUBLE_EQ(b.Get(i).GetLength(), 0.0) << "Error at index " << i;
+    }
+}
+
+TEST_F(TestVector3Batch, CanDot)
+{
+    mc::Vector3Batch b1(kSize);
+    mc::Vector3Batch b2(kSize);
+    Fill(&b1);
+    Fill(&b2, 1.5);
+
+    double result[kSize];
+    b1.Dot(b2, result);
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        EXPECT_NEAR(result[i], GetVector(i) * GetVector(i, 1.5), 1.0e-12) << "Error at index " << i;
+    }
+}
+
+TEST_F(TestVector3Batch, CanCross)
+{
+    mc::Vector3Batch b1(kSize);
+    mc::Vector3Batch b2(kSize);
+    mc::Vector3Batch b3(kSize);
+    Fill(&b1);
+    Fill(&b2, 1.5);
+
+    b1.Cross(b2, &b3);
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        mc::Vector3d v = GetVector(i) % GetVector(i, 1.5);
+        EXPECT_NEAR(b3.Get(i).x(), v.x(), 1.0e-12) << "Error at index " << i;
+        EXPECT_NEAR(b3.Get(i).y(), v.y(), 1.0e-12) << "Error at index " << i;
+        EXPECT_NEAR(b3.Get(i).z(), v.z(), 1.0e-12) << "Error at index " << i;
+    }
+}
+
+TEST_F(TestVector3Batch, CanNormalize)
+{
+    mc::Vector3Batch b(kSize);
+    Fill(&b);
+    b.Set(3, mc::Vector3d());
+    b.Normalize();
+
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        mc::Vector3d v = i == 3 ? mc::Vector3d() : GetVector(i).GetNormalized();
+        EXPECT_NEAR(b.Get(i).x(), v.x(), 1.0e-12) << "Error at index " << i;
+        EXPECT_NEAR(b.Get(i).y(), v.y(), 1.0e-12) << "Error at index " << i;
+        EXPECT_NEAR(b.Get(i).z(), v.z(), 1.0e-12) << "Error at index " << i;
+    }
+    EXPECT_TRUE(b.IsValid());
+}
+
+TEST_F(TestVector3Batch, CanMultiplyByMatrix)
+{
+    mc::RMatrix m(mc::Angles(30.0_deg, 45.0_deg, 60.0_deg));
+
+    mc::Vector3Batch b1(kSize);
+    mc::Vector3Batch b2(kSize);
+    Fill(&b1);
+
+    b1.MultiplyByMatrix(m, &b2);
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        mc::Vector3d v = m * GetVector(i);
+        EXPECT_NEAR(b2.Get(i).x(), v.x(), 1.0e-12) << "Error at index " << i;
+        EXPECT_NEAR(b2.Get(i).y(), v.y(), 1.0e-12) << "Error at index " << i;
+        EXPECT_NEAR(b2.Get(i).z(), v.z(), 1.0e-12) << "Error at index " << i;
+    }
+
+    // in place
+    b1.MultiplyByMatrix(m, &b1);
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        EXPECT_NEAR(b1.Get(i).x(), b2.Get(i).x(), 1.0e-12) << "Error at index " << i;
+        EXPECT_NEAR(b1.Get(i).y(), b2.Get(i).y(), 1.0e-12) << "Error at index " << i;
+        EXPECT_NEAR(b1.Get(i).z(), b2.Get(i).z(), 1.0e-12) << "Error at index " << i;
+    }
+}
+
+TEST_F(TestVector3Batch, CanAddScaled)
+{
+    mc::Vector3Batch b1(kSize);
+    mc::Vector3Batch b2(kSize);
+    Fill(&b1);
+    Fill(&b2, 1.5);
+
+    b1.AddScaled(b2, 0.1);
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        mc::Vector3d v = GetVector(i) + 0.1 * GetVector(i, 1.5);
+        EXPECT_NEAR(b1.Get(i).x(), v.x(), 1.0e-12) << "Error at index " << i;
+        EXPECT_NEAR(b1.Get(i).y(), v.y(), 1.0e-12) << "Error at index " << i;
+        EXPECT_NEAR(b1.Get(i).z(), v.z(), 1.0e-12) << "Error at index " << i;
+    }
+}
+
+TEST_F(TestVector3Batch, CanAssign)
+{
+    mc::Vector3Batch b1(kSize);
+    Fill(&b1);
+
+    mc::Vector3Batch b2(kSize + 1);
+    const double* x = b2.x();
+    b2 = b1;
+    EXPECT_EQ(b2.size(), kSize);
+    EXPECT_EQ(b2.x(), x);   // same padded size, no reallocation
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        EXPECT_DOUBLE_EQ(b2.Get(i).x(), GetVector(i).x()) << "Error at index " << i;
+        EXPECT_DOUBLE_EQ(b2.Get(i).y(), GetVector(i).y()) << "Error at index " << i;
+        EXPECT_DOUBLE_EQ(b2.Get(i).z(), GetVector(i).z()) << "Error at index " << i;
+    }
+
+    mc::Vector3Batch b3;
+    b3 = std::move(b2);
+    EXPECT_EQ(b3.size(), kSize);
+    EXPECT_EQ(b3.x(), x);
+    EXPECT_EQ(b2.size(), 0u);
+}
+
+TEST_F(TestVector3Batch, CanUnaryAdd)
+{
+    mc::Vector3Batch b1(kSize);
+    mc::Vector3Batch b2(kSize);
+    Fill(&b1);
+    Fill(&b2, 1.5);
+
+    b1 += b2;
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        mc::Vector3d v = GetVector(i) + GetVector(i, 1.5);
+        EXPECT_DOUBLE_EQ(b1.Get(i).x(), v.x()) << "Error at index " << i;
+        EXPECT_DOUBLE_EQ(b1.Get(i).y(), v.y()) << "Error at index " << i;
+        EXPECT_DOUBLE_EQ(b1.Get(i).z(), v.z()) << "Error at index " << i;
+    }
+}
+
+TEST_F(TestVector3Batch, CanUnarySubstract)
+{
+    mc::Vector3Batch b1(kSize);
+    mc::Vector3Batch b2(kSize);
+    Fill(&b1);
+    Fill(&b2, 1.5);
+
+    b1 -= b2;
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        mc::Vector3d v = GetVector(i) - GetVector(i, 1.5);
+        EXPECT_DOUBLE_EQ(b1.Get(i).x(), v.x()) << "Error at index " << i;
+        EXPECT_DOUBLE_EQ(b1.Get(i).y(), v.y()) << "Error at index " << i;
+        EXPECT_DOUBLE_EQ(b1.Get(i).z(), v.z()) << "Error at index " << i;
+    }
+}
+
+TEST_F(TestVector3Batch, CanUnaryMultiply)
+{
+    mc::Vector3Batch b(kSize);
+    Fill(&b);
+
+    b *= 2.5;
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        mc::Vector3d v = GetVector(i) * 2.5;
+        EXPECT_DOUBLE_EQ(b.Get(i).x(), v.x()) << "Error at index " << i;
+        EXPECT_DOUBLE_EQ(b.Get(i).y(), v.y()) << "Error at index " << i;
+        EXPECT_DOUBLE_EQ(b.Get(i).z(), v.z()) << "Error at index " << i;
+    }
+}
+
+TEST_F(TestVector3Batch, CanUnaryDivide)
+{
+    mc::Vector3Batch b(kSize);
+    Fill(&b);
+
+    b /= 2.0;
+    for ( unsigned int i = 0; i < kSize; ++i )
+    {
+        mc::Vector3d v = GetVector(i) / 2.0;
+        EXPECT_DOUBLE_EQ(b.Get(i).x(), v.x()) << "Error at index " << i;
+        EXPECT_DOUBLE_EQ(b.Get(i).y(), v.y()) << "Error at index " << i;
+        EXPECT_DOUBLE_EQ(b.Get(i).z(), v.z()) << "Error at index " << i;
+    }
+}
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include <mcutils/math/Vector.h>
+#include <mcutils/math/VectorExpr.h>
+
+using namespace units::literals;
+
+class TestVectorExpr : public ::testing::Test
+{
+protected:
+    TestVectorExpr() {}
+    virtual ~TestVectorExpr() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(TestVectorExpr, CanEvaluate)
+{
+    mc::Vector4d v1;
+    mc::Vector4d v2;
+    mc::Vector4d v3;
+    v1.SetFromVector({ 1.0, 2.0, 3.0, 4.0 });
+    v2.SetFromVector({ 0.5, -1.0, 2.0, 0.0 });
+    v3.SetFromVector({ 4.0, 3.0, 2.0, 1.0 });
+
+    mc::Vector4d ref = v1 * 2.0 + v2 - v3 / 4.0 + (-v1);
+    mc::Vector4d v = mc::VectorTerm(v1) * 2.0 + mc::VectorTerm(v2)
+                   - mc::VectorTerm(v3) / 4.0 + (-mc::VectorTerm(v1));
+
+    for (unsigned int i = 0; i < mc::Vector4d::kSize; ++i)
+    {
+        EXPECT_DOUBLE_EQ(v(i), ref(i)) << i;
+    }
+
+    auto expr = 0.5 * mc::VectorTerm(v1) - mc::VectorTerm(v2);
+    mc::Vector4d v_eval = expr.Evaluate();
+
+    for (unsigned int i = 0; i < mc::Vector4d::kSize; ++i)
+    {
+        EXPECT_DOUBLE_EQ(expr(i), 0.5 * v1(i) - v2(i)) << i;
+        EXPECT_DOUBLE_EQ(v_eval(i), 0.5 * v1(i) - v2(i)) << i;
+    }
+}
+
+TEST_F(TestVectorExpr, CanAssign)
+{
+    mc::Vector3d v1(1.0, 2.0, 3.0);
+    mc::Vector3d v2(4.0, 5.0, 6.0);
+
+    mc::Vector3d v;
+    v = mc::VectorTerm(v1) + mc::VectorTerm(v2) * 2.0;
+    EXPECT_DOUBLE_EQ(v.x(),  9.0);
+    EXPECT_DOUBLE_EQ(v.y(), 12.0);
+    EXPECT_DOUBLE_EQ(v.z(), 15.0);
+
+    // assigning to one of the terms
+    v1 = mc::VectorTerm(v2) - mc::VectorTerm(v1);
+    EXPECT_DOUBLE_EQ(v1.x(), 3.0);
+    EXPECT_DOUBLE_EQ(v1.y(), 3.0);
+    EXPECT_DOUBLE_EQ(v1.z(), 3.0);
+
+    (mc::VectorTerm(v2) * 0.5).AssignTo(&v2);
+    EXPECT_DOUBLE_EQ(v2.x(), 2.0);
+    EXPECT_DOUBLE_EQ(v2.y(), 2.5);
+    EXPECT_DOUBLE_EQ(v2.z(), 3.0);
+}
+
+TEST_F(TestVectorExpr, CanUseUnits)
+{
+    mc::Vector3_m v1(1.0_m, 2.0_m, 3.0_m);
+    mc::Vector3_m v2(4.0_m, 5.0_m, 6.0_m);
+
+    mc::Vector3_m v = mc::VectorTerm(v1) * 3.0 - mc::VectorTerm(v2);
+    EXPECT_DOUBLE_EQ(v.x()(), -1.0);
+    EXPECT_DOUBLE_EQ(v.y()(),  1.0);
+    EXPECT_DOUBLE_EQ(v.z()(),  3.0);
+
+    units::length::meter_t length = v.GetLength();
+    EXPECT_DOUBLE_EQ(length(), sqrt(11.0));
+}
@@ -0,0 +1,277 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <mcutils/math/Vector.h>
+#include <mcutils/misc/Arena.h>
+
+class TestVectorX : public ::testing::Test
+{
+protected:
+    TestVectorX() {}
+    virtual ~TestVectorX() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(TestVectorX, CanInstantiate)
+{
+    mc::VectorX<double> v0;
+    EXPECT_EQ(v0.size(), 0u);
+    EXPECT_EQ(v0.data(), nullptr);
+
+    mc::VectorX<double> v(100);
+    EXPECT_EQ(v.size(), 100u);
+    EXPECT_EQ(v.GetAllocator(), nullptr);
+
+    for ( unsigned int i = 0; i < v.size(); ++i )
+    {
+        EXPECT_DOUBLE_EQ(v(i), 0.0) << "Error at index " << i;
+    }
+}
+
+TEST_F(TestVectorX, CanInstantiateFromArena)
+{
+    mc::Arena arena;
+    mc::VectorX<double> v(100, &arena);
+    EXPECT_EQ(v.size(), 100u);
+    EXPECT_EQ(v.GetAllocator(), &arena);
+    EXPECT_GE(arena.GetUsed(), 100 * sizeof(double));
+
+    for ( unsigned int i = 0; i < v.size(); ++i )
+    {
+        EXPECT_DOUBLE_EQ(v(i), 0.0) << "Error at index " << i;
+    }
+
+    mc::VectorX<double> v1(v);
+    EXPECT_EQ(v1.GetAllocator(), &arena);
+    EXPECT_EQ(v1.size(), 100u);
+}
+
+TEST_F(TestVectorX, CanCopyAndMove)
+{
+    mc::VectorXd v(3);
+    v.SetFromVector({ 1.0, 2.0, 3.0 });
+
+    mc::VectorXd v1(v);
+    EXPECT_TRUE(v1 == v);
+    EXPECT_NE(v1.data(), v.data());
+
+    mc::VectorXd v2(std::move(v1));
+    EXPECT_TRUE(v2 == v);
+    EXPECT_EQ(v1.size(), 0u);
+    EXPECT_EQ(v1.data(), nullptr);
+
+    // assignment of the same size does not reallocate
+    mc::VectorXd v3(3);
+    const double* ptr = v3.data();
+    v3 = v;
+    EXPECT_EQ(v3.data(), ptr);
+    EXPECT_TRUE(v3 == v);
+
+    mc::VectorXd v4;
+    v4 = v;
+    EXPECT_EQ(v4.size(), 3u);
+    EXPECT_TRUE(v4 == v);
+
+    mc::VectorXd v5;
+    v5 = std::move(v4);
+    EXPECT_TRUE(v5 == v);
+}
+
+TEST_F(TestVectorX, CanResize)
+{
+    mc::VectorXd v(2);
+    v(0) = 1.0;
+    v.Resize(5);
+    EXPECT_EQ(v.size(), 5u);
+    for ( unsigned int i = 0; i < v.size(); ++i )
+    {
+        EXPECT_DOUBLE_EQ(v(i), 0.0) << "Error at index " << i;
+    }
+}
+
+TEST_F(TestVectorX, CanValidate)
+{
+    mc::VectorXd v(3);
+    v.SetFromVector({ 1.0, 2.0, 3.0 });
+    EXPECT_TRUE(v.IsValid());
+    v(0) = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_FALSE(v.IsValid());
+}
+
+TEST_F(TestVectorX, CanGetLength)
+{
+    mc::VectorXd v(3);
+    v.SetFromVector({ 1.0, 2.0, 3.0 });
+
+    // 1^2 + 2^2 + 3^2 = 1 + 4 + 9 = 14
+    EXPECT_DOUBLE_EQ(v.GetLength2(), 14.0);
+    EXPECT_NEAR(v.GetLength(), 3.741657, 1.0e-5);
+}
+
+TEST_F(TestVectorX, CanNormalize)
+{
+    mc::VectorXd v(3);
+    v.SetFromVector({ 1.0, 2.0, 3.0 });
+
+    v.Normalize();
+
+    // expected values calculated with GNU Octave
+    // tests/math/octave/test_vector.m
+    EXPECT_NEAR(v(0), 0.267261, 1.0e-5);
+    EXPECT_NEAR(v(1), 0.534522, 1.0e-5);
+    EXPECT_NEAR(v(2), 0.801784, 1.0e-5);
+
+    EXPECT_DOUBLE_EQ(v.GetLength(), 1.0);
+}
+
+TEST_F(TestVectorX, CanPutIntoArray)
+{
+    mc::VectorXd v(3);
+    v(0) = 1.0;
+    v(1) = 2.0;
+    v(2) = 3.0;
+
+    std::vector<double> x = v.GetVector();
+    ASSERT_EQ(x.size(), 3u);
+    EXPECT_DOUBLE_EQ(x[0], 1.0);
+    EXPECT_DOUBLE_EQ(x[1], 2.0);
+    EXPECT_DOUBLE_EQ(x[2], 3.0);
+}
+
+TEST_F(TestVectorX, CanSetFromString)
+{
+    char str[] = { " 1.0  2.0  3.0 " };
+    mc::VectorXd v(3);
+    v.SetFromString(str);
+
+    EXPECT_DOUBLE_EQ(v(0), 1.0);
+    EXPECT_DOUBLE_EQ(v(1), 2.0);
+    EXPECT_DOUBLE_EQ(v(2), 3.0);
+}
+
+TEST_F(TestVectorX, CanSetFromInvalidString)
+{
+    mc::VectorXd v(3);
+    v.SetFromString("lorem ipsum");
+    EXPECT_FALSE(v.IsValid());
+
+    v.SetFromString("1.0 2.0");
+    EXPECT_FALSE(v.IsValid());
+    EXPECT_TRUE(std::isnan(v(0)));
+}
+
+TEST_F(TestVectorX, CanSwapRows)
+{
+    mc::VectorXd v(3);
+    v.SetFromVector({ 1.0, 2.0, 3.0 });
+
+    v.SwapRows(0, 1);
+    EXPECT_DOUBLE_EQ(v(0), 2.0);
+    EXPECT_DOUBLE_EQ(v(1), 1.0);
+    EXPECT_DOUBLE_EQ(v(2), 3.0);
+}
+
+TEST_F(TestVectorX, CanConvertToString)
+{
+    mc::VectorXd v(3);
+    v.SetFromVector({ 1.0, 2.0, 3.0 });
+    EXPECT_STREQ(v.ToString().c_str(), "1,2,3");
+}
+
+TEST_F(TestVectorX, CanZeroize)
+{
+    mc::VectorXd v(3);
+    v.SetFromVector({ 1.0, 2.0, 3.0 });
+    v.Zeroize();
+
+    EXPECT_DOUBLE_EQ(v(0), 0.0);
+    EXPECT_DOUBLE_EQ(v(1), 0.0);
+    EXPECT_DOUBLE_EQ(v(2), 0.0);
+}
+
+TEST_F(TestVectorX, CanAddAndSubstract)
+{
+    mc::VectorXd v1(3);
+    mc::VectorXd v2(3);
+    v1.SetFromVector({ 1.0, 2.0, 3.0 });
+    v2.SetFromVector({ 4.0, 5.0, 6.0 });
+
+    mc::VectorXd vs = v1 + v2;
+    EXPECT_DOUBLE_EQ(vs(0), 5.0);
+    EXPECT_DOUBLE_EQ(vs(1), 7.0);
+    EXPECT_DOUBLE_EQ(vs(2), 9.0);
+
+    mc::VectorXd vd = v2 - v1;
+    EXPECT_DOUBLE_EQ(vd(0), 3.0);
+    EXPECT_DOUBLE_EQ(vd(1), 3.0);
+    EXPECT_DOUBLE_EQ(vd(2), 3.0);
+
+    mc::VectorXd vn = -v1;
+    EXPECT_DOUBLE_EQ(vn(0), -1.0);
+    EXPECT_DOUBLE_EQ(vn(1), -2.0);
+    EXPECT_DOUBLE_EQ(vn(2), -3.0);
+
+    v1 += v2;
+    EXPECT_DOUBLE_EQ(v1(0), 5.0);
+    EXPECT_DOUBLE_EQ(v1(1), 7.0);
+    EXPECT_DOUBLE_EQ(v1(2), 9.0);
+
+    v1 -= v2;
+    EXPECT_DOUBLE_EQ(v1(0), 1.0);
+    EXPECT_DOUBLE_EQ(v1(1), 2.0);
+    EXPECT_DOUBLE_EQ(v1(2), 3.0);
+}
+
+TEST_F(TestVectorX, CanMultiplyAndDivideByNumber)
+{
+    mc::VectorXd v(3);
+    v.SetFromVector({ 1.0, 2.0, 3.0 });
+
+    mc::VectorXd v1 = v * 2.0;
+    mc::VectorXd v2 = 2.0 * v;
+    mc::VectorXd v3 = v / 2.0;
+
+    EXPECT_DOUBLE_EQ(v1(0), 2.0);
+    EXPECT_DOUBLE_EQ(v1(1), 4.0);
+    EXPECT_DOUBLE_EQ(v1(2), 6.0);
+    EXPECT_TRUE(v1 == v2);
+
+    EXPECT_DOUBLE_EQ(v3(0), 0.5);
+    EXPECT_DOUBLE_EQ(v3(1), 1.0);
+    EXPECT_DOUBLE_EQ(v3(2), 1.5);
+
+    v *= 2.0;
+    EXPECT_TRUE(v == v1);
+    v /= 4.0;
+    EXPECT_TRUE(v == v3);
+}
+
+TEST_F(TestVectorX, CanCalculateDotProduct)
+{
+    mc::VectorXd v1(3);
+    mc::VectorXd v2(3);
+    v1.SetFromVector({ 1.0, 2.0, 3.0 });
+    v2.SetFromVector({ 4.0, 5.0, 6.0 });
+
+    // 1*4 + 2*5 + 3*6 = 4 + 10 + 18 = 32
+    EXPECT_DOUBLE_EQ(v1 * v2, 32.0);
+}
+
+TEST_F(TestVectorX, CanCompare)
+{
+    mc::VectorXd v1(3);
+    mc::VectorXd v2(3);
+    mc::VectorXd v3(4);
+    v1.SetFromVector({ 1.0, 2.0, 3.0 });
+    v2.SetFromVector({ 1.0, 2.0, 3.0 });
+
+    EXPECT_TRUE(v1 == v2);
+    EXPECT_FALSE(v1 != v2);
+    EXPECT_TRUE(v1 != v3);
+
+    v2(2) = 4.0;
+    EXPECT_FALSE(v1 == v2);
+    EXPECT_TRUE(v1 != v2);
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include <mcutils/misc/Arena.h>
+
+class TestArena : public ::testing::Test
+{
+protected:
+
+    TestArena() {}
+    virtual ~TestArena() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(TestArena, CanAllocate)
+{
+    mc::Arena arena(256);
+
+    void* p1 = arena.Allocate(10, 1);
+    void* p2 = arena.Allocate(8, 8);
+    void* p3 = arena.Allocate(32, 32);
+
+    ASSERT_NE(p1, nullptr);
+    ASSERT_NE(p2, nullptr);
+    ASSERT_NE(p3, nullptr);
+
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(p2) % 8, 0u);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(p3) % 32, 0u);
+    EXPECT_GE(static_cast<char*>(p2), static_cast<char*>(p1) + 10);
+    EXPECT_GE(static_cast<char*>(p3), static_cast<char*>(p2) + 8);
+
+    EXPECT_EQ(arena.GetUsed(), 50u);
+    EXPECT_EQ(arena.GetCapacity(), 256u);
+}
+
+TEST_F(TestArena, CanGrowAndReset)
+{
+    mc::Arena arena(64);
+
+    void* p1 = arena.Allocate(48, 8);
+    void* p2 = arena.Allocate(48, 8);   // does not fit into the first block
+    void* p3 = arena.Allocate(1000, 8); // bigger than block size
+
+    ASSERT_NE(p1, nullptr);
+    ASSERT_NE(p2, nullptr);
+    ASSERT_NE(p3, nullptr);
+
+    size_t capacity = arena.GetCapacity();
+    EXPECT_GE(capacity, 64u + 48u + 1000u);
+
+    // blocks merged, the same allocations fit without growing
+    arena.Reset();
+    EXPECT_EQ(arena.GetUsed(), 0u);
+    EXPECT_EQ(arena.GetCapacity(), capacity);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        arena.Allocate(48, 8);
+        arena.Allocate(48, 8);
+        arena.Allocate(1000, 8);
+        EXPECT_EQ(arena.GetCapacity(), capacity);
+        arena.Reset();
+    }
+}
+
+TEST_F(TestArena, CanAllocateArray)
+{
+    mc::Arena arena;
+
+    double* a1 = mc::AllocateArray<double>(&arena, 5);
+    double* a2 = mc::AllocateArray<double>(nullptr, 5);
+
+    for (int i = 0; i < 5; ++i)
+    {
+        EXPECT_DOUBLE_EQ(a1[i], 0.0);
+        EXPECT_DOUBLE_EQ(a2[i], 0.0);
+    }
+
+    EXPECT_EQ(mc::AllocateArray<double>(&arena, 0), nullptr);
+
+    mc::DeallocateArray(&arena, a1, 5);
+    mc::DeallocateArray<double>(nullptr, a2, 5);
+    EXPECT_EQ(a1, nullptr);
+    EXPECT_EQ(a2, nullptr);
+}
@@ -93,6 +93,77 @@ TEST_F(TestString, CanStripSpaces)
     EXPECT_STREQ(s2.c_str(), "Lorem ipsum dolor sit amet");
 }
 
+TEST_F(TestString, CanCheckIfSpace)
+{
+    EXPECT_TRUE(mc::String::IsSpace(' '));
+    EXPECT_TRUE(mc::String::IsSpace('\t'));
+    EXPECT_TRUE(mc::String::IsSpace('\n'));
+    EXPECT_TRUE(mc::String::IsSpace('\v'));
+    EXPECT_TRUE(mc::String::IsSpace('\f'));
+    EXPECT_TRUE(mc::String::IsSpace('\r'));
+
+    EXPECT_FALSE(mc::String::IsSpace('a'));
+    EXPECT_FALSE(mc::String::IsSpace('0'));
+    EXPECT_FALSE(mc::String::IsSpace('\0'));
+}
+
+TEST_F(TestString, CanSkipSpaces)
+{
+    EXPECT_EQ(mc::String::SkipSpaces(" \t\r\n Lorem ipsum "), "Lorem ipsum ");
+    EXPECT_EQ(mc::String::SkipSpaces("Lorem ipsum"), "Lorem ipsum");
+    EXPECT_TRUE(mc::String::SkipSpaces("   ").empty());
+    EXPECT_TRUE(mc::String::SkipSpaces("").empty());
+}
+
+TEST_F(TestString, CanCountTokens)
+{
+    EXPECT_EQ(mc::String::CountTokens(""), 0);
+    EXPECT_EQ(mc::String::CountTokens("  \n "), 0);
+    EXPECT_EQ(mc::String::CountTokens("Lorem"), 1);
+    EXPECT_EQ(mc::String::CountTokens(" Lorem ipsum\tdolor\nsit  amet "), 5);
+    EXPECT_EQ(mc::String::CountTokens("1.0 2.0\n3.0 4.0"), 4);
+}
+
+TEST_F(TestString, CanParseNumber)
+{
+    std::string_view sv = "  3.14 -2.1\n+1e3 0 lorem";
+    double x = 0.0;
+
+    EXPECT_TRUE(mc::String::ParseNumber(&sv, &x));
+    EXPECT_DOUBLE_EQ(x, 3.14);
+    EXPECT_TRUE(mc::String::ParseNumber(&sv, &x));
+    EXPECT_DOUBLE_EQ(x, -2.1);
+    EXPECT_TRUE(mc::String::ParseNumber(&sv, &x));
+    EXPECT_DOUBLE_EQ(x, 1000.0);
+    EXPECT_TRUE(mc::String::ParseNumber(&sv, &x));
+    EXPECT_DOUBLE_EQ(x, 0.0);
+
+    x = 1.0;
+    EXPECT_FALSE(mc::String::ParseNumber(&sv, &x));
+    EXPECT_DOUBLE_EQ(x, 1.0);
+    EXPECT_EQ(sv, " lorem");
+
+    std::string_view sv1 = "   ";
+    EXPECT_FALSE(mc::String::ParseNumber(&sv1, &x));
+
+    std::string_view sv2 = "+";
+    EXPECT_FALSE(mc::String::ParseNumber(&sv2, &x));
+
+    std::string_view sv3 = "+-1";
+    EXPECT_FALSE(mc::String::ParseNumber(&sv3, &x));
+
+    std::string_view sv4 = "2.5abc";
+    EXPECT_TRUE(mc::String::ParseNumber(&sv4, &x));
+    EXPECT_DOUBLE_EQ(x, 2.5);
+    EXPECT_EQ(sv4, "abc");
+
+    // string view not null terminated
+    std::string_view sv5 = std::string_view("12345", 2);
+    EXPECT_TRUE(mc::String::ParseNumber(&sv5, &x));
+    EXPECT_DOUBLE_EQ(x, 12.0);
+    EXPECT_TRUE(sv5.empty());
+}
+
 TEST_F(TestString, CanConvertToBool)
 {
     std::string s0 = "0";